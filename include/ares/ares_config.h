@@ -13,6 +13,16 @@ struct CaptureConfig {
     int device_index = 0;
     std::string input_connection = "HDMI";
     int buffer_size = 3;
+
+    // Optional second DeckLink input, running concurrently with its own
+    // buffering. -1 disables it. While configured it can be composited
+    // as picture-in-picture (see PiPConfig) or promoted to the active
+    // source without re-initialization or HDMI resync
+    int secondary_device_index = -1;
+
+    // Which input feeds the main processing path: 0 = primary device,
+    // 1 = secondary. Takes effect on the next frame
+    int active_source = 0;
 };
 
 // Receiver configuration
@@ -29,6 +39,34 @@ struct ReceiverConfig {
     int fade_duration_ms = 500;
 };
 
+// Preview tap configuration (fleet monitoring)
+// Serves a GPU-downscaled preview of the rendered output as PNG over
+// HTTP on 127.0.0.1:port (single snapshot at /, multipart stream at
+// /stream). Fully asynchronous: the frame path contributes one GPU
+// blit and frames are skipped when the consumer is slow.
+struct PreviewConfig {
+    bool enabled = false;
+    int port = 8089;
+    int width = 854;   // preview width; height follows the output aspect
+};
+
+// Real-time scheduling configuration. Priorities are SCHED_FIFO
+// values (0 disables the policy change for that class); cpu fields pin
+// the thread to one core (-1 leaves affinity alone). Applying any of
+// this needs CAP_SYS_NICE; failures degrade to normal scheduling.
+struct RealtimeConfig {
+    bool enabled = false;
+    bool lock_memory = false;   // mlockall(MCL_CURRENT | MCL_FUTURE)
+
+    int main_priority = 10;     // main loop (frame path)
+    int capture_priority = 20;  // DeckLink frame delivery
+    int worker_priority = 8;    // pipeline worker (back half)
+
+    int main_cpu = -1;
+    int capture_cpu = -1;
+    int worker_cpu = -1;
+};
+
 // Master configuration structure
 struct AresConfig {
     CaptureConfig capture;
@@ -36,6 +74,8 @@ struct AresConfig {
     DisplayConfig display;
     OSDConfig osd;
     ReceiverConfig receiver;
+    PreviewConfig preview;
+    RealtimeConfig realtime;
 
     // Logging
     std::string log_level = "INFO";  // DEBUG, INFO, WARN, ERROR
@@ -45,6 +85,10 @@ struct AresConfig {
     // System
     bool daemon_mode = false;
     int thread_count = 4;  // Processing threads
+
+    // Latency measurement mode: per-stage capture->flip tracing plus an
+    // OSD corner marker for external glass-to-glass capture
+    bool latency_trace = false;
 };
 
 } // namespace ares
@@ -91,6 +91,13 @@ struct BlackBarConfig {
     float bootstrap_delay = 4.0f;       // Seconds to wait before bootstrap (skip dark openings)
     float bootstrap_duration = 2.0f;    // Seconds to run FFmpeg detection
 
+    // In-process bootstrap (no external process): aggressively sample the
+    // first frames after an input change with a relaxed confidence bar so
+    // a crop locks within ~1 second instead of waiting for FFmpeg
+    bool use_inprocess_bootstrap = true;
+    int bootstrap_frames = 60;          // Max frames to sample before settling
+    float bootstrap_confidence = 0.6f;  // Relaxed acceptance during bootstrap
+
     // Detection parameters
     int threshold = 16;                 // Pixel brightness threshold (0-255)
     float min_content_height = 0.5f;    // Minimum content height ratio (0.5 = 50%)
@@ -353,6 +360,34 @@ struct DitheringConfig {
     int lut_size = 64;                  // 6-bit (64) or 8-bit (256)
 };
 
+// Picture-in-picture configuration
+// Composites the secondary capture input (when one is configured) into a
+// corner of the output as part of the final render pass. The secondary
+// source keeps running while hidden, so toggling PiP or switching the
+// active input is instant — no re-initialization, no HDMI resync.
+struct PiPConfig {
+    bool enabled = false;
+
+    // PiP width as a fraction of the output width; height follows the
+    // secondary source's aspect ratio
+    float size = 0.25f;                 // 0.1-0.5
+
+    enum class Corner {
+        TOP_LEFT,
+        TOP_RIGHT,
+        BOTTOM_LEFT,
+        BOTTOM_RIGHT
+    } corner = Corner::TOP_RIGHT;
+
+    // Distance from the output edges, in output pixels
+    int margin = 48;
+
+    // Upload every Nth secondary frame. The inactive source does not
+    // need full rate; decimating its uploads keeps GPU headroom for the
+    // primary path
+    int frame_divisor = 3;
+};
+
 // Complete processing configuration
 struct ProcessingConfig {
     // Core processing
@@ -372,6 +407,7 @@ struct ProcessingConfig {
     // Optional processing
     SharpeningConfig sharpening;
     DeinterlaceConfig deinterlace;
+    PiPConfig pip;
 
     // Output configuration
     uint32_t output_width = 3840;
@@ -385,6 +421,30 @@ struct ProcessingConfig {
         HIGH_QUALITY    // Best quality, may be slower
     } quality = Quality::BALANCED;
 
+    // GPU-resident pipeline
+    // When enabled, frames are passed between processing stages as GPU
+    // textures (VideoFrame::gpu_tex) instead of being read back to system
+    // RAM and re-uploaded for every stage. At 4K60 10-bit the readback
+    // round-trips cost ~3 GB/s of PCIe traffic each way.
+    bool gpu_resident = true;
+    bool force_cpu_readback = false;    // Debug: read every stage back to system RAM
+
+    // Frame-overlapped pipelining
+    // When enabled, the tone mapping + OSD back half of frame N runs on a
+    // pipeline thread while the front half (analysis, crop, NLS) of frame
+    // N+1 starts on the capture thread. Adds one frame of latency but
+    // nearly doubles throughput when both halves are similar in cost.
+    bool pipelined = false;
+
+    // GPU device selection (multi-GPU hosts)
+    // An explicit index wins, then a case-insensitive substring match on
+    // the device name; both unset means automatic scoring. The render
+    // device need not be the one wired to the display: scanout goes
+    // through DRM on display.card, and when that is a different GPU the
+    // processed frames cross between devices as dma-bufs.
+    int gpu_device_index = -1;
+    std::string gpu_device_name;
+
     // Debug/diagnostics
     bool show_stats_overlay = false;
     bool show_color_bars = false;
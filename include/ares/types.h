@@ -21,6 +21,18 @@ enum class PixelFormat {
     RGB_16BIT_FLOAT
 };
 
+// Bytes per pixel for the packed RGB formats passed between pipeline
+// stages (planar YUV formats are sized by their own layouts)
+inline size_t bytesPerPixel(PixelFormat format) {
+    switch (format) {
+        case PixelFormat::RGBA_8BIT:       return 4;
+        case PixelFormat::RGB_10BIT:       return 4;  // 2:10:10:10 packed
+        case PixelFormat::RGB_16BIT_FLOAT: return 6;  // half float per channel
+        case PixelFormat::RGB_8BIT:
+        default:                           return 3;
+    }
+}
+
 // HDR metadata types
 enum class HDRType {
     NONE,
@@ -52,6 +64,14 @@ struct HDRMetadata {
     // Mastering display luminance
     uint32_t max_luminance; // cd/m² (nits)
     uint32_t min_luminance; // cd/m² * 10000
+
+    // Source-authored dynamic luminance (Dolby Vision L1 trim / HDR10+
+    // equivalent), refreshed per shot by sources that carry it. When
+    // valid this is strictly better input than histogram estimates and
+    // the renderer bypasses SceneAnalyzer entirely
+    bool has_dynamic = false;
+    float scene_max_nits = 0.0f;   // per-shot peak
+    float scene_avg_nits = 0.0f;   // per-shot frame average
 };
 
 // Video frame structure
@@ -64,6 +84,64 @@ struct VideoFrame {
     Timestamp pts;
     HDRMetadata hdr_metadata;
     bool interlaced = false;
+
+    // GPU-resident frame data (optional)
+    // When non-null, the frame lives in a pl_tex owned by the processing
+    // stage that produced it and `data` may be null. Stages check this
+    // before falling back to the CPU upload/download path, so frames can
+    // stay on the GPU between crop -> NLS -> tone mapping -> OSD.
+    // Stored as void* to keep this header free of libplacebo dependencies.
+    void* gpu_tex = nullptr;
+
+    // True if the frame payload is a GPU texture (no CPU copy available)
+    bool isGPUResident() const { return gpu_tex != nullptr; }
+
+    // dma-buf backing (optional)
+    // When >= 0, `data` points into a dma-buf-backed capture buffer and
+    // this fd exports the same pages, so GPU stages can import the frame
+    // (VK_EXT_external_memory_dma_buf) instead of staging a CPU copy.
+    // The fd is owned by the capture allocator, not the frame.
+    int dmabuf_fd = -1;
+
+    // Driver-owned frame payload (optional)
+    // For zero-copy capture `data` points directly into a refcounted driver
+    // buffer (e.g. an AddRef'd IDeckLinkVideoInputFrame). The consumer must
+    // call release() exactly once after the data has been consumed (typically
+    // after GPU upload); until then the buffer must not be freed or modified.
+    void (*release_cb)(void* opaque) = nullptr;
+    void* release_opaque = nullptr;
+
+    // Release the underlying driver buffer (no-op for owned/heap frames)
+    void release() {
+        if (release_cb) {
+            release_cb(release_opaque);
+            release_cb = nullptr;
+            release_opaque = nullptr;
+            data = nullptr;
+            size = 0;
+        }
+    }
+
+    // True if `data` is borrowed from a driver buffer (do not delete[])
+    bool isDriverOwned() const { return release_cb != nullptr; }
+
+    // Source crop (optional)
+    // When set, the stored pixels are full-size but only the sub-rectangle
+    // [crop_x, crop_x + crop_w) x [crop_y, crop_y + crop_h) is active.
+    // The crop stage fills these instead of copying pixels; the first GPU
+    // pass applies them through source texture coordinates. crop_w/crop_h
+    // of 0 means no crop.
+    uint32_t crop_x = 0;
+    uint32_t crop_y = 0;
+    uint32_t crop_w = 0;
+    uint32_t crop_h = 0;
+
+    // True if only a sub-rectangle of the frame is active
+    bool hasCrop() const { return crop_w != 0 || crop_h != 0; }
+
+    // Active dimensions (crop applied, full frame otherwise)
+    uint32_t croppedWidth() const { return crop_w != 0 ? crop_w : width; }
+    uint32_t croppedHeight() const { return crop_h != 0 ? crop_h : height; }
 };
 
 // Result type for error handling
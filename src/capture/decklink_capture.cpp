@@ -1,5 +1,7 @@
 #include "decklink_capture.h"
+#include "dmabuf_allocator.h"
 #include "core/logger.h"
+#include "core/rt_sched.h"
 
 // DeckLink SDK headers
 #include "DeckLinkAPI.h"
@@ -53,6 +55,13 @@ public:
             return S_OK;
         }
 
+        // The delivery thread belongs to the DeckLink driver, so its
+        // scheduling class can only be applied from inside the callback
+        if (!m_rt_applied) {
+            core::RTSched::applyCurrentThread(core::RTSched::CLASS_CAPTURE);
+            m_rt_applied = true;
+        }
+
         // Get hardware timestamp
         BMDTimeValue frame_time;
         BMDTimeValue frame_duration;
@@ -76,6 +85,88 @@ public:
 private:
     DeckLinkCapture* m_capture;
     int32_t m_ref_count;
+    bool m_rt_applied = false;  // scheduling class applied once per thread
+};
+
+// Supplies the DeckLink driver with udmabuf-backed capture buffers, so
+// the PCIe DMA lands in pages that are simultaneously exported as
+// dma-buf fds (importable into Vulkan without a CPU staging copy).
+// Falls back to plain aligned heap buffers when /dev/udmabuf is missing.
+class DeckLinkDmaBufAllocator : public IDeckLinkMemoryAllocator {
+public:
+    DeckLinkDmaBufAllocator() : m_ref_count(1) {}
+
+    // IUnknown interface
+    virtual HRESULT QueryInterface(REFIID, LPVOID*) override {
+        return E_NOINTERFACE;
+    }
+
+    virtual ULONG AddRef() override {
+        return __sync_add_and_fetch(&m_ref_count, 1);
+    }
+
+    virtual ULONG Release() override {
+        int32_t new_ref = __sync_sub_and_fetch(&m_ref_count, 1);
+        if (new_ref == 0) {
+            delete this;
+            return 0;
+        }
+        return new_ref;
+    }
+
+    // IDeckLinkMemoryAllocator interface
+    virtual HRESULT AllocateBuffer(unsigned int buffer_size, void** allocated_buffer) override {
+        if (!m_pool_ready) {
+            // Lazy init: the buffer size is only known once the driver asks
+            m_pool_failed =
+                (m_pool.initialize(buffer_size, POOL_BLOCKS) != Result::SUCCESS);
+            m_pool_ready = true;
+        }
+
+        if (!m_pool_failed) {
+            DmaBufBlock* block = m_pool.acquire();
+            if (block && block->size >= buffer_size) {
+                *allocated_buffer = block->data;
+                return S_OK;
+            }
+            if (block) {
+                m_pool.release(block);
+            }
+        }
+
+        // Fallback: aligned heap memory (no dma-buf export for this buffer)
+        if (posix_memalign(allocated_buffer, 4096, buffer_size) != 0) {
+            return E_OUTOFMEMORY;
+        }
+        return S_OK;
+    }
+
+    virtual HRESULT ReleaseBuffer(void* buffer) override {
+        DmaBufBlock* block = m_pool.findBlock(buffer);
+        if (block) {
+            m_pool.release(block);
+        } else {
+            free(buffer);
+        }
+        return S_OK;
+    }
+
+    virtual HRESULT Commit() override { return S_OK; }
+    virtual HRESULT Decommit() override { return S_OK; }
+
+    // dma-buf fd for a driver buffer pointer, or -1 for heap fallbacks
+    int findDmaBufFd(const void* ptr) {
+        DmaBufBlock* block = m_pool.findBlock(ptr);
+        return block ? block->dmabuf_fd : -1;
+    }
+
+private:
+    static constexpr size_t POOL_BLOCKS = 8;
+
+    DmaBufAllocator m_pool;
+    bool m_pool_ready = false;
+    bool m_pool_failed = false;
+    int32_t m_ref_count;
 };
 
 // Helper function to create DeckLink iterator
@@ -115,6 +206,11 @@ DeckLinkCapture::~DeckLinkCapture() {
         m_decklink_input = nullptr;
     }
 
+    if (m_memory_allocator) {
+        m_memory_allocator->Release();
+        m_memory_allocator = nullptr;
+    }
+
     if (m_decklink) {
         m_decklink->Release();
         m_decklink = nullptr;
@@ -220,6 +316,16 @@ Result DeckLinkCapture::initialize(const CaptureConfig& config) {
     // Choose pixel format (10-bit YUV or 8-bit)
     BMDPixelFormat pixel_format = config.enable_10bit ? bmdFormat10BitYUV : bmdFormat8BitYUV;
 
+    // Hand the driver dma-buf backed capture buffers (must be installed
+    // before the input is enabled); fds are attached in getFrame so GPU
+    // stages can import frames with zero CPU copies
+    m_memory_allocator = new DeckLinkDmaBufAllocator();
+    if (m_decklink_input->SetVideoInputFrameMemoryAllocator(m_memory_allocator) != S_OK) {
+        LOG_WARN("Capture", "Custom frame allocator rejected, dma-buf capture disabled");
+        m_memory_allocator->Release();
+        m_memory_allocator = nullptr;
+    }
+
     // Enable video input
     BMDVideoInputFlags flags = bmdVideoInputEnableFormatDetection;
 
@@ -280,9 +386,12 @@ Result DeckLinkCapture::stop() {
 
     m_running = false;
 
-    // Clear frame queue
+    // Clear frame queue (dropping references on zero-copy driver frames)
     std::lock_guard<std::mutex> lock(m_queue_mutex);
     while (!m_frame_queue.empty()) {
+        if (m_frame_queue.front().driver_frame) {
+            m_frame_queue.front().driver_frame->Release();
+        }
         m_frame_queue.pop();
     }
 
@@ -310,7 +419,18 @@ Result DeckLinkCapture::getFrame(VideoFrame& frame, int timeout_ms) {
     m_frame_queue.pop();
 
     // Copy to output frame
-    frame.data = queued.data.release();
+    if (queued.driver_frame) {
+        // Zero-copy: the frame borrows the driver buffer; the consumer
+        // must call frame.release() once the data has been uploaded
+        frame.data = queued.driver_data;
+        frame.release_cb = &DeckLinkCapture::releaseDriverFrame;
+        frame.release_opaque = queued.driver_frame;
+        if (m_memory_allocator) {
+            frame.dmabuf_fd = m_memory_allocator->findDmaBufFd(queued.driver_data);
+        }
+    } else {
+        frame.data = queued.data.release();
+    }
     frame.size = queued.size;
     frame.width = queued.width;
     frame.height = queued.height;
@@ -321,6 +441,12 @@ Result DeckLinkCapture::getFrame(VideoFrame& frame, int timeout_ms) {
     return Result::SUCCESS;
 }
 
+void DeckLinkCapture::releaseDriverFrame(void* opaque) {
+    if (opaque) {
+        static_cast<IDeckLinkVideoInputFrame*>(opaque)->Release();
+    }
+}
+
 bool DeckLinkCapture::hasFrame() const {
     std::lock_guard<std::mutex> lock(m_queue_mutex);
     return !m_frame_queue.empty();
@@ -353,10 +479,7 @@ void DeckLinkCapture::onFrameReceived(IDeckLinkVideoInputFrame* video_frame, int
         return;
     }
 
-    // Allocate frame buffer
     size_t frame_size = row_bytes * height;
-    auto buffer = std::make_unique<uint8_t[]>(frame_size);
-    std::memcpy(buffer.get(), frame_data, frame_size);
 
     // Determine pixel format
     PixelFormat ares_format = PixelFormat::UNKNOWN;
@@ -372,7 +495,17 @@ void DeckLinkCapture::onFrameReceived(IDeckLinkVideoInputFrame* video_frame, int
 
     // Create queued frame
     QueuedFrame queued;
-    queued.data = std::move(buffer);
+    if (m_config.zero_copy) {
+        // Zero-copy: keep a reference on the driver's frame and pass its
+        // buffer pointer through, no memcpy on the capture hot path
+        video_frame->AddRef();
+        queued.driver_frame = video_frame;
+        queued.driver_data = static_cast<uint8_t*>(frame_data);
+    } else {
+        // Copy mode: snapshot the driver buffer
+        queued.data = std::make_unique<uint8_t[]>(frame_size);
+        std::memcpy(queued.data.get(), frame_data, frame_size);
+    }
     queued.size = frame_size;
     queued.width = width;
     queued.height = height;
@@ -386,6 +519,9 @@ void DeckLinkCapture::onFrameReceived(IDeckLinkVideoInputFrame* video_frame, int
 
         // Drop oldest frame if queue is full
         if (m_frame_queue.size() >= MAX_QUEUE_SIZE) {
+            if (m_frame_queue.front().driver_frame) {
+                m_frame_queue.front().driver_frame->Release();
+            }
             m_frame_queue.pop();
 
             std::lock_guard<std::mutex> stats_lock(m_stats_mutex);
@@ -444,16 +580,43 @@ void DeckLinkCapture::parseHDRMetadata(IDeckLinkVideoInputFrame* video_frame, HD
 
     // Parse HDR10 static metadata (SMPTE ST 2086)
     if (metadata.type == HDRType::HDR10) {
-        // Try to get HDR metadata
-        // Note: DeckLink SDK may not expose all HDR metadata directly
-        // This is a simplified implementation
-
         // Set default HDR10 values
         metadata.max_cll = 1000;  // Default max content light level
         metadata.max_fall = 400;  // Default max frame-average light level
         metadata.max_luminance = 1000; // cd/m²
         metadata.min_luminance = 50;   // cd/m² * 10000 (0.005 cd/m²)
 
+        // Read the actual light levels from the frame's HDR InfoFrame
+        // when the source provides them. Dolby Vision's RPU itself rides
+        // inside the video payload and is not reachable from a baseband
+        // HDMI capture, but low-latency DV and HDR10+ players refresh
+        // these InfoFrame values per shot — effectively the L1 trim —
+        // so downstream tone mapping can use them directly instead of
+        // estimating the same numbers from a histogram
+        double max_cll = 0.0;
+        double max_fall = 0.0;
+        double max_mastering = 0.0;
+        double min_mastering = 0.0;
+        if (metadata_ext->GetFloat(bmdDeckLinkFrameMetadataHDRMaximumContentLightLevel,
+                                   &max_cll) == S_OK && max_cll > 0.0) {
+            metadata.max_cll = (uint16_t)max_cll;
+            metadata.has_dynamic = true;
+            metadata.scene_max_nits = (float)max_cll;
+        }
+        if (metadata_ext->GetFloat(bmdDeckLinkFrameMetadataHDRMaximumFrameAverageLightLevel,
+                                   &max_fall) == S_OK && max_fall > 0.0) {
+            metadata.max_fall = (uint16_t)max_fall;
+            metadata.scene_avg_nits = (float)max_fall;
+        }
+        if (metadata_ext->GetFloat(bmdDeckLinkFrameMetadataHDRMaxDisplayMasteringLuminance,
+                                   &max_mastering) == S_OK && max_mastering > 0.0) {
+            metadata.max_luminance = (uint32_t)max_mastering;
+        }
+        if (metadata_ext->GetFloat(bmdDeckLinkFrameMetadataHDRMinDisplayMasteringLuminance,
+                                   &min_mastering) == S_OK && min_mastering > 0.0) {
+            metadata.min_luminance = (uint32_t)(min_mastering * 10000.0);
+        }
+
         // Default BT.2020 primaries
         metadata.mastering_display.primary_r_x = 34000;
         metadata.mastering_display.primary_r_y = 16000;
@@ -18,6 +18,12 @@ struct CaptureConfig {
     float frame_rate = 60.0f;
     bool enable_10bit = true;
     std::string input_connection = "HDMI"; // HDMI, SDI, etc.
+
+    // Zero-copy capture: AddRef the driver's IDeckLinkVideoInputFrame and
+    // hand its buffer pointer through the pipeline instead of memcpy'ing
+    // every frame out of the driver buffer. The consumer releases the frame
+    // via VideoFrame::release() after GPU upload.
+    bool zero_copy = true;
 };
 
 #ifdef ARES_HAS_DECKLINK
@@ -32,6 +38,9 @@ class IDeckLinkInputCallback;
 // Internal DeckLink callback handler
 class DeckLinkCaptureCallback;
 
+// Internal dma-buf-backed frame memory allocator
+class DeckLinkDmaBufAllocator;
+
 class DeckLinkCapture {
 public:
     DeckLinkCapture();
@@ -85,12 +94,19 @@ private:
     IDeckLinkInput* m_decklink_input = nullptr;
     DeckLinkCaptureCallback* m_callback = nullptr;
 
+    // Custom frame allocator: hands the driver udmabuf-backed buffers so
+    // captured frames carry a dma-buf fd for zero-copy GPU import; null
+    // when /dev/udmabuf is unavailable or the driver rejects it
+    DeckLinkDmaBufAllocator* m_memory_allocator = nullptr;
+
     // Configuration
     CaptureConfig m_config;
 
     // Frame queue
     struct QueuedFrame {
-        std::unique_ptr<uint8_t[]> data;
+        std::unique_ptr<uint8_t[]> data;    // Owned copy (copy mode only)
+        IDeckLinkVideoInputFrame* driver_frame = nullptr;  // AddRef'd (zero-copy mode)
+        uint8_t* driver_data = nullptr;     // Pointer into driver buffer (zero-copy mode)
         size_t size;
         uint32_t width;
         uint32_t height;
@@ -99,6 +115,9 @@ private:
         HDRMetadata hdr_metadata;
     };
 
+    // Release callback for zero-copy frames (VideoFrame::release_cb)
+    static void releaseDriverFrame(void* opaque);
+
     std::queue<QueuedFrame> m_frame_queue;
     mutable std::mutex m_queue_mutex;
     std::condition_variable m_queue_cv;
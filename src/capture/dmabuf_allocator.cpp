@@ -0,0 +1,152 @@
+#include "dmabuf_allocator.h"
+#include "core/logger.h"
+
+#include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <cerrno>
+#include <linux/udmabuf.h>
+
+namespace ares {
+namespace capture {
+
+DmaBufAllocator::DmaBufAllocator() = default;
+
+DmaBufAllocator::~DmaBufAllocator() {
+    shutdown();
+}
+
+Result DmaBufAllocator::initialize(size_t block_size, size_t count) {
+    // udmabuf requires page-aligned sizes
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    block_size = (block_size + page - 1) & ~(page - 1);
+
+    int udmabuf_fd = open("/dev/udmabuf", O_RDWR);
+    if (udmabuf_fd < 0) {
+        LOG_WARN("DmaBuf", "/dev/udmabuf unavailable (%s), dma-buf capture disabled",
+                 strerror(errno));
+        return Result::ERROR_NOT_FOUND;
+    }
+    close(udmabuf_fd);
+
+    m_blocks.resize(count);
+    for (DmaBufBlock& block : m_blocks) {
+        if (createBlock(block, block_size) != Result::SUCCESS) {
+            shutdown();
+            return Result::ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    m_available = true;
+    LOG_INFO("DmaBuf", "Allocated %zu dma-buf capture blocks of %zu MB",
+             count, block_size >> 20);
+    return Result::SUCCESS;
+}
+
+Result DmaBufAllocator::createBlock(DmaBufBlock& block, size_t size) {
+    block.memfd = memfd_create("ares-capture", MFD_ALLOW_SEALING);
+    if (block.memfd < 0) {
+        LOG_ERROR("DmaBuf", "memfd_create failed: %s", strerror(errno));
+        return Result::ERROR_OUT_OF_MEMORY;
+    }
+
+    if (ftruncate(block.memfd, size) != 0 ||
+        fcntl(block.memfd, F_ADD_SEALS, F_SEAL_SHRINK) != 0) {
+        LOG_ERROR("DmaBuf", "Failed to size/seal memfd: %s", strerror(errno));
+        destroyBlock(block);
+        return Result::ERROR_OUT_OF_MEMORY;
+    }
+
+    block.data = (uint8_t*)mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                                MAP_SHARED, block.memfd, 0);
+    if (block.data == MAP_FAILED) {
+        block.data = nullptr;
+        LOG_ERROR("DmaBuf", "mmap failed: %s", strerror(errno));
+        destroyBlock(block);
+        return Result::ERROR_OUT_OF_MEMORY;
+    }
+    block.size = size;
+
+    int udmabuf_fd = open("/dev/udmabuf", O_RDWR);
+    if (udmabuf_fd < 0) {
+        destroyBlock(block);
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    struct udmabuf_create create = {};
+    create.memfd = (uint32_t)block.memfd;
+    create.flags = UDMABUF_FLAGS_CLOEXEC;
+    create.offset = 0;
+    create.size = size;
+    block.dmabuf_fd = ioctl(udmabuf_fd, UDMABUF_CREATE, &create);
+    close(udmabuf_fd);
+
+    if (block.dmabuf_fd < 0) {
+        LOG_ERROR("DmaBuf", "UDMABUF_CREATE failed: %s", strerror(errno));
+        destroyBlock(block);
+        return Result::ERROR_OUT_OF_MEMORY;
+    }
+
+    return Result::SUCCESS;
+}
+
+void DmaBufAllocator::destroyBlock(DmaBufBlock& block) {
+    if (block.data) {
+        munmap(block.data, block.size);
+        block.data = nullptr;
+    }
+    if (block.dmabuf_fd >= 0) {
+        close(block.dmabuf_fd);
+        block.dmabuf_fd = -1;
+    }
+    if (block.memfd >= 0) {
+        close(block.memfd);
+        block.memfd = -1;
+    }
+    block.size = 0;
+    block.in_use = false;
+}
+
+void DmaBufAllocator::shutdown() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (DmaBufBlock& block : m_blocks) {
+        destroyBlock(block);
+    }
+    m_blocks.clear();
+    m_available = false;
+}
+
+DmaBufBlock* DmaBufAllocator::acquire() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (DmaBufBlock& block : m_blocks) {
+        if (!block.in_use) {
+            block.in_use = true;
+            return &block;
+        }
+    }
+    return nullptr;
+}
+
+void DmaBufAllocator::release(DmaBufBlock* block) {
+    if (!block) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    block->in_use = false;
+}
+
+DmaBufBlock* DmaBufAllocator::findBlock(const void* ptr) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const uint8_t* p = (const uint8_t*)ptr;
+    for (DmaBufBlock& block : m_blocks) {
+        if (block.data && p >= block.data && p < block.data + block.size) {
+            return &block;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace capture
+} // namespace ares
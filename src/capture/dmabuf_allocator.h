@@ -0,0 +1,62 @@
+#pragma once
+
+#include <ares/types.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <mutex>
+
+namespace ares {
+namespace capture {
+
+// A capture buffer backed by a dma-buf.
+//
+// `data` is the CPU mapping the DeckLink driver DMAs into; `dmabuf_fd`
+// is the same pages exported as a dma-buf, importable into Vulkan via
+// VK_EXT_external_memory_dma_buf so the GPU reads capture frames without
+// any CPU-side copy.
+struct DmaBufBlock {
+    uint8_t* data = nullptr;
+    size_t size = 0;
+    int dmabuf_fd = -1;
+    int memfd = -1;
+    bool in_use = false;
+};
+
+// Allocates capture buffers as udmabuf-backed dma-bufs.
+//
+// Each block is a sealed memfd turned into a dma-buf through
+// /dev/udmabuf, giving one set of pages with both a CPU mapping (for the
+// capture driver) and a dma-buf fd (for GPU import). When /dev/udmabuf
+// is unavailable the allocator reports isAvailable() == false and
+// callers fall back to their regular heap buffers.
+class DmaBufAllocator {
+public:
+    DmaBufAllocator();
+    ~DmaBufAllocator();
+
+    // Preallocate `count` blocks of `block_size` bytes (page-aligned)
+    Result initialize(size_t block_size, size_t count);
+    void shutdown();
+
+    bool isAvailable() const { return m_available; }
+
+    // Acquire a free block; returns nullptr when all blocks are in use
+    DmaBufBlock* acquire();
+    void release(DmaBufBlock* block);
+
+    // Find the block containing `ptr` (for attaching the dma-buf fd to a
+    // frame handed out by a driver callback), or nullptr
+    DmaBufBlock* findBlock(const void* ptr);
+
+private:
+    Result createBlock(DmaBufBlock& block, size_t size);
+    void destroyBlock(DmaBufBlock& block);
+
+    std::vector<DmaBufBlock> m_blocks;
+    std::mutex m_mutex;
+    bool m_available = false;
+};
+
+} // namespace capture
+} // namespace ares
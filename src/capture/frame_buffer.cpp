@@ -1,13 +1,41 @@
 #include "frame_buffer.h"
+#include "core/frame_pool.h"
 #include "core/logger.h"
 #include <algorithm>
 #include <cstring>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+// Futex wrappers for the SPSC empty-wait path. std::atomic<uint32_t> is
+// layout-compatible with the 32-bit word the futex syscall expects.
+void futexWait(std::atomic<uint32_t>& word, uint32_t expected, int timeout_ms) {
+    struct timespec ts;
+    ts.tv_sec = timeout_ms / 1000;
+    ts.tv_nsec = (timeout_ms % 1000) * 1000000L;
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word),
+            FUTEX_WAIT_PRIVATE, expected, &ts, nullptr, 0);
+}
+
+void futexWake(std::atomic<uint32_t>& word) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word),
+            FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+}
+
+} // namespace
 
 namespace ares {
 namespace capture {
 
-FrameBuffer::FrameBuffer(size_t capacity) : m_capacity(capacity) {
-    LOG_INFO("FrameBuffer", "Created with capacity %zu", capacity);
+FrameBuffer::FrameBuffer(size_t capacity, bool spsc)
+    : m_capacity(capacity), m_spsc(spsc) {
+    if (m_spsc) {
+        m_ring.resize(capacity + 1);
+    }
+    LOG_INFO("FrameBuffer", "Created with capacity %zu (%s mode)",
+             capacity, m_spsc ? "lock-free SPSC" : "mutex");
 }
 
 FrameBuffer::~FrameBuffer() {
@@ -15,6 +43,10 @@ FrameBuffer::~FrameBuffer() {
 }
 
 Result FrameBuffer::push(const VideoFrame& frame, bool drop_oldest_on_full) {
+    if (m_spsc) {
+        return pushSPSC(frame, drop_oldest_on_full);
+    }
+
     std::lock_guard<std::mutex> lock(m_mutex);
 
     // Check if buffer is full
@@ -26,7 +58,13 @@ Result FrameBuffer::push(const VideoFrame& frame, bool drop_oldest_on_full) {
 
         // Drop oldest frame
         if (!m_queue.empty()) {
-            m_queue.pop();
+            BufferedFrame& oldest = m_queue.front();
+            if (oldest.frame.isDriverOwned()) {
+                oldest.frame.release();
+            } else if (oldest.frame.data) {
+                core::FramePool::getInstance().release(oldest.frame.data);
+            }
+            m_queue.pop_front();
 
             std::lock_guard<std::mutex> stats_lock(m_stats_mutex);
             m_stats.frames_dropped++;
@@ -37,18 +75,14 @@ Result FrameBuffer::push(const VideoFrame& frame, bool drop_oldest_on_full) {
 
     // Create buffered frame with timing info
     BufferedFrame buffered;
-
-    // Deep copy frame data
-    buffered.frame.width = frame.width;
-    buffered.frame.height = frame.height;
-    buffered.frame.format = frame.format;
-    buffered.frame.pts = frame.pts;
-    buffered.frame.hdr_metadata = frame.hdr_metadata;
-    buffered.frame.interlaced = frame.interlaced;
-    buffered.frame.size = frame.size;
-
-    if (frame.data && frame.size > 0) {
-        buffered.frame.data = new uint8_t[frame.size];
+    buffered.frame = frame;
+
+    if (frame.isDriverOwned()) {
+        // Zero-copy: the buffer takes over the driver reference, the pointer
+        // flows through without a memcpy (caller must not release the frame)
+    } else if (frame.data && frame.size > 0) {
+        // Deep copy frame data
+        buffered.frame.data = core::FramePool::getInstance().acquire(frame.size);
         std::memcpy(buffered.frame.data, frame.data, frame.size);
     } else {
         buffered.frame.data = nullptr;
@@ -63,7 +97,7 @@ Result FrameBuffer::push(const VideoFrame& frame, bool drop_oldest_on_full) {
     buffered.timing.is_repeated = false;
 
     // Add to queue
-    m_queue.push(buffered);
+    m_queue.push_back(buffered);
     m_cv.notify_one();
 
     // Update statistics
@@ -91,6 +125,10 @@ Result FrameBuffer::push(const VideoFrame& frame, bool drop_oldest_on_full) {
 }
 
 Result FrameBuffer::pop(VideoFrame& frame, int timeout_ms) {
+    if (m_spsc) {
+        return popSPSC(frame, timeout_ms);
+    }
+
     std::unique_lock<std::mutex> lock(m_mutex);
 
     // Wait for frame with timeout
@@ -104,7 +142,7 @@ Result FrameBuffer::pop(VideoFrame& frame, int timeout_ms) {
                 // Deep copy last frame
                 frame = m_last_frame.frame;
                 if (m_last_frame.frame.data && m_last_frame.frame.size > 0) {
-                    frame.data = new uint8_t[m_last_frame.frame.size];
+                    frame.data = core::FramePool::getInstance().acquire(m_last_frame.frame.size);
                     std::memcpy(frame.data, m_last_frame.frame.data, m_last_frame.frame.size);
                 }
 
@@ -124,23 +162,33 @@ Result FrameBuffer::pop(VideoFrame& frame, int timeout_ms) {
 
     // Get frame from queue
     BufferedFrame buffered = std::move(m_queue.front());
-    m_queue.pop();
+    m_queue.pop_front();
 
     // Transfer frame to output
     frame = buffered.frame;
 
     // Save as last frame for potential repeat
     if (m_has_last_frame && m_last_frame.frame.data) {
-        delete[] m_last_frame.frame.data;
+        core::FramePool::getInstance().release(m_last_frame.frame.data);
     }
 
     m_last_frame = buffered;
-    // Deep copy for last frame
-    if (buffered.frame.data && buffered.frame.size > 0) {
-        m_last_frame.frame.data = new uint8_t[buffered.frame.size];
-        std::memcpy(m_last_frame.frame.data, buffered.frame.data, buffered.frame.size);
+    if (buffered.frame.isDriverOwned()) {
+        // Don't hold a second reference on driver buffers; repeat logic
+        // only applies to frames we own
+        m_last_frame.frame.data = nullptr;
+        m_last_frame.frame.size = 0;
+        m_last_frame.frame.release_cb = nullptr;
+        m_last_frame.frame.release_opaque = nullptr;
+        m_has_last_frame = false;
+    } else {
+        // Deep copy for last frame
+        if (buffered.frame.data && buffered.frame.size > 0) {
+            m_last_frame.frame.data = core::FramePool::getInstance().acquire(buffered.frame.size);
+            std::memcpy(m_last_frame.frame.data, buffered.frame.data, buffered.frame.size);
+        }
+        m_has_last_frame = true;
     }
-    m_has_last_frame = true;
 
     // Update statistics
     {
@@ -151,7 +199,154 @@ Result FrameBuffer::pop(VideoFrame& frame, int timeout_ms) {
     return Result::SUCCESS;
 }
 
+Result FrameBuffer::pushSPSC(const VideoFrame& frame, bool drop_on_full) {
+    const uint32_t ring_size = (uint32_t)m_ring.size();
+    uint32_t tail = m_ring_tail.load(std::memory_order_relaxed);
+    uint32_t next = (tail + 1) % ring_size;
+
+    if (next == m_ring_head.load(std::memory_order_acquire)) {
+        // Ring full. The producer cannot safely reach across and drop the
+        // consumer's oldest slot, so SPSC mode drops the incoming frame
+        // instead (equivalent steady-state behavior: one frame lost)
+        if (!drop_on_full) {
+            return Result::ERROR_OUT_OF_MEMORY;
+        }
+
+        if (frame.isDriverOwned()) {
+            VideoFrame doomed = frame;
+            doomed.release();
+        }
+
+        m_spsc_dropped.fetch_add(1, std::memory_order_relaxed);
+        LOG_DEBUG("FrameBuffer", "SPSC ring full, dropped incoming frame");
+        return Result::SUCCESS;
+    }
+
+    BufferedFrame& buffered = m_ring[tail];
+    buffered.frame = frame;
+
+    if (frame.isDriverOwned()) {
+        // Zero-copy: slot takes over the driver reference
+    } else if (frame.data && frame.size > 0) {
+        buffered.frame.data = core::FramePool::getInstance().acquire(frame.size);
+        std::memcpy(buffered.frame.data, frame.data, frame.size);
+    } else {
+        buffered.frame.data = nullptr;
+    }
+
+    buffered.timing.arrival_time = std::chrono::steady_clock::now();
+    buffered.timing.target_time = frame.pts;
+    buffered.timing.latency = buffered.timing.target_time - buffered.timing.arrival_time;
+    buffered.timing.is_late = buffered.timing.arrival_time > buffered.timing.target_time;
+    buffered.timing.is_dropped = false;
+    buffered.timing.is_repeated = false;
+
+    // Publish the slot, then wake the consumer only if it parked
+    m_ring_tail.store(next, std::memory_order_release);
+    if (m_consumer_waiting.load(std::memory_order_acquire)) {
+        futexWake(m_ring_tail);
+    }
+
+    m_spsc_pushed.fetch_add(1, std::memory_order_relaxed);
+    if (buffered.timing.is_late) {
+        m_spsc_late.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t latency_ns = (uint64_t)std::max<int64_t>(0,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(buffered.timing.latency).count());
+    m_spsc_latency_total_ns.fetch_add(latency_ns, std::memory_order_relaxed);
+    if (latency_ns > m_spsc_latency_max_ns.load(std::memory_order_relaxed)) {
+        m_spsc_latency_max_ns.store(latency_ns, std::memory_order_relaxed);
+    }
+
+    return Result::SUCCESS;
+}
+
+Result FrameBuffer::popSPSC(VideoFrame& frame, int timeout_ms) {
+    const uint32_t ring_size = (uint32_t)m_ring.size();
+    uint32_t head = m_ring_head.load(std::memory_order_relaxed);
+
+    // Wait (futex) while empty, but only up to the timeout
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    uint32_t tail = m_ring_tail.load(std::memory_order_acquire);
+
+    while (tail == head) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            // Timeout - repeat the last frame if we have one (last-frame
+            // state is consumer-only in SPSC mode, no lock needed)
+            if (m_has_last_frame) {
+                LOG_DEBUG("FrameBuffer", "Timeout, repeating last frame");
+
+                frame = m_last_frame.frame;
+                if (m_last_frame.frame.data && m_last_frame.frame.size > 0) {
+                    frame.data = core::FramePool::getInstance().acquire(m_last_frame.frame.size);
+                    std::memcpy(frame.data, m_last_frame.frame.data, m_last_frame.frame.size);
+                }
+
+                m_spsc_repeated.fetch_add(1, std::memory_order_relaxed);
+                return Result::SUCCESS;
+            }
+
+            return Result::ERROR_TIMEOUT;
+        }
+
+        int remaining_ms = (int)std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - now).count() + 1;
+
+        m_consumer_waiting.store(1, std::memory_order_release);
+        // Re-check after raising the flag to close the race with push
+        tail = m_ring_tail.load(std::memory_order_acquire);
+        if (tail == head) {
+            futexWait(m_ring_tail, tail, remaining_ms);
+            tail = m_ring_tail.load(std::memory_order_acquire);
+        }
+        m_consumer_waiting.store(0, std::memory_order_release);
+    }
+
+    BufferedFrame& buffered = m_ring[head];
+    frame = buffered.frame;
+
+    // Save as last frame for potential repeat (consumer-only state)
+    if (m_has_last_frame && m_last_frame.frame.data) {
+        core::FramePool::getInstance().release(m_last_frame.frame.data);
+    }
+
+    m_last_frame = buffered;
+    if (buffered.frame.isDriverOwned()) {
+        m_last_frame.frame.data = nullptr;
+        m_last_frame.frame.size = 0;
+        m_last_frame.frame.release_cb = nullptr;
+        m_last_frame.frame.release_opaque = nullptr;
+        m_has_last_frame = false;
+    } else {
+        if (buffered.frame.data && buffered.frame.size > 0) {
+            m_last_frame.frame.data = core::FramePool::getInstance().acquire(buffered.frame.size);
+            std::memcpy(m_last_frame.frame.data, buffered.frame.data, buffered.frame.size);
+        }
+        m_has_last_frame = true;
+    }
+
+    // Clear the slot before releasing it back to the producer
+    buffered.frame = VideoFrame{};
+    m_ring_head.store((head + 1) % ring_size, std::memory_order_release);
+
+    m_spsc_popped.fetch_add(1, std::memory_order_relaxed);
+
+    return Result::SUCCESS;
+}
+
 Result FrameBuffer::peek(VideoFrame& frame) const {
+    if (m_spsc) {
+        // Consumer-side only: the head slot is stable until we advance it
+        uint32_t head = m_ring_head.load(std::memory_order_relaxed);
+        if (m_ring_tail.load(std::memory_order_acquire) == head) {
+            return Result::ERROR_NOT_FOUND;
+        }
+        frame = m_ring[head].frame;
+        return Result::SUCCESS;
+    }
+
     std::lock_guard<std::mutex> lock(m_mutex);
 
     if (m_queue.empty()) {
@@ -167,43 +362,87 @@ Result FrameBuffer::peek(VideoFrame& frame) const {
 }
 
 Result FrameBuffer::getFrameByPTS(Timestamp target_pts, VideoFrame& frame, Duration tolerance) {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    // PTS is monotonic in capture order, so in both modes the nearest
+    // frame is found by binary search: locate the first frame at or past
+    // the target, then compare it against its predecessor
+
+    if (m_spsc) {
+        // Consumer-side search of published slots (producer only appends
+        // beyond the tail snapshot, so these slots are stable and no
+        // producer-visible lock is touched)
+        const uint32_t ring_size = (uint32_t)m_ring.size();
+        uint32_t head = m_ring_head.load(std::memory_order_relaxed);
+        uint32_t tail = m_ring_tail.load(std::memory_order_acquire);
+        uint32_t count = (tail + ring_size - head) % ring_size;
+        if (count == 0) {
+            return Result::ERROR_NOT_FOUND;
+        }
 
-    // Search queue for frame matching PTS within tolerance
-    std::queue<BufferedFrame> temp_queue;
-    BufferedFrame* found_frame = nullptr;
+        // Lower bound over logical indices [0, count)
+        uint32_t lo = 0;
+        uint32_t hi = count;
+        while (lo < hi) {
+            uint32_t mid = lo + (hi - lo) / 2;
+            if (m_ring[(head + mid) % ring_size].frame.pts < target_pts) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
 
-    while (!m_queue.empty()) {
-        BufferedFrame& buffered = m_queue.front();
+        // Candidate at lo, or its predecessor — whichever is closer
+        uint32_t best = (lo < count) ? lo : count - 1;
+        if (lo > 0 && lo < count) {
+            Duration after = m_ring[(head + lo) % ring_size].frame.pts - target_pts;
+            Duration before = target_pts - m_ring[(head + lo - 1) % ring_size].frame.pts;
+            if (before < after) {
+                best = lo - 1;
+            }
+        } else if (lo == count) {
+            best = count - 1;
+        }
 
+        const BufferedFrame& buffered = m_ring[(head + best) % ring_size];
         Duration diff = buffered.frame.pts > target_pts ?
                        buffered.frame.pts - target_pts :
                        target_pts - buffered.frame.pts;
-
         if (diff <= tolerance) {
-            // Found matching frame
             frame = buffered.frame;
-            found_frame = &buffered;
-
-            // Restore queue
-            temp_queue.push(buffered);
-            m_queue.pop();
-            break;
+            return Result::SUCCESS;
         }
+        return Result::ERROR_NOT_FOUND;
+    }
 
-        temp_queue.push(buffered);
-        m_queue.pop();
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_queue.empty()) {
+        return Result::ERROR_NOT_FOUND;
     }
 
-    // Restore remaining queue
-    while (!m_queue.empty()) {
-        temp_queue.push(m_queue.front());
-        m_queue.pop();
+    // Deque is indexable: lower-bound by PTS, then pick the closer of
+    // the bound and its predecessor. No queue rebuild, no copies
+    auto it = std::lower_bound(m_queue.begin(), m_queue.end(), target_pts,
+                               [](const BufferedFrame& b, Timestamp pts) {
+                                   return b.frame.pts < pts;
+                               });
+
+    if (it == m_queue.end()) {
+        --it;
+    } else if (it != m_queue.begin()) {
+        auto prev = std::prev(it);
+        Duration after = it->frame.pts - target_pts;
+        Duration before = target_pts - prev->frame.pts;
+        if (before < after) {
+            it = prev;
+        }
     }
 
-    m_queue = temp_queue;
+    Duration diff = it->frame.pts > target_pts ?
+                   it->frame.pts - target_pts :
+                   target_pts - it->frame.pts;
 
-    if (found_frame) {
+    if (diff <= tolerance) {
+        frame = it->frame;
         return Result::SUCCESS;
     }
 
@@ -211,30 +450,66 @@ Result FrameBuffer::getFrameByPTS(Timestamp target_pts, VideoFrame& frame, Durat
 }
 
 bool FrameBuffer::hasFrames() const {
+    if (m_spsc) {
+        return m_ring_tail.load(std::memory_order_acquire) !=
+               m_ring_head.load(std::memory_order_acquire);
+    }
     std::lock_guard<std::mutex> lock(m_mutex);
     return !m_queue.empty();
 }
 
 size_t FrameBuffer::size() const {
+    if (m_spsc) {
+        uint32_t head = m_ring_head.load(std::memory_order_acquire);
+        uint32_t tail = m_ring_tail.load(std::memory_order_acquire);
+        return (tail + m_ring.size() - head) % m_ring.size();
+    }
     std::lock_guard<std::mutex> lock(m_mutex);
     return m_queue.size();
 }
 
 void FrameBuffer::clear() {
+    if (m_spsc) {
+        // Consumer-side drain (must not race with an active producer)
+        uint32_t head = m_ring_head.load(std::memory_order_relaxed);
+        uint32_t tail = m_ring_tail.load(std::memory_order_acquire);
+        while (head != tail) {
+            BufferedFrame& buffered = m_ring[head];
+            if (buffered.frame.isDriverOwned()) {
+                buffered.frame.release();
+            } else if (buffered.frame.data) {
+                core::FramePool::getInstance().release(buffered.frame.data);
+            }
+            buffered.frame = VideoFrame{};
+            head = (head + 1) % (uint32_t)m_ring.size();
+        }
+        m_ring_head.store(head, std::memory_order_release);
+
+        if (m_has_last_frame && m_last_frame.frame.data) {
+            core::FramePool::getInstance().release(m_last_frame.frame.data);
+            m_has_last_frame = false;
+        }
+
+        LOG_INFO("FrameBuffer", "Cleared all frames");
+        return;
+    }
+
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    // Free all frame data
+    // Free all frame data (driver-owned frames drop their reference)
     while (!m_queue.empty()) {
         BufferedFrame& buffered = m_queue.front();
-        if (buffered.frame.data) {
-            delete[] buffered.frame.data;
+        if (buffered.frame.isDriverOwned()) {
+            buffered.frame.release();
+        } else if (buffered.frame.data) {
+            core::FramePool::getInstance().release(buffered.frame.data);
         }
-        m_queue.pop();
+        m_queue.pop_front();
     }
 
     // Free last frame
     if (m_has_last_frame && m_last_frame.frame.data) {
-        delete[] m_last_frame.frame.data;
+        core::FramePool::getInstance().release(m_last_frame.frame.data);
         m_has_last_frame = false;
     }
 
@@ -242,6 +517,23 @@ void FrameBuffer::clear() {
 }
 
 FrameBuffer::Stats FrameBuffer::getStats() const {
+    if (m_spsc) {
+        Stats stats;
+        stats.frames_pushed = m_spsc_pushed.load(std::memory_order_relaxed);
+        stats.frames_popped = m_spsc_popped.load(std::memory_order_relaxed);
+        stats.frames_dropped = m_spsc_dropped.load(std::memory_order_relaxed);
+        stats.frames_repeated = m_spsc_repeated.load(std::memory_order_relaxed);
+        stats.frames_late = m_spsc_late.load(std::memory_order_relaxed);
+
+        uint64_t total_ns = m_spsc_latency_total_ns.load(std::memory_order_relaxed);
+        if (stats.frames_pushed > 0) {
+            stats.avg_latency_ms = (double)total_ns / stats.frames_pushed / 1e6;
+        }
+        stats.max_latency_ms = (double)m_spsc_latency_max_ns.load(std::memory_order_relaxed) / 1e6;
+        stats.current_queue_size = size();
+        return stats;
+    }
+
     std::lock_guard<std::mutex> lock(m_stats_mutex);
     Stats stats = m_stats;
 
@@ -1,9 +1,10 @@
 #pragma once
 
 #include <ares/types.h>
+#include <atomic>
 #include <mutex>
 #include <vector>
-#include <queue>
+#include <deque>
 #include <condition_variable>
 
 namespace ares {
@@ -21,7 +22,13 @@ struct FrameTiming {
 
 class FrameBuffer {
 public:
-    explicit FrameBuffer(size_t capacity = 3);
+    // When spsc is set the buffer runs in lock-free single-producer/
+    // single-consumer mode: a fixed ring with atomic indices, futex wait
+    // only when empty, and no mutex on the push/pop hot path. Exactly one
+    // thread may push and exactly one may pop in this mode (capture
+    // callback -> main loop). The default mutex path remains for
+    // multi-consumer use.
+    explicit FrameBuffer(size_t capacity = 3, bool spsc = false);
     ~FrameBuffer();
 
     // Push frame into buffer (returns ERROR if full and drop_on_full is false)
@@ -33,7 +40,12 @@ public:
     // Peek at next frame without removing
     Result peek(VideoFrame& frame) const;
 
-    // Get frame by PTS (for jitter correction)
+    // Get frame by PTS (for jitter correction). Frames arrive in capture
+    // order, so PTS is monotonic across the buffer and the nearest frame
+    // is found by O(log n) binary search: over the published ring slots
+    // in SPSC mode (consumer-side, no lock touched by the producer), or
+    // over the deque under the mutex otherwise. Scales with the deeper
+    // buffers used for VRR/cadence work
     Result getFrameByPTS(Timestamp target_pts, VideoFrame& frame, Duration tolerance);
 
     // Check if frames are available
@@ -45,6 +57,9 @@ public:
     // Get buffer capacity
     size_t capacity() const { return m_capacity; }
 
+    // Check if buffer is in lock-free SPSC mode
+    bool isSPSC() const { return m_spsc; }
+
     // Clear all frames
     void clear();
 
@@ -68,7 +83,8 @@ private:
         FrameTiming timing;
     };
 
-    std::queue<BufferedFrame> m_queue;
+    // Deque rather than queue: getFrameByPTS binary-searches it by index
+    std::deque<BufferedFrame> m_queue;
     size_t m_capacity;
 
     mutable std::mutex m_mutex;
@@ -82,6 +98,27 @@ private:
     BufferedFrame m_last_frame;
     bool m_has_last_frame = false;
 
+    // Lock-free SPSC ring (one slot is kept empty to distinguish full
+    // from empty, so the ring holds m_capacity + 1 slots)
+    bool m_spsc = false;
+    std::vector<BufferedFrame> m_ring;
+    std::atomic<uint32_t> m_ring_head{0};        // Consumer index
+    std::atomic<uint32_t> m_ring_tail{0};        // Producer index
+    std::atomic<uint32_t> m_consumer_waiting{0}; // Producer wakes only if set
+
+    // SPSC statistics: single-writer relaxed counters so push/pop never
+    // touch m_stats_mutex; merged into Stats in getStats()
+    std::atomic<uint64_t> m_spsc_pushed{0};
+    std::atomic<uint64_t> m_spsc_popped{0};
+    std::atomic<uint64_t> m_spsc_dropped{0};
+    std::atomic<uint64_t> m_spsc_repeated{0};
+    std::atomic<uint64_t> m_spsc_late{0};
+    std::atomic<uint64_t> m_spsc_latency_total_ns{0};
+    std::atomic<uint64_t> m_spsc_latency_max_ns{0};
+
+    Result pushSPSC(const VideoFrame& frame, bool drop_on_full);
+    Result popSPSC(VideoFrame& frame, int timeout_ms);
+
     // Helper to update statistics
     void updateStats(const BufferedFrame& frame);
 };
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <ares/types.h>
+#include <string>
+#include <atomic>
+
+namespace ares {
+namespace capture {
+
+// Replays a raw frame recording (see FrameRecorder) through the same
+// getFrame/start/stop interface as DeckLinkCapture, so the whole pipeline
+// can run from a file on machines without a capture card. Frames are
+// paced at the recorded rate and the sequence loops at end of file.
+class FrameReplayer {
+public:
+    FrameReplayer();
+    ~FrameReplayer();
+
+    // `path` is the raw data file; "<path>.meta" must sit next to it
+    Result initialize(const std::string& path);
+    void shutdown();
+
+    Result start();
+    Result stop();
+
+    // Get next frame, paced to the recorded frame rate
+    Result getFrame(VideoFrame& frame, int timeout_ms = 100);
+
+    bool hasFrame() const;
+
+    // Statistics (same shape as DeckLinkCapture::Stats)
+    struct Stats {
+        uint64_t frames_captured = 0;
+        uint64_t frames_dropped = 0;
+        double current_fps = 0.0;
+        double detected_fps = 0.0;
+        bool frame_rate_stable = false;
+        uint32_t queue_size = 0;
+    };
+    Stats getStats() const;
+
+    double getDetectedFrameRate() const { return m_fps; }
+    bool isFrameRateStable() const { return m_initialized; }
+
+private:
+    static constexpr size_t READ_SLOTS = 4;
+
+    Result loadMeta(const std::string& meta_path);
+
+    std::string m_path;
+    int m_fd = -1;
+
+    // Recording geometry (from the meta sidecar)
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    PixelFormat m_format = PixelFormat::UNKNOWN;
+    size_t m_frame_size = 0;
+    size_t m_padded_size = 0;
+    uint64_t m_frame_count = 0;
+    double m_fps = 60.0;
+
+    // Read slots cycled per frame so a caller can still hold the previous
+    // frame's pointer while the next one is read
+    uint8_t* m_slots[READ_SLOTS] = {};
+    size_t m_slot_index = 0;
+
+    uint64_t m_next_frame = 0;
+    Timestamp m_next_deadline;
+
+    uint64_t m_frames_delivered = 0;
+
+    std::atomic<bool> m_initialized{false};
+    std::atomic<bool> m_running{false};
+};
+
+} // namespace capture
+} // namespace ares
@@ -0,0 +1,235 @@
+#include "test_pattern_source.h"
+#include "core/logger.h"
+
+#include <cmath>
+#include <cstring>
+#include <chrono>
+#include <thread>
+
+namespace ares {
+namespace capture {
+
+namespace {
+
+// SMPTE ST 2084 inverse EOTF: linear [0,1] (1.0 = 10000 nits) to PQ signal
+float linearToPQ(float linear) {
+    constexpr float m1 = 2610.0f / 16384.0f;
+    constexpr float m2 = 2523.0f / 4096.0f * 128.0f;
+    constexpr float c1 = 3424.0f / 4096.0f;
+    constexpr float c2 = 2413.0f / 4096.0f * 32.0f;
+    constexpr float c3 = 2392.0f / 4096.0f * 32.0f;
+
+    float ym1 = powf(linear, m1);
+    return powf((c1 + c2 * ym1) / (1.0f + c3 * ym1), m2);
+}
+
+// Normalized [0,1] signal to 10-bit limited-range luma code value
+uint16_t toLimited10(float value) {
+    if (value < 0.0f) value = 0.0f;
+    if (value > 1.0f) value = 1.0f;
+    return (uint16_t)(64.0f + value * 876.0f + 0.5f);
+}
+
+} // namespace
+
+TestPatternSource::TestPatternSource() = default;
+
+TestPatternSource::~TestPatternSource() {
+    shutdown();
+}
+
+Result TestPatternSource::initialize(const TestPatternConfig& config) {
+    if (m_initialized) {
+        return Result::SUCCESS;
+    }
+
+    if (config.width == 0 || config.height == 0 || config.frame_rate <= 0.0 ||
+        config.phases == 0) {
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
+    m_config = config;
+    if (m_config.pattern == TestPatternConfig::Pattern::PQ_RAMP) {
+        m_config.hdr = true;
+    }
+
+    // v210: 6 pixels per 16 bytes, rows padded to 128-byte groups
+    m_row_bytes = (size_t)((m_config.width + 47) / 48) * 128;
+    m_frame_size = m_row_bytes * m_config.height;
+
+    m_phase_frames.resize(m_config.phases);
+    for (uint32_t phase = 0; phase < m_config.phases; phase++) {
+        m_phase_frames[phase].resize(m_frame_size);
+        renderPhase(phase, m_phase_frames[phase].data());
+    }
+
+    m_initialized = true;
+    LOG_INFO("TestPattern", "Generated %u phases of %ux%u @ %.3f fps (%zu MB)",
+             m_config.phases, m_config.width, m_config.height,
+             m_config.frame_rate,
+             (m_frame_size * m_config.phases) >> 20);
+    return Result::SUCCESS;
+}
+
+void TestPatternSource::shutdown() {
+    m_running = false;
+    m_phase_frames.clear();
+    m_initialized = false;
+}
+
+Result TestPatternSource::start() {
+    if (!m_initialized) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+    m_frame_index = 0;
+    m_next_deadline = std::chrono::steady_clock::now();
+    m_running = true;
+    return Result::SUCCESS;
+}
+
+Result TestPatternSource::stop() {
+    m_running = false;
+    return Result::SUCCESS;
+}
+
+Result TestPatternSource::getFrame(VideoFrame& frame, int timeout_ms) {
+    if (!m_running) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+
+    if (!m_config.free_run) {
+        auto now = std::chrono::steady_clock::now();
+        if (m_next_deadline > now) {
+            auto wait = m_next_deadline - now;
+            if (wait > std::chrono::milliseconds(timeout_ms)) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+                return Result::ERROR_TIMEOUT;
+            }
+            std::this_thread::sleep_until(m_next_deadline);
+        }
+        m_next_deadline += std::chrono::microseconds(
+            (int64_t)(1e6 / m_config.frame_rate));
+    }
+
+    std::vector<uint8_t>& phase = m_phase_frames[m_frame_index % m_phase_frames.size()];
+
+    frame = VideoFrame();
+    frame.data = phase.data();
+    frame.size = m_frame_size;
+    frame.width = m_config.width;
+    frame.height = m_config.height;
+    frame.format = PixelFormat::YUV422_10BIT;
+    frame.pts = std::chrono::steady_clock::now();
+    if (m_config.hdr) {
+        frame.hdr_metadata.type = HDRType::HDR10;
+        frame.hdr_metadata.max_cll = (uint16_t)m_config.max_nits;
+    }
+
+    m_frame_index++;
+    m_frames_delivered++;
+    return Result::SUCCESS;
+}
+
+bool TestPatternSource::hasFrame() const {
+    if (!m_running) {
+        return false;
+    }
+    return m_config.free_run || std::chrono::steady_clock::now() >= m_next_deadline;
+}
+
+void TestPatternSource::renderPhase(uint32_t phase, uint8_t* buf) {
+    const uint32_t width = m_config.width;
+    const uint32_t height = m_config.height;
+    const float phase_frac = (float)phase / (float)m_config.phases;
+
+    std::vector<uint16_t> luma(width);
+
+    switch (m_config.pattern) {
+        case TestPatternConfig::Pattern::GRADIENT: {
+            // Separable: compute one scrolled ramp row, replicate it
+            for (uint32_t x = 0; x < width; x++) {
+                float v = (float)((x + (uint32_t)(phase_frac * width)) % width)
+                          / (float)(width - 1);
+                luma[x] = toLimited10(v);
+            }
+            std::vector<uint8_t> row(m_row_bytes);
+            packRowV210(luma.data(), row.data());
+            for (uint32_t y = 0; y < height; y++) {
+                memcpy(buf + (size_t)y * m_row_bytes, row.data(), m_row_bytes);
+            }
+            break;
+        }
+
+        case TestPatternConfig::Pattern::ZONE_PLATE: {
+            // Radial sine sweep centred on the frame; frequency rises
+            // towards the edges so every spatial frequency up to Nyquist
+            // is present
+            const float cx = width * 0.5f;
+            const float cy = height * 0.5f;
+            const float scale = (float)M_PI / (float)width;
+            const float phase_rad = phase_frac * 2.0f * (float)M_PI;
+            for (uint32_t y = 0; y < height; y++) {
+                const float dy = (float)y - cy;
+                for (uint32_t x = 0; x < width; x++) {
+                    const float dx = (float)x - cx;
+                    float v = 0.5f + 0.5f * sinf((dx * dx + dy * dy) * scale * 0.01f
+                                                 + phase_rad);
+                    luma[x] = toLimited10(v);
+                }
+                packRowV210(luma.data(), buf + (size_t)y * m_row_bytes);
+            }
+            break;
+        }
+
+        case TestPatternConfig::Pattern::PQ_RAMP: {
+            // Horizontal ramp of PQ code values from black to max_nits;
+            // separable like the gradient
+            const float peak_linear = m_config.max_nits / 10000.0f;
+            for (uint32_t x = 0; x < width; x++) {
+                float linear = peak_linear * (float)x / (float)(width - 1);
+                luma[x] = toLimited10(linearToPQ(linear));
+            }
+            std::vector<uint8_t> row(m_row_bytes);
+            packRowV210(luma.data(), row.data());
+            for (uint32_t y = 0; y < height; y++) {
+                memcpy(buf + (size_t)y * m_row_bytes, row.data(), m_row_bytes);
+            }
+            break;
+        }
+    }
+}
+
+void TestPatternSource::packRowV210(const uint16_t* luma, uint8_t* row) const {
+    // v210: 6 pixels packed into four 32-bit little-endian words, each
+    // holding three 10-bit components. Chroma stays neutral (512) so the
+    // patterns are pure luma.
+    constexpr uint32_t CHROMA_NEUTRAL = 512;
+    const uint32_t width = m_config.width;
+
+    uint32_t* words = (uint32_t*)row;
+    size_t word = 0;
+    for (uint32_t x = 0; x < width; x += 6) {
+        auto y_at = [&](uint32_t i) -> uint32_t {
+            uint32_t xi = x + i;
+            return xi < width ? luma[xi] : 64;
+        };
+        words[word++] = CHROMA_NEUTRAL | (y_at(0) << 10) | (CHROMA_NEUTRAL << 20);
+        words[word++] = y_at(1) | (CHROMA_NEUTRAL << 10) | (y_at(2) << 20);
+        words[word++] = CHROMA_NEUTRAL | (y_at(3) << 10) | (CHROMA_NEUTRAL << 20);
+        words[word++] = y_at(4) | (CHROMA_NEUTRAL << 10) | (y_at(5) << 20);
+    }
+    // Zero the 128-byte group padding
+    memset((uint8_t*)&words[word], 0, m_row_bytes - word * sizeof(uint32_t));
+}
+
+TestPatternSource::Stats TestPatternSource::getStats() const {
+    Stats stats;
+    stats.frames_captured = m_frames_delivered;
+    stats.current_fps = m_config.frame_rate;
+    stats.detected_fps = m_config.frame_rate;
+    stats.frame_rate_stable = m_initialized;
+    return stats;
+}
+
+} // namespace capture
+} // namespace ares
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <ares/types.h>
+#include <string>
+#include <vector>
+#include <atomic>
+
+namespace ares {
+namespace capture {
+
+// Configuration for the synthetic source
+struct TestPatternConfig {
+    enum class Pattern {
+        GRADIENT,       // Horizontal luma ramp, scrolled per phase
+        ZONE_PLATE,     // Radial sine sweep (resampler torture test)
+        PQ_RAMP         // HDR10 PQ code-value ramp, 0 to max_nits
+    };
+    Pattern pattern = Pattern::GRADIENT;
+
+    uint32_t width = 3840;
+    uint32_t height = 2160;
+    double frame_rate = 60.0;       // up to 8K60
+
+    bool hdr = true;                // tag frames HDR10 (PQ_RAMP implies it)
+    float max_nits = 1000.0f;       // PQ ramp peak
+
+    // Number of precomputed animation phases cycled during playback
+    uint32_t phases = 8;
+
+    // Disable pacing and hand out frames as fast as the caller asks
+    // (benchmark mode)
+    bool free_run = false;
+};
+
+// Software frame source behind the same getFrame/start/stop interface as
+// DeckLinkCapture, for test and benchmark runs on machines without a
+// capture card.
+//
+// All animation phases are rendered once at initialize() into v210
+// (YUV422_10BIT) buffers - the same wire format the DeckLink delivers -
+// so getFrame() is a pointer handoff with zero per-frame generation cost
+// and the source can saturate the pipeline even at 8K60.
+class TestPatternSource {
+public:
+    TestPatternSource();
+    ~TestPatternSource();
+
+    Result initialize(const TestPatternConfig& config);
+    void shutdown();
+
+    Result start();
+    Result stop();
+
+    // Get next frame, paced to the configured rate unless free_run is set
+    Result getFrame(VideoFrame& frame, int timeout_ms = 100);
+
+    bool hasFrame() const;
+
+    // Statistics (same shape as DeckLinkCapture::Stats)
+    struct Stats {
+        uint64_t frames_captured = 0;
+        uint64_t frames_dropped = 0;
+        double current_fps = 0.0;
+        double detected_fps = 0.0;
+        bool frame_rate_stable = false;
+        uint32_t queue_size = 0;
+    };
+    Stats getStats() const;
+
+    double getDetectedFrameRate() const { return m_config.frame_rate; }
+    bool isFrameRateStable() const { return m_initialized; }
+
+private:
+    void renderPhase(uint32_t phase, uint8_t* buf);
+    void packRowV210(const uint16_t* luma, uint8_t* row) const;
+
+    TestPatternConfig m_config;
+    size_t m_row_bytes = 0;
+    size_t m_frame_size = 0;
+
+    // Precomputed animation phases
+    std::vector<std::vector<uint8_t>> m_phase_frames;
+    uint64_t m_frame_index = 0;
+
+    Timestamp m_next_deadline;
+    uint64_t m_frames_delivered = 0;
+
+    std::atomic<bool> m_initialized{false};
+    std::atomic<bool> m_running{false};
+};
+
+} // namespace capture
+} // namespace ares
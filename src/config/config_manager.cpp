@@ -66,11 +66,22 @@ AresConfig ConfigManager::getDefaultConfig() {
     config.receiver.port = 60128;
     config.receiver.max_volume = 80;
 
+    // Realtime defaults (off: needs CAP_SYS_NICE)
+    config.realtime.enabled = false;
+    config.realtime.lock_memory = false;
+    config.realtime.main_priority = 10;
+    config.realtime.capture_priority = 20;
+    config.realtime.worker_priority = 8;
+    config.realtime.main_cpu = -1;
+    config.realtime.capture_cpu = -1;
+    config.realtime.worker_cpu = -1;
+
     // System defaults
     config.log_level = "INFO";
     config.log_to_file = true;
     config.log_file = "/var/log/ares/ares.log";
     config.thread_count = 4;
+    config.latency_trace = false;
 
     return config;
 }
@@ -105,6 +116,8 @@ Result ConfigManager::loadFromIni(const std::string& config_path, AresConfig& co
     config.capture.device_index = getIntValue(ini, "capture", "device_index", 0);
     config.capture.input_connection = getValue(ini, "capture", "input_connection", "HDMI");
     config.capture.buffer_size = getIntValue(ini, "capture", "buffer_size", 3);
+    config.capture.secondary_device_index = getIntValue(ini, "capture", "secondary_device_index", -1);
+    config.capture.active_source = getIntValue(ini, "capture", "active_source", 0);
 
     // Load tone mapping config
     std::string tm_algo = getValue(ini, "tone_mapping", "algorithm", "bt2390");
@@ -147,6 +160,21 @@ Result ConfigManager::loadFromIni(const std::string& config_path, AresConfig& co
     // Load chroma upscaling config
     config.processing.chroma_upscaling.enabled = getBoolValue(ini, "chroma", "enabled", true);
 
+    // Load picture-in-picture config (secondary capture input)
+    config.processing.pip.enabled = getBoolValue(ini, "pip", "enabled", false);
+    config.processing.pip.size = getFloatValue(ini, "pip", "size", 0.25f);
+    std::string pip_corner = getValue(ini, "pip", "corner", "top_right");
+    if (pip_corner == "top_left") config.processing.pip.corner = PiPConfig::Corner::TOP_LEFT;
+    else if (pip_corner == "top_right") config.processing.pip.corner = PiPConfig::Corner::TOP_RIGHT;
+    else if (pip_corner == "bottom_left") config.processing.pip.corner = PiPConfig::Corner::BOTTOM_LEFT;
+    else if (pip_corner == "bottom_right") config.processing.pip.corner = PiPConfig::Corner::BOTTOM_RIGHT;
+    config.processing.pip.margin = getIntValue(ini, "pip", "margin", 48);
+    config.processing.pip.frame_divisor = getIntValue(ini, "pip", "frame_divisor", 3);
+
+    // Load GPU device selection
+    config.processing.gpu_device_index = getIntValue(ini, "gpu", "device_index", -1);
+    config.processing.gpu_device_name = getValue(ini, "gpu", "device_name", "");
+
     // Load display config
     config.display.connector = getValue(ini, "display", "connector", "auto");
     config.display.card = getValue(ini, "display", "card", "/dev/dri/card0");
@@ -167,11 +195,27 @@ Result ConfigManager::loadFromIni(const std::string& config_path, AresConfig& co
     config.receiver.port = getIntValue(ini, "receiver", "port", 60128);
     config.receiver.max_volume = getIntValue(ini, "receiver", "max_volume", 80);
 
+    // Load preview tap config
+    config.preview.enabled = getBoolValue(ini, "preview", "enabled", false);
+    config.preview.port = getIntValue(ini, "preview", "port", 8089);
+    config.preview.width = getIntValue(ini, "preview", "width", 854);
+
+    // Load realtime config
+    config.realtime.enabled = getBoolValue(ini, "realtime", "enabled", false);
+    config.realtime.lock_memory = getBoolValue(ini, "realtime", "lock_memory", false);
+    config.realtime.main_priority = getIntValue(ini, "realtime", "main_priority", 10);
+    config.realtime.capture_priority = getIntValue(ini, "realtime", "capture_priority", 20);
+    config.realtime.worker_priority = getIntValue(ini, "realtime", "worker_priority", 8);
+    config.realtime.main_cpu = getIntValue(ini, "realtime", "main_cpu", -1);
+    config.realtime.capture_cpu = getIntValue(ini, "realtime", "capture_cpu", -1);
+    config.realtime.worker_cpu = getIntValue(ini, "realtime", "worker_cpu", -1);
+
     // Load system config
     config.log_level = getValue(ini, "system", "log_level", "INFO");
     config.log_to_file = getBoolValue(ini, "system", "log_to_file", true);
     config.log_file = getValue(ini, "system", "log_file", "/var/log/ares/ares.log");
     config.thread_count = getIntValue(ini, "system", "thread_count", 4);
+    config.latency_trace = getBoolValue(ini, "system", "latency_trace", false);
 
     m_loaded = true;
     LOG_INFO("Config", "Configuration loaded successfully");
@@ -198,7 +242,9 @@ Result ConfigManager::saveToIni(const std::string& config_path, const AresConfig
     file << "[capture]\n";
     file << "device_index = " << config.capture.device_index << "\n";
     file << "input_connection = " << config.capture.input_connection << "\n";
-    file << "buffer_size = " << config.capture.buffer_size << "\n\n";
+    file << "buffer_size = " << config.capture.buffer_size << "\n";
+    file << "secondary_device_index = " << config.capture.secondary_device_index << "\n";
+    file << "active_source = " << config.capture.active_source << "\n\n";
 
     // Tone mapping section
     file << "[tone_mapping]\n";
@@ -254,6 +300,26 @@ Result ConfigManager::saveToIni(const std::string& config_path, const AresConfig
     file << "[chroma]\n";
     file << "enabled = " << (config.processing.chroma_upscaling.enabled ? "true" : "false") << "\n\n";
 
+    // Picture-in-picture section
+    file << "[pip]\n";
+    file << "enabled = " << (config.processing.pip.enabled ? "true" : "false") << "\n";
+    file << "size = " << config.processing.pip.size << "\n";
+    file << "corner = ";
+    switch (config.processing.pip.corner) {
+        case PiPConfig::Corner::TOP_LEFT: file << "top_left"; break;
+        case PiPConfig::Corner::TOP_RIGHT: file << "top_right"; break;
+        case PiPConfig::Corner::BOTTOM_LEFT: file << "bottom_left"; break;
+        case PiPConfig::Corner::BOTTOM_RIGHT: file << "bottom_right"; break;
+    }
+    file << "\n";
+    file << "margin = " << config.processing.pip.margin << "\n";
+    file << "frame_divisor = " << config.processing.pip.frame_divisor << "\n\n";
+
+    // GPU section
+    file << "[gpu]\n";
+    file << "device_index = " << config.processing.gpu_device_index << "\n";
+    file << "device_name = " << config.processing.gpu_device_name << "\n\n";
+
     // Display section
     file << "[display]\n";
     file << "connector = " << config.display.connector << "\n";
@@ -277,12 +343,30 @@ Result ConfigManager::saveToIni(const std::string& config_path, const AresConfig
     file << "port = " << config.receiver.port << "\n";
     file << "max_volume = " << config.receiver.max_volume << "\n\n";
 
+    // Preview tap section
+    file << "[preview]\n";
+    file << "enabled = " << (config.preview.enabled ? "true" : "false") << "\n";
+    file << "port = " << config.preview.port << "\n";
+    file << "width = " << config.preview.width << "\n\n";
+
+    // Realtime section
+    file << "[realtime]\n";
+    file << "enabled = " << (config.realtime.enabled ? "true" : "false") << "\n";
+    file << "lock_memory = " << (config.realtime.lock_memory ? "true" : "false") << "\n";
+    file << "main_priority = " << config.realtime.main_priority << "\n";
+    file << "capture_priority = " << config.realtime.capture_priority << "\n";
+    file << "worker_priority = " << config.realtime.worker_priority << "\n";
+    file << "main_cpu = " << config.realtime.main_cpu << "\n";
+    file << "capture_cpu = " << config.realtime.capture_cpu << "\n";
+    file << "worker_cpu = " << config.realtime.worker_cpu << "\n\n";
+
     // System section
     file << "[system]\n";
     file << "log_level = " << config.log_level << "\n";
     file << "log_to_file = " << (config.log_to_file ? "true" : "false") << "\n";
     file << "log_file = " << config.log_file << "\n";
     file << "thread_count = " << config.thread_count << "\n";
+    file << "latency_trace = " << (config.latency_trace ? "true" : "false") << "\n";
 
     file.close();
     LOG_INFO("Config", "Configuration saved successfully");
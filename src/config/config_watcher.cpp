@@ -0,0 +1,234 @@
+#include "config_watcher.h"
+#include "config_manager.h"
+#include "core/logger.h"
+
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+namespace ares {
+namespace config {
+
+namespace {
+
+// Editors and `cp` replace the file via rename as often as they rewrite
+// it in place, so the watcher listens on the directory and matches the
+// basename against these events
+constexpr uint32_t WATCH_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+
+// A save often produces several events back to back (truncate + write +
+// close, or tmpfile + rename); wait for the burst to settle before
+// parsing so we never read a half-written file
+constexpr int DEBOUNCE_MS = 100;
+
+bool captureChanged(const CaptureConfig& a, const CaptureConfig& b) {
+    return a.device_index != b.device_index ||
+           a.input_connection != b.input_connection ||
+           a.buffer_size != b.buffer_size;
+}
+
+bool displayChanged(const DisplayConfig& a, const DisplayConfig& b) {
+    return a.connector != b.connector ||
+           a.card != b.card ||
+           a.auto_mode != b.auto_mode ||
+           a.mode.width != b.mode.width ||
+           a.mode.height != b.mode.height ||
+           a.mode.refresh_rate != b.mode.refresh_rate ||
+           a.buffer_count != b.buffer_count ||
+           a.hdr_output != b.hdr_output;
+}
+
+bool receiverConnChanged(const ReceiverConfig& a, const ReceiverConfig& b) {
+    return a.enabled != b.enabled ||
+           a.ip_address != b.ip_address ||
+           a.port != b.port;
+}
+
+} // namespace
+
+ConfigWatcher::ConfigWatcher() = default;
+
+ConfigWatcher::~ConfigWatcher() {
+    shutdown();
+}
+
+Result ConfigWatcher::initialize(const std::string& config_path) {
+    if (m_initialized) {
+        LOG_WARN("Config", "ConfigWatcher already initialized");
+        return Result::SUCCESS;
+    }
+
+    m_config_path = config_path;
+    size_t slash = config_path.find_last_of('/');
+    if (slash == std::string::npos) {
+        m_config_dir = ".";
+        m_config_name = config_path;
+    } else {
+        m_config_dir = config_path.substr(0, slash);
+        m_config_name = config_path.substr(slash + 1);
+    }
+
+    // Baseline: the config the rest of the system started with
+    ConfigManager manager;
+    Result result = manager.loadConfig(m_config_path, m_last_config);
+    if (result != Result::SUCCESS) {
+        LOG_ERROR("Config", "Cannot watch %s: initial load failed", config_path.c_str());
+        return result;
+    }
+
+    m_inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_inotify_fd < 0) {
+        LOG_ERROR("Config", "inotify_init1 failed: %s", strerror(errno));
+        return Result::ERROR_INITIALIZATION_FAILED;
+    }
+
+    m_watch_fd = inotify_add_watch(m_inotify_fd, m_config_dir.c_str(), WATCH_MASK);
+    if (m_watch_fd < 0) {
+        LOG_ERROR("Config", "inotify_add_watch(%s) failed: %s",
+                 m_config_dir.c_str(), strerror(errno));
+        close(m_inotify_fd);
+        m_inotify_fd = -1;
+        return Result::ERROR_INITIALIZATION_FAILED;
+    }
+
+    m_running = true;
+    m_thread = std::thread(&ConfigWatcher::watcherLoop, this);
+
+    m_initialized = true;
+    LOG_INFO("Config", "Watching %s for changes", config_path.c_str());
+    return Result::SUCCESS;
+}
+
+void ConfigWatcher::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    m_running = false;
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    if (m_watch_fd >= 0) {
+        inotify_rm_watch(m_inotify_fd, m_watch_fd);
+        m_watch_fd = -1;
+    }
+    if (m_inotify_fd >= 0) {
+        close(m_inotify_fd);
+        m_inotify_fd = -1;
+    }
+
+    m_initialized = false;
+    LOG_INFO("Config", "ConfigWatcher shut down");
+}
+
+bool ConfigWatcher::poll(AresConfig& config, uint32_t& changed) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_pending) {
+        return false;
+    }
+
+    config = m_pending_config;
+    changed = m_pending_changes;
+    m_pending = false;
+    m_pending_changes = 0;
+    return true;
+}
+
+void ConfigWatcher::watcherLoop() {
+    // Oversized for a directory watch; one read drains an event burst
+    char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+    while (m_running) {
+        struct pollfd pfd = {};
+        pfd.fd = m_inotify_fd;
+        pfd.events = POLLIN;
+
+        // Short timeout so shutdown is picked up promptly
+        int ret = ::poll(&pfd, 1, 200);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            LOG_ERROR("Config", "Config watcher poll failed: %s", strerror(errno));
+            return;
+        }
+        if (ret == 0) {
+            continue;
+        }
+
+        ssize_t len = read(m_inotify_fd, buf, sizeof(buf));
+        if (len <= 0) {
+            continue;
+        }
+
+        bool our_file = false;
+        for (ssize_t off = 0; off < len;) {
+            auto* event = reinterpret_cast<struct inotify_event*>(buf + off);
+            if (event->len > 0 && m_config_name == event->name) {
+                our_file = true;
+                m_stats.events_seen++;
+            }
+            off += sizeof(struct inotify_event) + event->len;
+        }
+
+        if (!our_file) {
+            continue;
+        }
+
+        // Let the save burst settle, then drain any events it produced
+        // so one save triggers one reload
+        std::this_thread::sleep_for(std::chrono::milliseconds(DEBOUNCE_MS));
+        while (read(m_inotify_fd, buf, sizeof(buf)) > 0) {
+        }
+
+        reloadConfig();
+    }
+}
+
+void ConfigWatcher::reloadConfig() {
+    ConfigManager manager;
+    AresConfig config;
+    Result result = manager.loadConfig(m_config_path, config);
+    if (result != Result::SUCCESS) {
+        // Keep running with the previous config; the user may be
+        // mid-edit and a later save will parse
+        LOG_WARN("Config", "Config reload failed, keeping previous settings");
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.reload_failures++;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    uint32_t changed = 0;
+    if (captureChanged(config.capture, m_last_config.capture)) {
+        changed |= CHANGED_CAPTURE;
+    }
+    if (displayChanged(config.display, m_last_config.display)) {
+        changed |= CHANGED_DISPLAY;
+    }
+    if (receiverConnChanged(config.receiver, m_last_config.receiver)) {
+        changed |= CHANGED_RECEIVER_CONN;
+    }
+
+    m_last_config = config;
+    m_pending_config = config;
+    // Accumulate flags if poll() hasn't collected the previous reload yet
+    m_pending_changes |= changed;
+    m_pending = true;
+    m_stats.reloads++;
+
+    LOG_INFO("Config", "Config file reloaded (topology flags: 0x%x)", changed);
+}
+
+ConfigWatcher::Stats ConfigWatcher::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+} // namespace config
+} // namespace ares
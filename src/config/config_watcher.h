@@ -0,0 +1,87 @@
+#pragma once
+
+#include <ares/types.h>
+#include <ares/ares_config.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ares {
+namespace config {
+
+// Watches the config file with inotify and reloads it in the background,
+// so settings changes apply without restarting Ares. The watcher thread
+// does all the file I/O and parsing; the main loop calls poll() once per
+// frame and, when a reload is pending, applies the new config through
+// the pipeline's snapshot mechanism — a struct copy between two frames,
+// no dropped frames. Changes to capture or display topology (device,
+// connector, mode) can't be applied live and are flagged so the caller
+// can log that a restart is needed.
+class ConfigWatcher {
+public:
+    // Sections whose changes cannot be applied without re-initializing
+    // the subsystem; everything else is hot-applied
+    enum ChangeFlags : uint32_t {
+        CHANGED_CAPTURE       = 1u << 0,  // device/connection/buffering
+        CHANGED_DISPLAY       = 1u << 1,  // connector/card/mode
+        CHANGED_RECEIVER_CONN = 1u << 2,  // receiver address/port
+    };
+
+    ConfigWatcher();
+    ~ConfigWatcher();
+
+    // Start watching config_path. The file's current content becomes the
+    // baseline for change detection
+    Result initialize(const std::string& config_path);
+
+    void shutdown();
+
+    bool isInitialized() const { return m_initialized; }
+
+    // Fetch a pending reload, if any. Returns true and fills `config`
+    // (full parsed file) and `changed` (topology flags, see ChangeFlags)
+    // when the watcher has picked up a modification since the last call.
+    // Non-blocking; meant to be called once per main-loop iteration
+    bool poll(AresConfig& config, uint32_t& changed);
+
+    struct Stats {
+        uint64_t reloads = 0;          // successful reloads published
+        uint64_t reload_failures = 0;  // unreadable/unparseable rewrites
+        uint64_t events_seen = 0;      // inotify events for our file
+    };
+
+    Stats getStats() const;
+
+private:
+    void watcherLoop();
+
+    // Reload the file and publish it for poll(); keeps the previous
+    // config on failure so a half-saved file never tears down settings
+    void reloadConfig();
+
+    std::string m_config_path;
+    std::string m_config_dir;
+    std::string m_config_name;
+
+    int m_inotify_fd = -1;
+    int m_watch_fd = -1;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running{false};
+
+    // Last config successfully loaded (baseline for topology diffing)
+    // and the pending reload handed to poll(), both guarded by m_mutex
+    mutable std::mutex m_mutex;
+    AresConfig m_last_config;
+    AresConfig m_pending_config;
+    uint32_t m_pending_changes = 0;
+    bool m_pending = false;
+
+    Stats m_stats;
+
+    bool m_initialized = false;
+};
+
+} // namespace config
+} // namespace ares
@@ -0,0 +1,303 @@
+#include "event_loop.h"
+#include "logger.h"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace ares {
+namespace core {
+
+namespace {
+// Batch size for epoll_wait; the loop only watches a handful of
+// low-rate fds so this never fills up
+constexpr int MAX_EVENTS = 16;
+} // namespace
+
+EventLoop::~EventLoop() {
+    shutdown();
+}
+
+Result EventLoop::initialize() {
+    if (m_initialized) {
+        return Result::SUCCESS;
+    }
+
+    m_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (m_epoll_fd < 0) {
+        LOG_ERROR("EventLoop", "Failed to create epoll instance: %s", strerror(errno));
+        return Result::ERROR_INITIALIZATION_FAILED;
+    }
+
+    // eventfd lets shutdown() interrupt a sleeping epoll_wait
+    m_wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_wake_fd < 0) {
+        LOG_ERROR("EventLoop", "Failed to create wake eventfd: %s", strerror(errno));
+        close(m_epoll_fd);
+        m_epoll_fd = -1;
+        return Result::ERROR_INITIALIZATION_FAILED;
+    }
+
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = m_wake_fd;
+    if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_wake_fd, &ev) != 0) {
+        LOG_ERROR("EventLoop", "Failed to register wake fd: %s", strerror(errno));
+        close(m_wake_fd);
+        close(m_epoll_fd);
+        m_wake_fd = -1;
+        m_epoll_fd = -1;
+        return Result::ERROR_INITIALIZATION_FAILED;
+    }
+
+    m_running = true;
+    m_thread = std::thread(&EventLoop::loopThread, this);
+    m_initialized = true;
+
+    LOG_INFO("EventLoop", "Event loop started");
+    return Result::SUCCESS;
+}
+
+void EventLoop::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    m_running = false;
+
+    // Kick the loop thread out of epoll_wait
+    uint64_t one = 1;
+    ssize_t written = write(m_wake_fd, &one, sizeof(one));
+    (void)written;
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_watches.clear();
+        m_tasks.clear();
+    }
+
+    for (int fd : m_timer_fds) {
+        close(fd);
+    }
+    m_timer_fds.clear();
+
+    close(m_wake_fd);
+    close(m_epoll_fd);
+    m_wake_fd = -1;
+    m_epoll_fd = -1;
+    m_initialized = false;
+
+    LOG_INFO("EventLoop", "Event loop stopped (%lu wakeups, %lu dispatches)",
+             (unsigned long)m_stats.wakeups, (unsigned long)m_stats.dispatches);
+}
+
+Result EventLoop::addFd(int fd, FdCallback callback) {
+    if (!m_initialized) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+    if (fd < 0 || !callback) {
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_watches.count(fd)) {
+            LOG_WARN("EventLoop", "fd %d is already watched", fd);
+            return Result::ERROR_BUSY;
+        }
+        Watch watch;
+        watch.fd_callback = std::move(callback);
+        m_watches[fd] = std::move(watch);
+        m_stats.fds_watched = m_watches.size();
+    }
+
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+        LOG_ERROR("EventLoop", "Failed to watch fd %d: %s", fd, strerror(errno));
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_watches.erase(fd);
+        m_stats.fds_watched = m_watches.size();
+        return Result::ERROR_GENERIC;
+    }
+
+    LOG_DEBUG("EventLoop", "Watching fd %d", fd);
+    return Result::SUCCESS;
+}
+
+Result EventLoop::removeFd(int fd) {
+    if (!m_initialized) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_watches.erase(fd) == 0) {
+            return Result::ERROR_NOT_FOUND;
+        }
+        m_stats.fds_watched = m_watches.size();
+    }
+
+    if (epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr) != 0) {
+        LOG_WARN("EventLoop", "Failed to unwatch fd %d: %s", fd, strerror(errno));
+    }
+    return Result::SUCCESS;
+}
+
+Result EventLoop::addTimer(int interval_ms, TimerCallback callback, int* timer_fd) {
+    if (!m_initialized) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+    if (interval_ms <= 0 || !callback) {
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
+    int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd < 0) {
+        LOG_ERROR("EventLoop", "Failed to create timerfd: %s", strerror(errno));
+        return Result::ERROR_GENERIC;
+    }
+
+    struct itimerspec spec = {};
+    spec.it_interval.tv_sec = interval_ms / 1000;
+    spec.it_interval.tv_nsec = (interval_ms % 1000) * 1000000L;
+    spec.it_value = spec.it_interval;
+    if (timerfd_settime(fd, 0, &spec, nullptr) != 0) {
+        LOG_ERROR("EventLoop", "Failed to arm timerfd: %s", strerror(errno));
+        close(fd);
+        return Result::ERROR_GENERIC;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Watch watch;
+        watch.timer_callback = std::move(callback);
+        watch.is_timer = true;
+        m_watches[fd] = std::move(watch);
+        m_timer_fds.push_back(fd);
+        m_stats.fds_watched = m_watches.size();
+    }
+
+    struct epoll_event ev = {};
+    ev.events = EPOLLIN;
+    ev.data.fd = fd;
+    if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+        LOG_ERROR("EventLoop", "Failed to watch timerfd: %s", strerror(errno));
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_watches.erase(fd);
+        m_stats.fds_watched = m_watches.size();
+        close(fd);
+        m_timer_fds.pop_back();
+        return Result::ERROR_GENERIC;
+    }
+
+    if (timer_fd) {
+        *timer_fd = fd;
+    }
+
+    LOG_DEBUG("EventLoop", "Added %d ms periodic timer (fd %d)", interval_ms, fd);
+    return Result::SUCCESS;
+}
+
+Result EventLoop::post(std::function<void()> task) {
+    if (!m_initialized) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+    if (!task) {
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+
+    uint64_t one = 1;
+    ssize_t written = write(m_wake_fd, &one, sizeof(one));
+    (void)written;
+    return Result::SUCCESS;
+}
+
+EventLoop::Stats EventLoop::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void EventLoop::loopThread() {
+    LOG_INFO("EventLoop", "Dispatch thread started");
+
+    struct epoll_event events[MAX_EVENTS];
+
+    while (m_running) {
+        // Block indefinitely: every registered source (and shutdown)
+        // wakes us through an fd, so no periodic timeout is needed
+        int n = epoll_wait(m_epoll_fd, events, MAX_EVENTS, -1);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            LOG_ERROR("EventLoop", "epoll_wait failed: %s", strerror(errno));
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stats.wakeups++;
+        }
+
+        for (int i = 0; i < n && m_running; i++) {
+            int fd = events[i].data.fd;
+
+            if (fd == m_wake_fd) {
+                uint64_t value;
+                while (read(m_wake_fd, &value, sizeof(value)) > 0) {}
+
+                // Run posted tasks on this thread
+                std::vector<std::function<void()>> tasks;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    tasks.swap(m_tasks);
+                    m_stats.dispatches += tasks.size();
+                }
+                for (auto& task : tasks) {
+                    task();
+                }
+                continue;
+            }
+
+            // Copy the callback out so a concurrent removeFd can't
+            // destroy it mid-call
+            Watch watch;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto it = m_watches.find(fd);
+                if (it == m_watches.end()) {
+                    continue;  // removed between wait and dispatch
+                }
+                watch = it->second;
+                m_stats.dispatches++;
+            }
+
+            if (watch.is_timer) {
+                // Consume the expiration count so the timerfd re-arms
+                uint64_t expirations;
+                while (read(fd, &expirations, sizeof(expirations)) > 0) {}
+                watch.timer_callback();
+            } else {
+                watch.fd_callback(fd, events[i].events);
+            }
+        }
+    }
+
+    LOG_INFO("EventLoop", "Dispatch thread stopped");
+}
+
+} // namespace core
+} // namespace ares
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <ares/types.h>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <map>
+#include <vector>
+
+namespace ares {
+namespace core {
+
+// Single-threaded epoll dispatcher for the low-rate file descriptors
+// (IR input device, eISCP receiver socket, DRM page-flip events).
+// Without it each of these sources needs its own blocking thread or a
+// per-frame poll; with it the steady-state process has exactly one
+// waking thread beside the frame path. Callbacks run on the loop
+// thread, so handlers must either be thread-safe or hand work off to
+// their owning thread.
+class EventLoop {
+public:
+    EventLoop() = default;
+    ~EventLoop();
+
+    // Called with the ready fd and the epoll event mask (EPOLLIN etc.)
+    using FdCallback = std::function<void(int fd, uint32_t events)>;
+
+    // Called on each expiry of a periodic timer
+    using TimerCallback = std::function<void()>;
+
+    // Create the epoll instance and start the dispatch thread
+    Result initialize();
+    void shutdown();
+
+    bool isInitialized() const { return m_initialized; }
+
+    // Watch an fd for readability (level-triggered). The fd stays owned
+    // by the caller; remove it before closing it.
+    Result addFd(int fd, FdCallback callback);
+    Result removeFd(int fd);
+
+    // Add a periodic timer (timerfd-backed, dispatched like any other
+    // fd). On success *timer_fd receives a handle the caller can pass
+    // to removeFd() to cancel the timer; the fd itself stays owned by
+    // the loop.
+    Result addTimer(int interval_ms, TimerCallback callback, int* timer_fd = nullptr);
+
+    // Run a one-shot task on the loop thread (non-blocking; wakes the
+    // loop through the eventfd). Used to serialize I/O like socket
+    // writes with the loop's read callbacks.
+    Result post(std::function<void()> task);
+
+    // Statistics
+    struct Stats {
+        uint64_t wakeups = 0;      // epoll_wait returns with events
+        uint64_t dispatches = 0;   // callbacks invoked
+        uint64_t fds_watched = 0;  // currently registered fds (incl. timers)
+    };
+
+    Stats getStats() const;
+
+private:
+    // Dispatch thread body
+    void loopThread();
+
+    struct Watch {
+        FdCallback fd_callback;
+        TimerCallback timer_callback;
+        bool is_timer = false;
+    };
+
+    int m_epoll_fd = -1;
+    int m_wake_fd = -1;  // eventfd used to interrupt epoll_wait on shutdown
+
+    std::thread m_thread;
+    std::atomic<bool> m_running{false};
+
+    // Guards m_watches (addFd/removeFd may be called from any thread)
+    mutable std::mutex m_mutex;
+    std::map<int, Watch> m_watches;
+    std::vector<int> m_timer_fds;  // timerfds we created and must close
+    std::vector<std::function<void()>> m_tasks;  // posted one-shot tasks
+
+    Stats m_stats;
+    bool m_initialized = false;
+};
+
+} // namespace core
+} // namespace ares
@@ -0,0 +1,187 @@
+#include "frame_pool.h"
+#include "logger.h"
+
+#include <sys/mman.h>
+
+namespace ares {
+namespace core {
+
+namespace {
+// x86-64 / aarch64 both use 2 MiB for the first huge page level
+constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+}
+
+FramePool& FramePool::getInstance() {
+    static FramePool instance;
+    return instance;
+}
+
+FramePool::~FramePool() {
+    shutdown();
+}
+
+Result FramePool::initialize(size_t slot_size, size_t slot_count, bool lock_memory) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_arena) {
+        LOG_WARN("Core", "FramePool already initialized");
+        return Result::SUCCESS;
+    }
+
+    if (slot_size == 0 || slot_count == 0) {
+        LOG_ERROR("Core", "Invalid frame pool dimensions");
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
+    m_slot_size = slot_size;
+    m_slot_count = slot_count;
+    m_arena_size = slot_size * slot_count;
+
+    // Round the mapping up to the huge page size so MAP_HUGETLB can succeed
+    // and THP can back the tail of the arena too
+    m_map_size = (m_arena_size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+
+    // Preferred: explicit 2 MiB huge pages (needs vm.nr_hugepages or
+    // hugetlb cgroup headroom; typically absent on an unconfigured box)
+    void* mapping = mmap(nullptr, m_map_size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (mapping != MAP_FAILED) {
+        m_backing = ArenaBacking::HUGETLB;
+    } else {
+        // Fallback: plain anonymous mapping, ask for transparent huge pages
+        mapping = mmap(nullptr, m_map_size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED) {
+            LOG_ERROR("Core", "Failed to allocate frame pool arena (%zu MB)",
+                      m_arena_size / (1024 * 1024));
+            m_map_size = 0;
+            return Result::ERROR_OUT_OF_MEMORY;
+        }
+
+        if (madvise(mapping, m_map_size, MADV_HUGEPAGE) == 0) {
+            m_backing = ArenaBacking::THP;
+        } else {
+            m_backing = ArenaBacking::MMAP;
+            LOG_WARN("Core", "No huge page backing for frame pool (MAP_HUGETLB and "
+                     "MADV_HUGEPAGE both refused), continuing with 4 KiB pages");
+        }
+    }
+
+    m_arena = static_cast<uint8_t*>(mapping);
+
+    // Lock the arena into RAM so frame buffers can't be paged out. This also
+    // pre-faults every page, which is what lets khugepaged collapse a
+    // THP-advised arena into 2 MiB pages before the first frame arrives.
+    if (lock_memory) {
+        if (mlock(m_arena, m_map_size) == 0) {
+            m_memory_locked = true;
+        } else {
+            LOG_WARN("Core", "mlock of frame pool failed (check RLIMIT_MEMLOCK), continuing unlocked");
+        }
+    }
+
+    // All slots start free
+    m_free_slots.reserve(slot_count);
+    for (size_t i = 0; i < slot_count; i++) {
+        m_free_slots.push_back(slot_count - 1 - i);
+    }
+
+    m_stats = Stats{};
+    m_stats.slot_size = slot_size;
+    m_stats.slot_count = slot_count;
+    m_stats.memory_locked = m_memory_locked;
+    m_stats.huge_pages = (m_backing != ArenaBacking::MMAP);
+
+    const char* backing_name = (m_backing == ArenaBacking::HUGETLB) ? "hugetlb"
+                             : (m_backing == ArenaBacking::THP) ? "thp" : "4k pages";
+    LOG_INFO("Core", "FramePool initialized: %zu slots x %zu MB (%zu MB total, %s, %s)",
+             slot_count, slot_size / (1024 * 1024), m_arena_size / (1024 * 1024),
+             m_memory_locked ? "locked" : "unlocked", backing_name);
+
+    return Result::SUCCESS;
+}
+
+void FramePool::shutdown() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_arena) {
+        return;
+    }
+
+    if (m_free_slots.size() != m_slot_count) {
+        LOG_WARN("Core", "FramePool shutdown with %zu slots still in use",
+                 m_slot_count - m_free_slots.size());
+    }
+
+    if (m_memory_locked) {
+        munlock(m_arena, m_map_size);
+        m_memory_locked = false;
+    }
+
+    munmap(m_arena, m_map_size);
+    m_arena = nullptr;
+    m_arena_size = 0;
+    m_map_size = 0;
+    m_slot_size = 0;
+    m_slot_count = 0;
+    m_free_slots.clear();
+
+    LOG_INFO("Core", "FramePool shut down");
+}
+
+uint8_t* FramePool::acquire(size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_arena && size <= m_slot_size && !m_free_slots.empty()) {
+            size_t slot = m_free_slots.back();
+            m_free_slots.pop_back();
+
+            m_stats.pool_acquires++;
+            m_stats.slots_in_use = m_slot_count - m_free_slots.size();
+            if (m_stats.slots_in_use > m_stats.peak_slots_in_use) {
+                m_stats.peak_slots_in_use = m_stats.slots_in_use;
+            }
+
+            return m_arena + slot * m_slot_size;
+        }
+
+        m_stats.heap_fallbacks++;
+    }
+
+    // Heap fallback (pool uninitialized, exhausted, or oversized request)
+    return new uint8_t[size];
+}
+
+void FramePool::release(uint8_t* buffer) {
+    if (!buffer) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_arena && buffer >= m_arena && buffer < m_arena + m_arena_size) {
+            size_t slot = (buffer - m_arena) / m_slot_size;
+            m_free_slots.push_back(slot);
+            m_stats.slots_in_use = m_slot_count - m_free_slots.size();
+            return;
+        }
+    }
+
+    // Heap fallback buffer
+    delete[] buffer;
+}
+
+bool FramePool::owns(const uint8_t* buffer) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_arena && buffer >= m_arena && buffer < m_arena + m_arena_size;
+}
+
+FramePool::Stats FramePool::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+} // namespace core
+} // namespace ares
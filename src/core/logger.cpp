@@ -1,6 +1,7 @@
 #include "logger.h"
 #include <cstdarg>
-#include <ctime>
+#include <cstring>
+#include <chrono>
 
 namespace ares {
 namespace core {
@@ -10,23 +11,160 @@ Logger& Logger::getInstance() {
     return instance;
 }
 
+Logger::~Logger() {
+    setAsync(false);
+}
+
 void Logger::setLevel(LogLevel level) {
     m_level = level;
 }
 
+void Logger::setAsync(bool enabled) {
+    if (enabled == m_async.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    if (enabled) {
+        // Initialize slot sequence numbers: slot i accepts ticket i
+        for (uint32_t i = 0; i < RING_SIZE; i++) {
+            m_ring[i].seq.store(i, std::memory_order_relaxed);
+        }
+        m_enqueue_pos.store(0, std::memory_order_relaxed);
+        m_dequeue_pos = 0;
+        m_flush_stop.store(false, std::memory_order_relaxed);
+        m_flush_thread = std::thread(&Logger::flushLoop, this);
+        m_async.store(true, std::memory_order_release);
+    } else {
+        // Route new messages back to the synchronous path, then drain
+        m_async.store(false, std::memory_order_release);
+        m_flush_stop.store(true, std::memory_order_release);
+        if (m_flush_thread.joinable()) {
+            m_flush_thread.join();
+        }
+    }
+}
+
 void Logger::log(LogLevel level, const char* module, const char* format, ...) {
     if (level < m_level) {
         return;
     }
 
-    // Get timestamp
-    time_t now = time(nullptr);
+    // Format into a fixed-size record on the caller's stack. Truncation
+    // of oversized messages is acceptable for the frame path.
+    Record record;
+    record.level = level;
+    record.timestamp = time(nullptr);
+    strncpy(record.module, module, sizeof(record.module) - 1);
+    record.module[sizeof(record.module) - 1] = '\0';
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf(record.text, sizeof(record.text), format, args);
+    va_end(args);
+
+    if (m_async.load(std::memory_order_acquire)) {
+        // The only shared-state work is the ring reservation; a full
+        // ring counts a drop instead of blocking the caller
+        if (!tryEnqueue(record)) {
+            m_records_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
+
+    // Synchronous path (default): write and flush inline
+    writeRecord(record);
+    fflush(stderr);
+}
+
+bool Logger::tryEnqueue(const Record& record) {
+    uint32_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+
+    for (;;) {
+        Slot& slot = m_ring[pos & RING_MASK];
+        uint32_t seq = slot.seq.load(std::memory_order_acquire);
+        int32_t diff = (int32_t)(seq - pos);
+
+        if (diff == 0) {
+            // Slot is free for this ticket: claim it
+            if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                                    std::memory_order_relaxed)) {
+                slot.record = record;
+                slot.seq.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+            // CAS failed: pos was reloaded, retry
+        } else if (diff < 0) {
+            // Consumer hasn't freed this slot yet: ring is full
+            return false;
+        } else {
+            // Another producer claimed this ticket: reload and retry
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool Logger::tryDequeue(Record& record) {
+    Slot& slot = m_ring[m_dequeue_pos & RING_MASK];
+    uint32_t seq = slot.seq.load(std::memory_order_acquire);
+
+    if ((int32_t)(seq - (m_dequeue_pos + 1)) < 0) {
+        return false;  // producer hasn't published this slot yet
+    }
+
+    record = slot.record;
+    slot.seq.store(m_dequeue_pos + RING_SIZE, std::memory_order_release);
+    m_dequeue_pos++;
+    return true;
+}
+
+void Logger::flushLoop() {
+    Record record;
+
+    for (;;) {
+        bool wrote = false;
+        while (tryDequeue(record)) {
+            writeRecord(record);
+            m_records_written.fetch_add(1, std::memory_order_relaxed);
+            wrote = true;
+        }
+
+        if (wrote) {
+            // One flush per batch instead of per message
+            fflush(stderr);
+        }
+
+        // Report overflow out-of-band so drops are visible even though
+        // the dropped records themselves are gone
+        uint64_t dropped = m_records_dropped.load(std::memory_order_relaxed);
+        if (dropped != m_dropped_reported) {
+            fprintf(stderr, "[Logger] %llu log records dropped (ring full)\n",
+                    (unsigned long long)(dropped - m_dropped_reported));
+            fflush(stderr);
+            m_dropped_reported = dropped;
+        }
+
+        if (m_flush_stop.load(std::memory_order_acquire)) {
+            // Final drain: producers were routed back to the synchronous
+            // path before m_flush_stop was set
+            while (tryDequeue(record)) {
+                writeRecord(record);
+                m_records_written.fetch_add(1, std::memory_order_relaxed);
+            }
+            fflush(stderr);
+            return;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void Logger::writeRecord(const Record& record) {
     char timestamp[32];
-    strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", localtime(&now));
+    strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S",
+             localtime(&record.timestamp));
 
-    // Level string
     const char* level_str;
-    switch (level) {
+    switch (record.level) {
         case LogLevel::DEBUG: level_str = "DEBUG"; break;
         case LogLevel::INFO:  level_str = "INFO "; break;
         case LogLevel::WARN:  level_str = "WARN "; break;
@@ -34,17 +172,15 @@ void Logger::log(LogLevel level, const char* module, const char* format, ...) {
         default: level_str = "?????"; break;
     }
 
-    // Print prefix
-    fprintf(stderr, "[%s] [%s] [%s] ", timestamp, level_str, module);
-
-    // Print message
-    va_list args;
-    va_start(args, format);
-    vfprintf(stderr, format, args);
-    va_end(args);
+    fprintf(stderr, "[%s] [%s] [%s] %s\n",
+            timestamp, level_str, record.module, record.text);
+}
 
-    fprintf(stderr, "\n");
-    fflush(stderr);
+Logger::Stats Logger::getStats() const {
+    Stats stats;
+    stats.records_written = m_records_written.load(std::memory_order_relaxed);
+    stats.records_dropped = m_records_dropped.load(std::memory_order_relaxed);
+    return stats;
 }
 
 } // namespace core
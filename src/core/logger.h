@@ -2,6 +2,10 @@
 
 #include <string>
 #include <cstdio>
+#include <cstdint>
+#include <ctime>
+#include <atomic>
+#include <thread>
 
 namespace ares {
 namespace core {
@@ -20,9 +24,62 @@ public:
     void setLevel(LogLevel level);
     void log(LogLevel level, const char* module, const char* format, ...);
 
+    // Async mode: producers format into a fixed-size record and push it
+    // onto a lock-free MPSC ring; a background thread does the stderr
+    // write/flush. When the ring is full records are counted as dropped
+    // instead of blocking, so the frame path never stalls on I/O.
+    void setAsync(bool enabled);
+    bool isAsync() const { return m_async.load(std::memory_order_relaxed); }
+
+    // Statistics
+    struct Stats {
+        uint64_t records_written = 0;
+        uint64_t records_dropped = 0;
+    };
+
+    Stats getStats() const;
+
 private:
     Logger() = default;
+    ~Logger();
+
+    // Fixed-size log record stored in the ring
+    struct Record {
+        LogLevel level;
+        time_t timestamp;
+        char module[24];
+        char text[200];
+    };
+
+    // Ring slot with a sequence number (bounded MPMC scheme, used here
+    // as MPSC: many logging threads, one flush thread)
+    struct Slot {
+        std::atomic<uint32_t> seq;
+        Record record;
+    };
+
+    static constexpr uint32_t RING_SIZE = 1024;  // power of two
+    static constexpr uint32_t RING_MASK = RING_SIZE - 1;
+
+    bool tryEnqueue(const Record& record);
+    bool tryDequeue(Record& record);
+    void flushLoop();
+    void writeRecord(const Record& record);
+
     LogLevel m_level = LogLevel::INFO;
+
+    // Async backend
+    Slot m_ring[RING_SIZE];
+    std::atomic<uint32_t> m_enqueue_pos{0};
+    uint32_t m_dequeue_pos = 0;              // flush thread only
+    std::atomic<bool> m_async{false};
+    std::atomic<bool> m_flush_stop{false};
+    std::thread m_flush_thread;
+
+    // Statistics
+    std::atomic<uint64_t> m_records_written{0};
+    std::atomic<uint64_t> m_records_dropped{0};
+    uint64_t m_dropped_reported = 0;         // flush thread only
 };
 
 // Helper macros
@@ -0,0 +1,224 @@
+#include "metrics_exporter.h"
+#include "logger.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <new>
+
+namespace ares {
+namespace core {
+
+MetricsExporter::MetricsExporter() = default;
+
+MetricsExporter::~MetricsExporter() {
+    shutdown();
+}
+
+Result MetricsExporter::initialize(const std::string& shm_name,
+                                   const std::string& prom_path) {
+    if (m_initialized) {
+        return Result::SUCCESS;
+    }
+
+    m_shm_name = shm_name;
+    m_prom_path = prom_path;
+
+    m_shm_fd = shm_open(m_shm_name.c_str(), O_CREAT | O_RDWR, 0644);
+    if (m_shm_fd < 0) {
+        LOG_ERROR("Metrics", "Failed to create shared memory %s: %s",
+                  m_shm_name.c_str(), strerror(errno));
+        return Result::ERROR_INITIALIZATION_FAILED;
+    }
+
+    if (ftruncate(m_shm_fd, sizeof(SharedMetrics)) != 0) {
+        LOG_ERROR("Metrics", "Failed to size shared memory: %s", strerror(errno));
+        close(m_shm_fd);
+        m_shm_fd = -1;
+        return Result::ERROR_INITIALIZATION_FAILED;
+    }
+
+    void* mapped = mmap(nullptr, sizeof(SharedMetrics),
+                        PROT_READ | PROT_WRITE, MAP_SHARED, m_shm_fd, 0);
+    if (mapped == MAP_FAILED) {
+        LOG_ERROR("Metrics", "Failed to map shared memory: %s", strerror(errno));
+        close(m_shm_fd);
+        m_shm_fd = -1;
+        return Result::ERROR_INITIALIZATION_FAILED;
+    }
+
+    m_shared = new (mapped) SharedMetrics();
+    m_shared->magic = SHM_MAGIC;
+    m_shared->version = SHM_VERSION;
+    m_shared->seq.store(0, std::memory_order_relaxed);
+    m_shared->data = MetricsSnapshot();
+
+    m_stop = false;
+    m_export_thread = std::thread(&MetricsExporter::exportLoop, this);
+
+    m_initialized = true;
+    LOG_INFO("Metrics", "Exporter initialized (shm %s, textfile %s)",
+             m_shm_name.c_str(), m_prom_path.c_str());
+    return Result::SUCCESS;
+}
+
+void MetricsExporter::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_export_mutex);
+        m_stop = true;
+    }
+    m_export_cv.notify_all();
+    if (m_export_thread.joinable()) {
+        m_export_thread.join();
+    }
+
+    munmap((void*)m_shared, sizeof(SharedMetrics));
+    m_shared = nullptr;
+    close(m_shm_fd);
+    m_shm_fd = -1;
+    shm_unlink(m_shm_name.c_str());
+
+    m_initialized = false;
+    LOG_INFO("Metrics", "Exporter shut down");
+}
+
+void MetricsExporter::publish(const MetricsSnapshot& snapshot) {
+    if (!m_shared) {
+        return;
+    }
+
+    // Seqlock write: odd sequence marks the copy in progress. Single
+    // writer, so a plain increment is enough; the fences keep the data
+    // copy between the two sequence stores.
+    uint32_t seq = m_shared->seq.load(std::memory_order_relaxed);
+    m_shared->seq.store(seq + 1, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_shared->data = snapshot;
+    std::atomic_thread_fence(std::memory_order_release);
+    m_shared->seq.store(seq + 2, std::memory_order_release);
+}
+
+bool MetricsExporter::readSnapshot(MetricsSnapshot& out) const {
+    if (!m_shared) {
+        return false;
+    }
+
+    for (int attempt = 0; attempt < 16; attempt++) {
+        uint32_t before = m_shared->seq.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;  // write in progress
+        }
+        out = m_shared->data;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint32_t after = m_shared->seq.load(std::memory_order_acquire);
+        if (before == after) {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t MetricsExporter::renderPrometheus(const MetricsSnapshot& s,
+                                         char* buf, size_t buf_size) {
+    int written = snprintf(buf, buf_size,
+        "# TYPE ares_frames_captured_total counter\n"
+        "ares_frames_captured_total %llu\n"
+        "# TYPE ares_frames_dropped_total counter\n"
+        "ares_frames_dropped_total %llu\n"
+        "# TYPE ares_capture_fps gauge\n"
+        "ares_capture_fps %.3f\n"
+        "# TYPE ares_frames_processed_total counter\n"
+        "ares_frames_processed_total %llu\n"
+        "# TYPE ares_frame_time_ms gauge\n"
+        "ares_frame_time_ms %.3f\n"
+        "# TYPE ares_tone_map_time_ms gauge\n"
+        "ares_tone_map_time_ms %.3f\n"
+        "# TYPE ares_frames_presented_total counter\n"
+        "ares_frames_presented_total %llu\n"
+        "# TYPE ares_missed_vblanks_total counter\n"
+        "ares_missed_vblanks_total %llu\n"
+        "# TYPE ares_mode_switches_total counter\n"
+        "ares_mode_switches_total %llu\n"
+        "# TYPE ares_source_fps gauge\n"
+        "ares_source_fps %.3f\n"
+        "# TYPE ares_display_refresh_hz gauge\n"
+        "ares_display_refresh_hz %.3f\n"
+        "# TYPE ares_log_records_dropped_total counter\n"
+        "ares_log_records_dropped_total %llu\n"
+        "# TYPE ares_uptime_seconds gauge\n"
+        "ares_uptime_seconds %.1f\n",
+        (unsigned long long)s.frames_captured,
+        (unsigned long long)s.frames_dropped,
+        s.capture_fps,
+        (unsigned long long)s.frames_processed,
+        s.frame_time_ms,
+        s.tone_map_time_ms,
+        (unsigned long long)s.frames_presented,
+        (unsigned long long)s.missed_vblanks,
+        (unsigned long long)s.mode_switches,
+        s.source_fps,
+        s.display_refresh_hz,
+        (unsigned long long)s.log_records_dropped,
+        s.uptime_seconds);
+
+    if (written < 0 || (size_t)written >= buf_size) {
+        return 0;
+    }
+    return (size_t)written;
+}
+
+void MetricsExporter::exportLoop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_export_mutex);
+            m_export_cv.wait_for(lock, std::chrono::seconds(5),
+                                 [this] { return m_stop; });
+            if (m_stop) {
+                return;
+            }
+        }
+        writePrometheusFile();
+    }
+}
+
+void MetricsExporter::writePrometheusFile() {
+    MetricsSnapshot snapshot;
+    if (!readSnapshot(snapshot)) {
+        return;
+    }
+
+    char buf[4096];
+    size_t len = renderPrometheus(snapshot, buf, sizeof(buf));
+    if (len == 0) {
+        return;
+    }
+
+    // Write to a temp file and rename so scrapers never see a partial file
+    std::string tmp_path = m_prom_path + ".tmp";
+    FILE* f = fopen(tmp_path.c_str(), "w");
+    if (!f) {
+        // Directory may not exist (e.g. /run/ares without the tmpfiles
+        // rule); keep this at debug level so it cannot spam the log
+        LOG_DEBUG("Metrics", "Failed to open %s: %s",
+                  tmp_path.c_str(), strerror(errno));
+        return;
+    }
+    fwrite(buf, 1, len, f);
+    fclose(f);
+
+    if (rename(tmp_path.c_str(), m_prom_path.c_str()) != 0) {
+        LOG_DEBUG("Metrics", "Failed to rename %s: %s",
+                  tmp_path.c_str(), strerror(errno));
+    }
+}
+
+} // namespace core
+} // namespace ares
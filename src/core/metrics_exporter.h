@@ -0,0 +1,104 @@
+#pragma once
+
+#include "ares/types.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace ares {
+namespace core {
+
+// Flat snapshot of the per-module Stats structs. Plain PODs only so the
+// struct can live in a shared-memory segment and be read by external
+// tools without pulling in module headers.
+struct MetricsSnapshot {
+    // Capture
+    uint64_t frames_captured = 0;
+    uint64_t frames_dropped = 0;
+    double capture_fps = 0.0;
+
+    // Processing pipeline
+    uint64_t frames_processed = 0;
+    double frame_time_ms = 0.0;
+    double tone_map_time_ms = 0.0;
+
+    // Display / frame rate matching
+    uint64_t frames_presented = 0;
+    uint64_t missed_vblanks = 0;
+    uint64_t mode_switches = 0;
+    double source_fps = 0.0;
+    double display_refresh_hz = 0.0;
+
+    // Logging
+    uint64_t log_records_dropped = 0;
+
+    double uptime_seconds = 0.0;
+};
+
+// Publishes metrics without ever blocking the frame path.
+//
+// The snapshot lives in a POSIX shared-memory segment guarded by a
+// seqlock: publish() bumps the sequence to odd, copies the struct and
+// bumps it to even, so the single writer is wait-free and readers
+// (in-process or external scrapers mapping the segment) retry until
+// they observe a stable even sequence. A background thread additionally
+// renders the snapshot in Prometheus text format to a file suitable for
+// the node_exporter textfile collector.
+class MetricsExporter {
+public:
+    MetricsExporter();
+    ~MetricsExporter();
+
+    Result initialize(const std::string& shm_name = "/ares-metrics",
+                      const std::string& prom_path = "/run/ares/metrics.prom");
+    void shutdown();
+
+    // Wait-free; called from the frame loop
+    void publish(const MetricsSnapshot& snapshot);
+
+    // Seqlock read of the shared segment; returns false if no stable
+    // snapshot could be observed
+    bool readSnapshot(MetricsSnapshot& out) const;
+
+    // Render a snapshot in Prometheus exposition format.
+    // Returns the number of bytes written (excluding the terminator).
+    static size_t renderPrometheus(const MetricsSnapshot& snapshot,
+                                   char* buf, size_t buf_size);
+
+    bool isInitialized() const { return m_initialized; }
+
+private:
+    // Layout of the shared-memory segment
+    struct SharedMetrics {
+        uint32_t magic;                 // 'ARES'
+        uint32_t version;
+        std::atomic<uint32_t> seq;      // odd while a write is in progress
+        MetricsSnapshot data;
+    };
+
+    static constexpr uint32_t SHM_MAGIC = 0x41524553;  // "ARES"
+    static constexpr uint32_t SHM_VERSION = 1;
+
+    void exportLoop();
+    void writePrometheusFile();
+
+    std::string m_shm_name;
+    std::string m_prom_path;
+    int m_shm_fd = -1;
+    SharedMetrics* m_shared = nullptr;
+
+    // Prometheus textfile writer
+    std::thread m_export_thread;
+    std::mutex m_export_mutex;
+    std::condition_variable m_export_cv;
+    bool m_stop = false;
+
+    bool m_initialized = false;
+};
+
+} // namespace core
+} // namespace ares
@@ -0,0 +1,393 @@
+#include "pixel_convert.h"
+#include "logger.h"
+
+#include <mutex>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace ares {
+namespace core {
+namespace pixel {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Scalar reference kernels
+// ---------------------------------------------------------------------------
+
+// One v210 group: four little-endian dwords carrying six pixels
+//   w0 = Cb0 | Y0<<10 | Cr0<<20
+//   w1 = Y1  | Cb1<<10 | Y2<<20
+//   w2 = Cr1 | Y3<<10 | Cb2<<20
+//   w3 = Y4  | Cr2<<10 | Y5<<20
+void unpackV210RowScalar(const uint32_t* words, uint16_t* y, uint16_t* cb,
+                         uint16_t* cr, uint32_t width) {
+    uint32_t x = 0;
+    while (x + 6 <= width) {
+        uint32_t w0 = words[0], w1 = words[1], w2 = words[2], w3 = words[3];
+        cb[0] = w0 & 0x3FF;  y[0] = (w0 >> 10) & 0x3FF;  cr[0] = (w0 >> 20) & 0x3FF;
+        y[1] = w1 & 0x3FF;   cb[1] = (w1 >> 10) & 0x3FF; y[2] = (w1 >> 20) & 0x3FF;
+        cr[1] = w2 & 0x3FF;  y[3] = (w2 >> 10) & 0x3FF;  cb[2] = (w2 >> 20) & 0x3FF;
+        y[4] = w3 & 0x3FF;   cr[2] = (w3 >> 10) & 0x3FF; y[5] = (w3 >> 20) & 0x3FF;
+        words += 4;
+        y += 6;
+        cb += 3;
+        cr += 3;
+        x += 6;
+    }
+
+    // Tail group (width not a multiple of 6)
+    if (x < width) {
+        uint32_t w0 = words[0], w1 = words[1], w2 = words[2], w3 = words[3];
+        uint16_t ty[6], tcb[3], tcr[3];
+        tcb[0] = w0 & 0x3FF;  ty[0] = (w0 >> 10) & 0x3FF;  tcr[0] = (w0 >> 20) & 0x3FF;
+        ty[1] = w1 & 0x3FF;   tcb[1] = (w1 >> 10) & 0x3FF; ty[2] = (w1 >> 20) & 0x3FF;
+        tcr[1] = w2 & 0x3FF;  ty[3] = (w2 >> 10) & 0x3FF;  tcb[2] = (w2 >> 20) & 0x3FF;
+        ty[4] = w3 & 0x3FF;   tcr[2] = (w3 >> 10) & 0x3FF; ty[5] = (w3 >> 20) & 0x3FF;
+        for (uint32_t i = 0; x + i < width; i++) {
+            y[i] = ty[i];
+            if ((i & 1) == 0) {
+                cb[i / 2] = tcb[i / 2];
+                cr[i / 2] = tcr[i / 2];
+            }
+        }
+    }
+}
+
+void unpackV210Scalar(const uint8_t* src, size_t src_pitch,
+                      uint16_t* dst_y, uint16_t* dst_cb, uint16_t* dst_cr,
+                      uint32_t width, uint32_t height) {
+    for (uint32_t row = 0; row < height; row++) {
+        unpackV210RowScalar((const uint32_t*)(src + row * src_pitch),
+                            dst_y + (size_t)row * width,
+                            dst_cb + (size_t)row * (width / 2),
+                            dst_cr + (size_t)row * (width / 2), width);
+    }
+}
+
+inline uint8_t clamp8(int v) {
+    if (v < 0) return 0;
+    if (v > 255) return 255;
+    return (uint8_t)v;
+}
+
+// BT.709 limited-range integer coefficients
+inline void yuvToRGB709(int y, int u, int v, uint8_t* rgb) {
+    int c = y - 16;
+    int d = u - 128;
+    int e = v - 128;
+    rgb[0] = clamp8((298 * c + 459 * e + 128) >> 8);
+    rgb[1] = clamp8((298 * c - 55 * d - 136 * e + 128) >> 8);
+    rgb[2] = clamp8((298 * c + 541 * d + 128) >> 8);
+}
+
+void convertUYVYScalar(const uint8_t* src, size_t src_pitch,
+                       uint8_t* dst, size_t dst_pitch,
+                       uint32_t width, uint32_t height) {
+    for (uint32_t row = 0; row < height; row++) {
+        const uint8_t* s = src + row * src_pitch;
+        uint8_t* d = dst + row * dst_pitch;
+        for (uint32_t x = 0; x + 2 <= width; x += 2) {
+            int u = s[0], y0 = s[1], v = s[2], y1 = s[3];
+            yuvToRGB709(y0, u, v, d);
+            yuvToRGB709(y1, u, v, d + 3);
+            s += 4;
+            d += 6;
+        }
+    }
+}
+
+// Software float -> IEEE half (round to nearest even not needed for a
+// 10-bit source: all values are exactly representable)
+inline uint16_t floatToHalf(float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000;
+    int32_t exp = (int32_t)((bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t mant = bits & 0x7FFFFF;
+    if (exp <= 0) {
+        return (uint16_t)sign;  // flush denormals (input is >= 1/1023 or 0)
+    }
+    if (exp >= 31) {
+        return (uint16_t)(sign | 0x7C00);
+    }
+    return (uint16_t)(sign | (exp << 10) | (mant >> 13));
+}
+
+void expand10To16fScalar(const uint16_t* src, uint16_t* dst_half, size_t count) {
+    constexpr float scale = 1.0f / 1023.0f;
+    for (size_t i = 0; i < count; i++) {
+        dst_half[i] = floatToHalf((float)(src[i] & 0x3FF) * scale);
+    }
+}
+
+#if defined(__x86_64__)
+
+// ---------------------------------------------------------------------------
+// AVX2 kernels
+// ---------------------------------------------------------------------------
+
+// The mask/shift work (three extractions per dword) is vectorized; the
+// plane scatter runs from pre-extracted lanes and is store-bound
+__attribute__((target("avx2")))
+void unpackV210AVX2(const uint8_t* src, size_t src_pitch,
+                    uint16_t* dst_y, uint16_t* dst_cb, uint16_t* dst_cr,
+                    uint32_t width, uint32_t height) {
+    const __m256i mask = _mm256_set1_epi32(0x3FF);
+
+    for (uint32_t row = 0; row < height; row++) {
+        const uint32_t* words = (const uint32_t*)(src + row * src_pitch);
+        uint16_t* y = dst_y + (size_t)row * width;
+        uint16_t* cb = dst_cb + (size_t)row * (width / 2);
+        uint16_t* cr = dst_cr + (size_t)row * (width / 2);
+
+        uint32_t x = 0;
+        // 8 dwords = 2 groups = 12 pixels per iteration
+        alignas(32) uint32_t lo[8], mid[8], hi[8];
+        while (x + 12 <= width) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)words);
+            _mm256_store_si256((__m256i*)lo, _mm256_and_si256(v, mask));
+            _mm256_store_si256((__m256i*)mid,
+                               _mm256_and_si256(_mm256_srli_epi32(v, 10), mask));
+            _mm256_store_si256((__m256i*)hi,
+                               _mm256_and_si256(_mm256_srli_epi32(v, 20), mask));
+
+            for (int g = 0; g < 2; g++) {
+                const int d = g * 4;
+                cb[0] = lo[d];      y[0] = mid[d];      cr[0] = hi[d];
+                y[1] = lo[d + 1];   cb[1] = mid[d + 1]; y[2] = hi[d + 1];
+                cr[1] = lo[d + 2];  y[3] = mid[d + 2];  cb[2] = hi[d + 2];
+                y[4] = lo[d + 3];   cr[2] = mid[d + 3]; y[5] = hi[d + 3];
+                y += 6;
+                cb += 3;
+                cr += 3;
+            }
+            words += 8;
+            x += 12;
+        }
+
+        if (x < width) {
+            unpackV210RowScalar(words, y, cb, cr, width - x);
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+void convertUYVYAVX2(const uint8_t* src, size_t src_pitch,
+                     uint8_t* dst, size_t dst_pitch,
+                     uint32_t width, uint32_t height) {
+    // 8 pixels (16 UYVY bytes) per iteration: deinterleave with byte
+    // shuffles (chroma duplicated per pixel pair), do the BT.709 matrix
+    // in 32-bit lanes, interleave the clamped results from lane dumps
+    const __m128i shuf_y = _mm_setr_epi8(1, 3, 5, 7, 9, 11, 13, 15,
+                                         -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i shuf_u = _mm_setr_epi8(0, 0, 4, 4, 8, 8, 12, 12,
+                                         -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i shuf_v = _mm_setr_epi8(2, 2, 6, 6, 10, 10, 14, 14,
+                                         -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i c16 = _mm256_set1_epi32(16);
+    const __m256i c128 = _mm256_set1_epi32(128);
+
+    for (uint32_t row = 0; row < height; row++) {
+        const uint8_t* s = src + row * src_pitch;
+        uint8_t* d = dst + row * dst_pitch;
+
+        uint32_t x = 0;
+        alignas(32) int32_t rl[8], gl[8], bl[8];
+        while (x + 8 <= width) {
+            __m128i packed = _mm_loadu_si128((const __m128i*)s);
+            __m256i y = _mm256_cvtepu8_epi32(_mm_shuffle_epi8(packed, shuf_y));
+            __m256i u = _mm256_cvtepu8_epi32(_mm_shuffle_epi8(packed, shuf_u));
+            __m256i v = _mm256_cvtepu8_epi32(_mm_shuffle_epi8(packed, shuf_v));
+
+            __m256i c = _mm256_mullo_epi32(_mm256_sub_epi32(y, c16),
+                                           _mm256_set1_epi32(298));
+            __m256i du = _mm256_sub_epi32(u, c128);
+            __m256i ev = _mm256_sub_epi32(v, c128);
+
+            __m256i r = _mm256_srai_epi32(
+                _mm256_add_epi32(_mm256_add_epi32(c,
+                    _mm256_mullo_epi32(ev, _mm256_set1_epi32(459))), c128), 8);
+            __m256i g = _mm256_srai_epi32(
+                _mm256_add_epi32(_mm256_sub_epi32(_mm256_sub_epi32(c,
+                    _mm256_mullo_epi32(du, _mm256_set1_epi32(55))),
+                    _mm256_mullo_epi32(ev, _mm256_set1_epi32(136))), c128), 8);
+            __m256i b = _mm256_srai_epi32(
+                _mm256_add_epi32(_mm256_add_epi32(c,
+                    _mm256_mullo_epi32(du, _mm256_set1_epi32(541))), c128), 8);
+
+            _mm256_store_si256((__m256i*)rl, r);
+            _mm256_store_si256((__m256i*)gl, g);
+            _mm256_store_si256((__m256i*)bl, b);
+            for (int i = 0; i < 8; i++) {
+                d[i * 3 + 0] = clamp8(rl[i]);
+                d[i * 3 + 1] = clamp8(gl[i]);
+                d[i * 3 + 2] = clamp8(bl[i]);
+            }
+
+            s += 16;
+            d += 24;
+            x += 8;
+        }
+
+        // Tail pixels
+        for (; x + 2 <= width; x += 2) {
+            int u = s[0], y0 = s[1], v = s[2], y1 = s[3];
+            yuvToRGB709(y0, u, v, d);
+            yuvToRGB709(y1, u, v, d + 3);
+            s += 4;
+            d += 6;
+        }
+    }
+}
+
+__attribute__((target("avx2,f16c")))
+void expand10To16fAVX2(const uint16_t* src, uint16_t* dst_half, size_t count) {
+    const __m256 scale = _mm256_set1_ps(1.0f / 1023.0f);
+    const __m256i mask = _mm256_set1_epi32(0x3FF);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_and_si256(
+            _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(src + i))), mask);
+        __m256 f = _mm256_mul_ps(_mm256_cvtepi32_ps(v), scale);
+        _mm_storeu_si128((__m128i*)(dst_half + i),
+                         _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+    }
+    if (i < count) {
+        expand10To16fScalar(src + i, dst_half + i, count - i);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// AVX-512 kernels
+// ---------------------------------------------------------------------------
+
+__attribute__((target("avx512f,avx512bw")))
+void unpackV210AVX512(const uint8_t* src, size_t src_pitch,
+                      uint16_t* dst_y, uint16_t* dst_cb, uint16_t* dst_cr,
+                      uint32_t width, uint32_t height) {
+    const __m512i mask = _mm512_set1_epi32(0x3FF);
+
+    for (uint32_t row = 0; row < height; row++) {
+        const uint32_t* words = (const uint32_t*)(src + row * src_pitch);
+        uint16_t* y = dst_y + (size_t)row * width;
+        uint16_t* cb = dst_cb + (size_t)row * (width / 2);
+        uint16_t* cr = dst_cr + (size_t)row * (width / 2);
+
+        uint32_t x = 0;
+        // 16 dwords = 4 groups = 24 pixels per iteration
+        alignas(64) uint32_t lo[16], mid[16], hi[16];
+        while (x + 24 <= width) {
+            __m512i v = _mm512_loadu_si512((const void*)words);
+            _mm512_store_si512(lo, _mm512_and_si512(v, mask));
+            _mm512_store_si512(mid,
+                               _mm512_and_si512(_mm512_srli_epi32(v, 10), mask));
+            _mm512_store_si512(hi,
+                               _mm512_and_si512(_mm512_srli_epi32(v, 20), mask));
+
+            for (int g = 0; g < 4; g++) {
+                const int d = g * 4;
+                cb[0] = lo[d];      y[0] = mid[d];      cr[0] = hi[d];
+                y[1] = lo[d + 1];   cb[1] = mid[d + 1]; y[2] = hi[d + 1];
+                cr[1] = lo[d + 2];  y[3] = mid[d + 2];  cb[2] = hi[d + 2];
+                y[4] = lo[d + 3];   cr[2] = mid[d + 3]; y[5] = hi[d + 3];
+                y += 6;
+                cb += 3;
+                cr += 3;
+            }
+            words += 16;
+            x += 24;
+        }
+
+        if (x < width) {
+            unpackV210RowScalar(words, y, cb, cr, width - x);
+        }
+    }
+}
+
+__attribute__((target("avx512f")))
+void expand10To16fAVX512(const uint16_t* src, uint16_t* dst_half, size_t count) {
+    const __m512 scale = _mm512_set1_ps(1.0f / 1023.0f);
+    const __m512i mask = _mm512_set1_epi32(0x3FF);
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512i v = _mm512_and_si512(
+            _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)(src + i))), mask);
+        __m512 f = _mm512_mul_ps(_mm512_cvtepi32_ps(v), scale);
+        _mm256_storeu_si256((__m256i*)(dst_half + i),
+                            _mm512_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+    }
+    if (i < count) {
+        expand10To16fScalar(src + i, dst_half + i, count - i);
+    }
+}
+
+#endif // __x86_64__
+
+// ---------------------------------------------------------------------------
+// Runtime dispatch
+// ---------------------------------------------------------------------------
+
+using UnpackV210Fn = void (*)(const uint8_t*, size_t, uint16_t*, uint16_t*,
+                              uint16_t*, uint32_t, uint32_t);
+using ConvertUYVYFn = void (*)(const uint8_t*, size_t, uint8_t*, size_t,
+                               uint32_t, uint32_t);
+using Expand10Fn = void (*)(const uint16_t*, uint16_t*, size_t);
+
+UnpackV210Fn g_unpack_v210 = unpackV210Scalar;
+ConvertUYVYFn g_convert_uyvy = convertUYVYScalar;
+Expand10Fn g_expand_10 = expand10To16fScalar;
+const char* g_active = "scalar";
+std::once_flag g_dispatch_once;
+
+void selectKernels() {
+#if defined(__x86_64__)
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+        g_unpack_v210 = unpackV210AVX512;
+        g_convert_uyvy = convertUYVYAVX2;  // no AVX-512 win for this one
+        g_expand_10 = expand10To16fAVX512;
+        g_active = "avx512";
+    } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c")) {
+        g_unpack_v210 = unpackV210AVX2;
+        g_convert_uyvy = convertUYVYAVX2;
+        g_expand_10 = expand10To16fAVX2;
+        g_active = "avx2";
+    }
+#endif
+    LOG_DEBUG("PixelConvert", "Selected %s conversion kernels", g_active);
+}
+
+} // namespace
+
+const char* activeKernels() {
+    std::call_once(g_dispatch_once, selectKernels);
+    return g_active;
+}
+
+void unpackV210ToPlanar10(const uint8_t* src, size_t src_pitch,
+                          uint16_t* dst_y, uint16_t* dst_cb, uint16_t* dst_cr,
+                          uint32_t width, uint32_t height) {
+    std::call_once(g_dispatch_once, selectKernels);
+    g_unpack_v210(src, src_pitch, dst_y, dst_cb, dst_cr, width, height);
+}
+
+void convertUYVYToRGB(const uint8_t* src, size_t src_pitch,
+                      uint8_t* dst, size_t dst_pitch,
+                      uint32_t width, uint32_t height) {
+    std::call_once(g_dispatch_once, selectKernels);
+    g_convert_uyvy(src, src_pitch, dst, dst_pitch, width, height);
+}
+
+void expand10To16f(const uint16_t* src, uint16_t* dst_half, size_t count) {
+    std::call_once(g_dispatch_once, selectKernels);
+    g_expand_10(src, dst_half, count);
+}
+
+} // namespace pixel
+} // namespace core
+} // namespace ares
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace ares {
+namespace core {
+namespace pixel {
+
+// SIMD pixel-format conversion kernels with runtime CPUID dispatch.
+//
+// The scalar reference kernels cap the CPU fallback path at ~25 fps for
+// 4K v210; the AVX2/AVX-512 variants are selected once at first use via
+// __builtin_cpu_supports and shared by DeckLinkCapture, the replayer and
+// the benchmark suite. All functions tolerate any width (tails are
+// handled scalar) but expect dst planes sized for the full frame.
+
+// Which kernel set the dispatcher selected: "avx512", "avx2" or "scalar"
+const char* activeKernels();
+
+// v210 (packed 10-bit 4:2:2, 128-byte-aligned rows) to planar 10-bit.
+// dst_y is width*height values; dst_cb/dst_cr are width/2*height.
+void unpackV210ToPlanar10(const uint8_t* src, size_t src_pitch,
+                          uint16_t* dst_y, uint16_t* dst_cb, uint16_t* dst_cr,
+                          uint32_t width, uint32_t height);
+
+// UYVY (packed 8-bit 4:2:2) to interleaved RGB 8-bit (BT.709 limited range)
+void convertUYVYToRGB(const uint8_t* src, size_t src_pitch,
+                      uint8_t* dst, size_t dst_pitch,
+                      uint32_t width, uint32_t height);
+
+// 10-bit code values (in uint16_t) to IEEE half floats normalized to
+// [0,1] (for 16f GPU upload paths)
+void expand10To16f(const uint16_t* src, uint16_t* dst_half, size_t count);
+
+} // namespace pixel
+} // namespace core
+} // namespace ares
@@ -0,0 +1,106 @@
+#include "rt_sched.h"
+#include "logger.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <cstring>
+#include <cerrno>
+#include <mutex>
+
+namespace ares {
+namespace core {
+
+namespace {
+// Latched configuration (written once at startup, read by any thread)
+RealtimeConfig g_config;
+bool g_configured = false;
+std::mutex g_mutex;
+} // namespace
+
+void RTSched::configure(const RealtimeConfig& config) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_config = config;
+    g_configured = true;
+
+    if (config.enabled) {
+        LOG_INFO("RTSched", "Realtime classes: main fifo=%d cpu=%d, "
+                 "capture fifo=%d cpu=%d, worker fifo=%d cpu=%d",
+                 config.main_priority, config.main_cpu,
+                 config.capture_priority, config.capture_cpu,
+                 config.worker_priority, config.worker_cpu);
+    }
+}
+
+Result RTSched::lockMemory() {
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        LOG_WARN("RTSched", "mlockall failed: %s (continuing without locked memory)",
+                 strerror(errno));
+        return Result::ERROR_GENERIC;
+    }
+    LOG_INFO("RTSched", "Process memory locked (current + future)");
+    return Result::SUCCESS;
+}
+
+Result RTSched::applyCurrentThread(const char* name) {
+    int priority = 0;
+    int cpu = -1;
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        if (!g_configured || !g_config.enabled) {
+            return Result::SUCCESS;
+        }
+        if (strcmp(name, CLASS_MAIN) == 0) {
+            priority = g_config.main_priority;
+            cpu = g_config.main_cpu;
+        } else if (strcmp(name, CLASS_CAPTURE) == 0) {
+            priority = g_config.capture_priority;
+            cpu = g_config.capture_cpu;
+        } else if (strcmp(name, CLASS_WORKER) == 0) {
+            priority = g_config.worker_priority;
+            cpu = g_config.worker_cpu;
+        } else {
+            LOG_WARN("RTSched", "Unknown thread class '%s'", name);
+            return Result::ERROR_NOT_FOUND;
+        }
+    }
+
+    // Thread name shows up in top/ps for diagnosis (15 char limit)
+    char thread_name[16];
+    snprintf(thread_name, sizeof(thread_name), "ares-%s", name);
+    pthread_setname_np(pthread_self(), thread_name);
+
+    Result result = Result::SUCCESS;
+
+    if (priority > 0) {
+        struct sched_param param = {};
+        param.sched_priority = priority;
+        if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0) {
+            LOG_WARN("RTSched", "SCHED_FIFO %d for '%s' failed: %s "
+                     "(needs CAP_SYS_NICE, continuing at SCHED_OTHER)",
+                     priority, name, strerror(errno));
+            result = Result::ERROR_GENERIC;
+        } else {
+            LOG_INFO("RTSched", "Thread '%s' running SCHED_FIFO priority %d",
+                     name, priority);
+        }
+    }
+
+    if (cpu >= 0) {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(cpu, &cpuset);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0) {
+            LOG_WARN("RTSched", "Failed to pin '%s' to CPU %d: %s",
+                     name, cpu, strerror(errno));
+            result = Result::ERROR_GENERIC;
+        } else {
+            LOG_INFO("RTSched", "Thread '%s' pinned to CPU %d", name, cpu);
+        }
+    }
+
+    return result;
+}
+
+} // namespace core
+} // namespace ares
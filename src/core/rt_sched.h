@@ -0,0 +1,42 @@
+#pragma once
+
+#include <ares/types.h>
+#include <ares/ares_config.h>
+
+namespace ares {
+namespace core {
+
+// Process and thread real-time configuration. AV appliances run the
+// frame path under SCHED_FIFO on pinned CPUs so compile jobs or
+// indexers sharing the box cannot perturb frame pacing; everything
+// here degrades gracefully to SCHED_OTHER with a LOG_WARN when the
+// process lacks CAP_SYS_NICE or is sandboxed.
+//
+// Threads register by name: configure() is called once at startup with
+// the [realtime] config, then each thread calls applyCurrentThread()
+// with its class name from its own context (scheduling and affinity
+// are per-thread attributes on Linux).
+class RTSched {
+public:
+    // Known thread class names
+    static constexpr const char* CLASS_MAIN = "main";       // frame path
+    static constexpr const char* CLASS_CAPTURE = "capture"; // DeckLink delivery
+    static constexpr const char* CLASS_WORKER = "worker";   // pipeline back half
+
+    // Latch the configured classes (call once, before threads apply)
+    static void configure(const RealtimeConfig& config);
+
+    // mlockall(MCL_CURRENT | MCL_FUTURE): keep frame buffers and code
+    // resident so a page fault never lands mid-frame. Call early,
+    // before the large allocations, so future mappings are covered.
+    static Result lockMemory();
+
+    // Apply the named class to the calling thread: sets the kernel
+    // thread name, SCHED_FIFO priority and CPU affinity as configured.
+    // No-op (SUCCESS) when realtime is disabled or the name has no
+    // configured priority/pin.
+    static Result applyCurrentThread(const char* name);
+};
+
+} // namespace core
+} // namespace ares
@@ -1,34 +1,24 @@
 #include "thread_pool.h"
+#include "logger.h"
+
+#include <pthread.h>
+#include <sched.h>
 
 namespace ares {
 namespace core {
 
 ThreadPool::ThreadPool(size_t num_threads) {
-    for (size_t i = 0; i < num_threads; ++i) {
-        m_workers.emplace_back([this] {
-            while (true) {
-                std::function<void()> task;
-                {
-                    std::unique_lock<std::mutex> lock(m_queue_mutex);
-                    m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
-
-                    if (m_stop && m_tasks.empty()) {
-                        return;
-                    }
-
-                    task = std::move(m_tasks.front());
-                    m_tasks.pop();
-                }
-                task();
-            }
-        });
-    }
+    startWorkers(num_threads, {});
+}
+
+ThreadPool::ThreadPool(size_t num_threads, const std::vector<int>& cpu_affinity) {
+    startWorkers(num_threads, cpu_affinity);
 }
 
 ThreadPool::~ThreadPool() {
+    m_stop = true;
     {
-        std::unique_lock<std::mutex> lock(m_queue_mutex);
-        m_stop = true;
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
     }
     m_condition.notify_all();
 
@@ -37,24 +27,123 @@ ThreadPool::~ThreadPool() {
     }
 }
 
-template<typename F, typename... Args>
-auto ThreadPool::enqueue(F&& f, Args&&... args) -> std::future<typename std::invoke_result<F, Args...>::type> {
-    using return_type = typename std::invoke_result<F, Args...>::type;
+void ThreadPool::startWorkers(size_t num_threads, const std::vector<int>& cpu_affinity) {
+    m_queues.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        m_queues.emplace_back(std::make_unique<WorkerQueue>());
+    }
+
+    for (size_t i = 0; i < num_threads; ++i) {
+        int pinned_cpu = cpu_affinity.empty()
+            ? -1
+            : cpu_affinity[i % cpu_affinity.size()];
+        m_workers.emplace_back(&ThreadPool::workerLoop, this, i, pinned_cpu);
+    }
+}
+
+void ThreadPool::workerLoop(size_t index, int pinned_cpu) {
+    if (pinned_cpu >= 0) {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(pinned_cpu, &cpuset);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0) {
+            LOG_WARN("ThreadPool", "Failed to pin worker %zu to CPU %d", index, pinned_cpu);
+        } else {
+            LOG_DEBUG("ThreadPool", "Worker %zu pinned to CPU %d", index, pinned_cpu);
+        }
+    }
+
+    while (true) {
+        std::function<void()> task;
+        if (popTask(index, task)) {
+            task();
+            m_tasks_executed.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        // Nothing found anywhere: sleep until new work or shutdown
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
+        m_condition.wait(lock, [this] {
+            return m_stop.load() || m_pending.load() > 0;
+        });
+
+        if (m_stop.load() && m_pending.load() == 0) {
+            return;
+        }
+    }
+}
 
-    auto task = std::make_shared<std::packaged_task<return_type()>>(
-        std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-    );
+bool ThreadPool::popTask(size_t index, std::function<void()>& task) {
+    // High-priority lane first
+    {
+        std::lock_guard<std::mutex> lock(m_high_mutex);
+        if (!m_high_tasks.empty()) {
+            task = std::move(m_high_tasks.front());
+            m_high_tasks.pop_front();
+            m_pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
 
-    std::future<return_type> res = task->get_future();
+    // Own queue: pop from the front (LIFO-ish locality is not needed
+    // here, FIFO keeps latency predictable)
     {
-        std::unique_lock<std::mutex> lock(m_queue_mutex);
-        if (m_stop) {
-            throw std::runtime_error("enqueue on stopped ThreadPool");
+        WorkerQueue& queue = *m_queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            m_pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Steal from the back of the other workers' queues
+    for (size_t offset = 1; offset < m_queues.size(); ++offset) {
+        WorkerQueue& victim = *m_queues[(index + offset) % m_queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            m_pending.fetch_sub(1, std::memory_order_relaxed);
+            m_tasks_stolen.fetch_add(1, std::memory_order_relaxed);
+            return true;
         }
-        m_tasks.emplace([task]() { (*task)(); });
+    }
+
+    return false;
+}
+
+void ThreadPool::pushTask(std::function<void()> task, Priority priority) {
+    if (priority == Priority::HIGH) {
+        std::lock_guard<std::mutex> lock(m_high_mutex);
+        m_high_tasks.push_back(std::move(task));
+        m_high_priority_tasks.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        // Round-robin across worker queues to spread lock contention
+        uint32_t slot = m_next_queue.fetch_add(1, std::memory_order_relaxed)
+                        % static_cast<uint32_t>(m_queues.size());
+        WorkerQueue& queue = *m_queues[slot];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+
+    m_pending.fetch_add(1, std::memory_order_relaxed);
+    {
+        // Taking the sleep mutex orders the pending increment against the
+        // wait predicate, closing the lost-wakeup window
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
     }
     m_condition.notify_one();
-    return res;
+}
+
+ThreadPool::Stats ThreadPool::getStats() const {
+    Stats stats;
+    stats.tasks_executed = m_tasks_executed.load(std::memory_order_relaxed);
+    stats.tasks_stolen = m_tasks_stolen.load(std::memory_order_relaxed);
+    stats.high_priority_tasks = m_high_priority_tasks.load(std::memory_order_relaxed);
+    stats.worker_count = m_workers.size();
+    return stats;
 }
 
 } // namespace core
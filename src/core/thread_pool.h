@@ -2,30 +2,115 @@
 
 #include <thread>
 #include <vector>
-#include <queue>
+#include <deque>
 #include <mutex>
 #include <condition_variable>
 #include <functional>
 #include <future>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <cstdint>
 
 namespace ares {
 namespace core {
 
+// Work-stealing thread pool.
+// Each worker owns a deque: it pops its own tasks from the front and
+// steals from the back of other workers when idle, so enqueue/dequeue
+// traffic is spread across per-worker locks instead of contending on a
+// single queue. A shared high-priority lane is drained before any local
+// work, keeping latency-critical tasks (scene analysis, black-bar scan)
+// from queueing behind bulk work. Workers can optionally be pinned to
+// specific CPUs for isolated-core setups.
 class ThreadPool {
 public:
+    enum class Priority {
+        NORMAL,
+        HIGH
+    };
+
     explicit ThreadPool(size_t num_threads);
+
+    // Pin worker i to cpu_affinity[i % cpu_affinity.size()]
+    ThreadPool(size_t num_threads, const std::vector<int>& cpu_affinity);
+
     ~ThreadPool();
 
     template<typename F, typename... Args>
     auto enqueue(F&& f, Args&&... args) -> std::future<typename std::invoke_result<F, Args...>::type>;
 
+    template<typename F, typename... Args>
+    auto enqueue(Priority priority, F&& f, Args&&... args)
+        -> std::future<typename std::invoke_result<F, Args...>::type>;
+
+    // Statistics
+    struct Stats {
+        uint64_t tasks_executed = 0;
+        uint64_t tasks_stolen = 0;
+        uint64_t high_priority_tasks = 0;
+        size_t worker_count = 0;
+    };
+
+    Stats getStats() const;
+
 private:
+    // One deque per worker, guarded by its own mutex
+    struct WorkerQueue {
+        std::deque<std::function<void()>> tasks;
+        std::mutex mutex;
+    };
+
+    void startWorkers(size_t num_threads, const std::vector<int>& cpu_affinity);
+    void workerLoop(size_t index, int pinned_cpu);
+    void pushTask(std::function<void()> task, Priority priority);
+    bool popTask(size_t index, std::function<void()>& task);
+
     std::vector<std::thread> m_workers;
-    std::queue<std::function<void()>> m_tasks;
-    std::mutex m_queue_mutex;
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+
+    // High-priority lane, drained before local/stolen work
+    std::deque<std::function<void()>> m_high_tasks;
+    std::mutex m_high_mutex;
+
+    // Sleep/wake coordination for idle workers
+    std::mutex m_sleep_mutex;
     std::condition_variable m_condition;
-    bool m_stop = false;
+    std::atomic<uint32_t> m_pending{0};
+    std::atomic<bool> m_stop{false};
+
+    // Round-robin submission cursor
+    std::atomic<uint32_t> m_next_queue{0};
+
+    // Statistics (relaxed counters, reads are approximate)
+    std::atomic<uint64_t> m_tasks_executed{0};
+    std::atomic<uint64_t> m_tasks_stolen{0};
+    std::atomic<uint64_t> m_high_priority_tasks{0};
 };
 
+// Template definitions (must be visible to callers)
+template<typename F, typename... Args>
+auto ThreadPool::enqueue(F&& f, Args&&... args)
+    -> std::future<typename std::invoke_result<F, Args...>::type> {
+    return enqueue(Priority::NORMAL, std::forward<F>(f), std::forward<Args>(args)...);
+}
+
+template<typename F, typename... Args>
+auto ThreadPool::enqueue(Priority priority, F&& f, Args&&... args)
+    -> std::future<typename std::invoke_result<F, Args...>::type> {
+    using return_type = typename std::invoke_result<F, Args...>::type;
+
+    auto task = std::make_shared<std::packaged_task<return_type()>>(
+        std::bind(std::forward<F>(f), std::forward<Args>(args)...)
+    );
+
+    std::future<return_type> res = task->get_future();
+    if (m_stop) {
+        throw std::runtime_error("enqueue on stopped ThreadPool");
+    }
+    pushTask([task]() { (*task)(); }, priority);
+    return res;
+}
+
 } // namespace core
 } // namespace ares
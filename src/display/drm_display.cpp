@@ -1,4 +1,5 @@
 #include "drm_display.h"
+#include "edid_cache.h"
 #include "core/logger.h"
 #include <fcntl.h>
 #include <unistd.h>
@@ -43,6 +44,10 @@ Result DRMDisplay::initialize(const DisplayConfig& config) {
         return result;
     }
 
+    // Resolve EDID capabilities (cache hit skips the parse); purely
+    // informational, so a missing blob is non-fatal
+    loadDisplayCapabilities();
+
     // Find encoder
     result = findEncoder();
     if (result != Result::SUCCESS) {
@@ -64,6 +69,13 @@ Result DRMDisplay::initialize(const DisplayConfig& config) {
         return result;
     }
 
+    // Enable the atomic API when the driver supports it; failure here is
+    // not fatal, the legacy pageFlip/waitForVBlank path still works
+    result = initAtomic();
+    if (result != Result::SUCCESS) {
+        LOG_WARN("Display", "Atomic modesetting unavailable, using legacy page flips");
+    }
+
     m_initialized = true;
 
     // Log display info
@@ -137,6 +149,65 @@ Result DRMDisplay::findConnector(const std::string& connector_name) {
     return Result::ERROR_NOT_FOUND;
 }
 
+void DRMDisplay::loadDisplayCapabilities() {
+    // Find the connector's EDID property blob
+    drmModeObjectProperties* props = drmModeObjectGetProperties(
+        m_drm_fd, m_connector_id, DRM_MODE_OBJECT_CONNECTOR);
+    if (!props) {
+        return;
+    }
+
+    drmModePropertyBlobRes* blob = nullptr;
+    for (uint32_t i = 0; i < props->count_props && !blob; i++) {
+        drmModePropertyRes* prop = drmModeGetProperty(m_drm_fd, props->props[i]);
+        if (!prop) {
+            continue;
+        }
+        if ((prop->flags & DRM_MODE_PROP_BLOB) && strcmp(prop->name, "EDID") == 0) {
+            blob = drmModeGetPropertyBlob(m_drm_fd, props->prop_values[i]);
+        }
+        drmModeFreeProperty(prop);
+    }
+    drmModeFreeObjectProperties(props);
+
+    if (!blob || blob->length < 128) {
+        if (blob) {
+            drmModeFreePropertyBlob(blob);
+        }
+        LOG_WARN("Display", "Connector has no EDID blob (continuing without capabilities)");
+        return;
+    }
+
+    const char* type_name = drmModeGetConnectorTypeName(m_connector->connector_type);
+    char connector_name[64];
+    snprintf(connector_name, sizeof(connector_name), "%s-%d",
+             type_name, m_connector->connector_type_id);
+
+    uint64_t hash = EDIDCache::hashEDID(
+        static_cast<const uint8_t*>(blob->data), blob->length);
+
+    // Warm path: same EDID as last boot, skip the parse
+    if (EDIDCache::load(connector_name, hash, m_edid_caps, m_edid_modes) ==
+        Result::SUCCESS) {
+        m_edid_caps_valid = true;
+        drmModeFreePropertyBlob(blob);
+        return;
+    }
+
+    // Cold path: full parse, then persist for the next startup
+    EDIDParser parser;
+    m_edid_modes.clear();
+    if (parser.parseEDIDData(static_cast<const uint8_t*>(blob->data),
+                             blob->length, m_edid_modes) == Result::SUCCESS) {
+        m_edid_caps = parser.getCapabilities();
+        m_edid_caps_valid = true;
+        EDIDCache::store(connector_name, hash, m_edid_caps, m_edid_modes);
+    } else {
+        LOG_WARN("Display", "EDID parse failed (continuing without capabilities)");
+    }
+    drmModeFreePropertyBlob(blob);
+}
+
 Result DRMDisplay::findEncoder() {
     if (!m_connector->encoder_id) {
         // Try first available encoder
@@ -294,6 +365,86 @@ Result DRMDisplay::setMode(const DisplayMode& mode) {
     return Result::ERROR_NOT_FOUND;
 }
 
+Result DRMDisplay::setModeSeamless(const DisplayMode& mode) {
+    if (!m_initialized) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+
+    // The fast path needs atomic plus an already-programmed pipe to
+    // retime; before the first commit a normal modeset is the only option
+    if (!m_atomic_supported || !m_modeset_done) {
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    if (mode.width != m_current_mode.width || mode.height != m_current_mode.height) {
+        LOG_DEBUG("Display", "Seamless switch needs matching resolution (%ux%u -> %ux%u)",
+                  m_current_mode.width, m_current_mode.height, mode.width, mode.height);
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    // Find the matching DRM mode
+    drmModeModeInfo* new_mode = nullptr;
+    for (int i = 0; i < m_connector->count_modes; i++) {
+        if (modesMatch(m_connector->modes[i], mode)) {
+            new_mode = &m_connector->modes[i];
+            break;
+        }
+    }
+    if (!new_mode) {
+        LOG_ERROR("Display", "Requested mode not available");
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    // Let any in-flight flip land first
+    if (m_page_flip_pending) {
+        waitFlipComplete(100);
+        if (m_page_flip_pending) {
+            return Result::ERROR_BUSY;
+        }
+    }
+
+    uint32_t new_blob_id = 0;
+    if (drmModeCreatePropertyBlob(m_drm_fd, new_mode, sizeof(*new_mode),
+                                  &new_blob_id) != 0) {
+        LOG_ERROR("Display", "Failed to create mode blob: %s", strerror(errno));
+        return Result::ERROR_GENERIC;
+    }
+
+    drmModeAtomicReq* req = drmModeAtomicAlloc();
+    if (!req) {
+        drmModeDestroyPropertyBlob(m_drm_fd, new_blob_id);
+        return Result::ERROR_OUT_OF_MEMORY;
+    }
+
+    drmModeAtomicAddProperty(req, m_crtc_id, m_crtc_props.mode_id, new_blob_id);
+
+    // Probe first: without ALLOW_MODESET the kernel only accepts the
+    // commit if the driver can apply the new timing seamlessly
+    int ret = drmModeAtomicCommit(m_drm_fd, req, DRM_MODE_ATOMIC_TEST_ONLY, nullptr);
+    if (ret == 0) {
+        ret = drmModeAtomicCommit(m_drm_fd, req, 0, nullptr);
+    }
+    drmModeAtomicFree(req);
+
+    if (ret != 0) {
+        drmModeDestroyPropertyBlob(m_drm_fd, new_blob_id);
+        LOG_DEBUG("Display", "Seamless mode switch rejected by driver: %s",
+                  strerror(errno));
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    if (m_mode_blob_id != 0) {
+        drmModeDestroyPropertyBlob(m_drm_fd, m_mode_blob_id);
+    }
+    m_mode_blob_id = new_blob_id;
+    m_drm_mode = *new_mode;
+    m_current_mode = convertDrmMode(m_drm_mode);
+
+    LOG_INFO("Display", "Seamless refresh switch to %ux%u@%.2fHz (link kept up)",
+             m_current_mode.width, m_current_mode.height, m_current_mode.refresh_rate);
+    return Result::SUCCESS;
+}
+
 std::vector<DisplayMode> DRMDisplay::getAvailableModes() const {
     std::vector<DisplayMode> modes;
 
@@ -328,8 +479,19 @@ DRMDisplay::DisplayInfo DRMDisplay::getDisplayInfo() const {
     info.height = m_current_mode.height;
     info.refresh_rate = m_current_mode.refresh_rate;
 
-    // Check for HDR support (simplified - would need to check properties)
-    info.hdr_supported = false;
+    // HDR support from the parsed EDID (cache-backed)
+    if (m_edid_caps_valid) {
+        info.display_name = m_edid_caps.model_name;
+        info.manufacturer = m_edid_caps.manufacturer;
+        info.hdr10_supported = m_edid_caps.supports_hdr10;
+        info.hlg_supported = m_edid_caps.supports_hlg;
+        info.dolby_vision_supported = m_edid_caps.supports_dolby_vision;
+        info.hdr_supported = m_edid_caps.supports_hdr10 || m_edid_caps.supports_hlg;
+        info.max_luminance = (uint16_t)m_edid_caps.max_luminance;
+        info.min_luminance = (uint16_t)(m_edid_caps.min_luminance * 10000.0f);
+    } else {
+        info.hdr_supported = false;
+    }
 
     // Get available modes
     info.available_modes = getAvailableModes();
@@ -337,55 +499,496 @@ DRMDisplay::DisplayInfo DRMDisplay::getDisplayInfo() const {
     return info;
 }
 
-Result DRMDisplay::pageFlip(uint32_t fb_id, void* user_data) {
+Result DRMDisplay::initAtomic() {
+    if (drmSetClientCap(m_drm_fd, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1) != 0 ||
+        drmSetClientCap(m_drm_fd, DRM_CLIENT_CAP_ATOMIC, 1) != 0) {
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    Result result = findPrimaryPlane();
+    if (result != Result::SUCCESS) {
+        return result;
+    }
+
+    // Cache the property IDs every commit needs
+    m_plane_props.fb_id = getPropertyId(m_plane_id, DRM_MODE_OBJECT_PLANE, "FB_ID");
+    m_plane_props.crtc_id = getPropertyId(m_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_ID");
+    m_plane_props.src_x = getPropertyId(m_plane_id, DRM_MODE_OBJECT_PLANE, "SRC_X");
+    m_plane_props.src_y = getPropertyId(m_plane_id, DRM_MODE_OBJECT_PLANE, "SRC_Y");
+    m_plane_props.src_w = getPropertyId(m_plane_id, DRM_MODE_OBJECT_PLANE, "SRC_W");
+    m_plane_props.src_h = getPropertyId(m_plane_id, DRM_MODE_OBJECT_PLANE, "SRC_H");
+    m_plane_props.crtc_x = getPropertyId(m_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_X");
+    m_plane_props.crtc_y = getPropertyId(m_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_Y");
+    m_plane_props.crtc_w = getPropertyId(m_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_W");
+    m_plane_props.crtc_h = getPropertyId(m_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_H");
+    m_plane_props.in_fence_fd = getPropertyId(m_plane_id, DRM_MODE_OBJECT_PLANE, "IN_FENCE_FD");
+
+    m_crtc_props.mode_id = getPropertyId(m_crtc_id, DRM_MODE_OBJECT_CRTC, "MODE_ID");
+    m_crtc_props.active = getPropertyId(m_crtc_id, DRM_MODE_OBJECT_CRTC, "ACTIVE");
+    m_crtc_props.out_fence_ptr = getPropertyId(m_crtc_id, DRM_MODE_OBJECT_CRTC, "OUT_FENCE_PTR");
+    m_crtc_props.vrr_enabled = getPropertyId(m_crtc_id, DRM_MODE_OBJECT_CRTC, "VRR_ENABLED");
+
+    m_connector_props.crtc_id = getPropertyId(m_connector_id, DRM_MODE_OBJECT_CONNECTOR, "CRTC_ID");
+
+    // VRR needs both the connector capability and the CRTC property
+    m_vrr_capable = m_crtc_props.vrr_enabled != 0 &&
+                    getPropertyValue(m_connector_id, DRM_MODE_OBJECT_CONNECTOR,
+                                     "vrr_capable") != 0;
+
+    if (!m_plane_props.fb_id || !m_plane_props.crtc_id ||
+        !m_crtc_props.mode_id || !m_crtc_props.active || !m_connector_props.crtc_id) {
+        LOG_WARN("Display", "Driver missing required atomic properties");
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    if (!m_plane_props.in_fence_fd) {
+        LOG_WARN("Display", "Plane has no IN_FENCE_FD, explicit fencing unavailable");
+    }
+
+    m_atomic_supported = true;
+    LOG_INFO("Display", "Atomic modesetting enabled (plane %u, fencing: %s, VRR: %s)",
+             m_plane_id, m_plane_props.in_fence_fd ? "explicit" : "implicit",
+             m_vrr_capable ? "capable" : "no");
+
+    // An overlay plane is optional (OSD falls back to compositing)
+    findOverlayPlane();
+
+    return Result::SUCCESS;
+}
+
+Result DRMDisplay::findOverlayPlane() {
+    int crtc_index = -1;
+    for (int i = 0; i < m_resources->count_crtcs; i++) {
+        if (m_resources->crtcs[i] == m_crtc_id) {
+            crtc_index = i;
+            break;
+        }
+    }
+    if (crtc_index < 0) {
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    drmModePlaneRes* plane_res = drmModeGetPlaneResources(m_drm_fd);
+    if (!plane_res) {
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    for (uint32_t i = 0; i < plane_res->count_planes && m_overlay_plane_id == 0; i++) {
+        drmModePlane* plane = drmModeGetPlane(m_drm_fd, plane_res->planes[i]);
+        if (!plane) {
+            continue;
+        }
+
+        if ((plane->possible_crtcs & (1u << crtc_index)) &&
+            plane->plane_id != m_plane_id) {
+            // Needs to be an overlay/cursor type and scan out ARGB so the
+            // OSD can alpha-blend over the video
+            bool has_argb = false;
+            for (uint32_t f = 0; f < plane->count_formats; f++) {
+                if (plane->formats[f] == DRM_FORMAT_ARGB8888) {
+                    has_argb = true;
+                    break;
+                }
+            }
+
+            uint64_t type = getPropertyValue(plane->plane_id, DRM_MODE_OBJECT_PLANE, "type");
+            if (has_argb && (type == DRM_PLANE_TYPE_OVERLAY ||
+                             type == DRM_PLANE_TYPE_CURSOR)) {
+                m_overlay_plane_id = plane->plane_id;
+            }
+        }
+
+        drmModeFreePlane(plane);
+    }
+
+    drmModeFreePlaneResources(plane_res);
+
+    if (m_overlay_plane_id == 0) {
+        LOG_INFO("Display", "No ARGB overlay plane for CRTC %u, OSD uses compositing",
+                 m_crtc_id);
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    m_overlay_props.fb_id = getPropertyId(m_overlay_plane_id, DRM_MODE_OBJECT_PLANE, "FB_ID");
+    m_overlay_props.crtc_id = getPropertyId(m_overlay_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_ID");
+    m_overlay_props.src_x = getPropertyId(m_overlay_plane_id, DRM_MODE_OBJECT_PLANE, "SRC_X");
+    m_overlay_props.src_y = getPropertyId(m_overlay_plane_id, DRM_MODE_OBJECT_PLANE, "SRC_Y");
+    m_overlay_props.src_w = getPropertyId(m_overlay_plane_id, DRM_MODE_OBJECT_PLANE, "SRC_W");
+    m_overlay_props.src_h = getPropertyId(m_overlay_plane_id, DRM_MODE_OBJECT_PLANE, "SRC_H");
+    m_overlay_props.crtc_x = getPropertyId(m_overlay_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_X");
+    m_overlay_props.crtc_y = getPropertyId(m_overlay_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_Y");
+    m_overlay_props.crtc_w = getPropertyId(m_overlay_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_W");
+    m_overlay_props.crtc_h = getPropertyId(m_overlay_plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_H");
+
+    if (!m_overlay_props.fb_id || !m_overlay_props.crtc_id) {
+        m_overlay_plane_id = 0;
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    LOG_INFO("Display", "ARGB overlay plane for OSD: %u", m_overlay_plane_id);
+    return Result::SUCCESS;
+}
+
+Result DRMDisplay::setOverlayPlane(uint32_t fb_id, uint32_t src_width, uint32_t src_height,
+                                   int32_t crtc_x, int32_t crtc_y,
+                                   uint32_t crtc_w, uint32_t crtc_h) {
+    if (!m_initialized) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+    if (m_overlay_plane_id == 0 || !m_atomic_supported || !m_modeset_done) {
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    drmModeAtomicReq* req = drmModeAtomicAlloc();
+    if (!req) {
+        return Result::ERROR_OUT_OF_MEMORY;
+    }
+
+    drmModeAtomicAddProperty(req, m_overlay_plane_id, m_overlay_props.crtc_id, m_crtc_id);
+    drmModeAtomicAddProperty(req, m_overlay_plane_id, m_overlay_props.fb_id, fb_id);
+    drmModeAtomicAddProperty(req, m_overlay_plane_id, m_overlay_props.src_x, 0);
+    drmModeAtomicAddProperty(req, m_overlay_plane_id, m_overlay_props.src_y, 0);
+    drmModeAtomicAddProperty(req, m_overlay_plane_id, m_overlay_props.src_w,
+                             (uint64_t)src_width << 16);
+    drmModeAtomicAddProperty(req, m_overlay_plane_id, m_overlay_props.src_h,
+                             (uint64_t)src_height << 16);
+    drmModeAtomicAddProperty(req, m_overlay_plane_id, m_overlay_props.crtc_x, crtc_x);
+    drmModeAtomicAddProperty(req, m_overlay_plane_id, m_overlay_props.crtc_y, crtc_y);
+    drmModeAtomicAddProperty(req, m_overlay_plane_id, m_overlay_props.crtc_w, crtc_w);
+    drmModeAtomicAddProperty(req, m_overlay_plane_id, m_overlay_props.crtc_h, crtc_h);
+
+    // No page-flip event: the overlay updates at menu rate and never
+    // blocks the video plane's flips
+    int ret = drmModeAtomicCommit(m_drm_fd, req, DRM_MODE_ATOMIC_NONBLOCK, nullptr);
+    drmModeAtomicFree(req);
+
+    if (ret != 0) {
+        LOG_ERROR("Display", "Overlay commit failed: %s", strerror(errno));
+        return Result::ERROR_GENERIC;
+    }
+
+    m_overlay_active = true;
+    return Result::SUCCESS;
+}
+
+Result DRMDisplay::disableOverlayPlane() {
+    if (!m_initialized || m_overlay_plane_id == 0 || !m_overlay_active) {
+        return Result::SUCCESS;
+    }
+
+    drmModeAtomicReq* req = drmModeAtomicAlloc();
+    if (!req) {
+        return Result::ERROR_OUT_OF_MEMORY;
+    }
+
+    drmModeAtomicAddProperty(req, m_overlay_plane_id, m_overlay_props.crtc_id, 0);
+    drmModeAtomicAddProperty(req, m_overlay_plane_id, m_overlay_props.fb_id, 0);
+
+    int ret = drmModeAtomicCommit(m_drm_fd, req, 0, nullptr);
+    drmModeAtomicFree(req);
+
+    if (ret != 0) {
+        LOG_ERROR("Display", "Overlay disable failed: %s", strerror(errno));
+        return Result::ERROR_GENERIC;
+    }
+
+    m_overlay_active = false;
+    return Result::SUCCESS;
+}
+
+Result DRMDisplay::setVRREnabled(bool enabled) {
+    if (!m_initialized) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+
+    if (enabled && !m_vrr_capable) {
+        LOG_WARN("Display", "VRR requested but display/driver is not VRR capable");
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    if (m_vrr_enabled == enabled) {
+        return Result::SUCCESS;
+    }
+
+    m_vrr_enabled = enabled;
+    LOG_INFO("Display", "VRR %s (applies on next commit)", enabled ? "enabled" : "disabled");
+    return Result::SUCCESS;
+}
+
+Result DRMDisplay::findPrimaryPlane() {
+    // Index of our CRTC in the resource list (possible_crtcs is a bitmask
+    // over that list)
+    int crtc_index = -1;
+    for (int i = 0; i < m_resources->count_crtcs; i++) {
+        if (m_resources->crtcs[i] == m_crtc_id) {
+            crtc_index = i;
+            break;
+        }
+    }
+    if (crtc_index < 0) {
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    drmModePlaneRes* plane_res = drmModeGetPlaneResources(m_drm_fd);
+    if (!plane_res) {
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    for (uint32_t i = 0; i < plane_res->count_planes && m_plane_id == 0; i++) {
+        drmModePlane* plane = drmModeGetPlane(m_drm_fd, plane_res->planes[i]);
+        if (!plane) {
+            continue;
+        }
+
+        if (plane->possible_crtcs & (1u << crtc_index)) {
+            // Check the plane type: we want the primary plane
+            drmModeObjectProperties* props = drmModeObjectGetProperties(
+                m_drm_fd, plane->plane_id, DRM_MODE_OBJECT_PLANE);
+            if (props) {
+                for (uint32_t j = 0; j < props->count_props; j++) {
+                    drmModePropertyRes* prop = drmModeGetProperty(m_drm_fd, props->props[j]);
+                    if (prop) {
+                        if (strcmp(prop->name, "type") == 0 &&
+                            props->prop_values[j] == DRM_PLANE_TYPE_PRIMARY) {
+                            m_plane_id = plane->plane_id;
+                        }
+                        drmModeFreeProperty(prop);
+                    }
+                }
+                drmModeFreeObjectProperties(props);
+            }
+        }
+
+        drmModeFreePlane(plane);
+    }
+
+    drmModeFreePlaneResources(plane_res);
+
+    if (m_plane_id == 0) {
+        LOG_WARN("Display", "No primary plane found for CRTC %u", m_crtc_id);
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    LOG_DEBUG("Display", "Primary plane for CRTC %u: %u", m_crtc_id, m_plane_id);
+    return Result::SUCCESS;
+}
+
+uint32_t DRMDisplay::getPropertyId(uint32_t object_id, uint32_t object_type,
+                                   const char* name) const {
+    uint32_t id = 0;
+    drmModeObjectProperties* props = drmModeObjectGetProperties(
+        m_drm_fd, object_id, object_type);
+    if (!props) {
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < props->count_props && id == 0; i++) {
+        drmModePropertyRes* prop = drmModeGetProperty(m_drm_fd, props->props[i]);
+        if (prop) {
+            if (strcmp(prop->name, name) == 0) {
+                id = prop->prop_id;
+            }
+            drmModeFreeProperty(prop);
+        }
+    }
+
+    drmModeFreeObjectProperties(props);
+    return id;
+}
+
+uint64_t DRMDisplay::getPropertyValue(uint32_t object_id, uint32_t object_type,
+                                      const char* name) const {
+    uint64_t value = 0;
+    drmModeObjectProperties* props = drmModeObjectGetProperties(
+        m_drm_fd, object_id, object_type);
+    if (!props) {
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < props->count_props; i++) {
+        drmModePropertyRes* prop = drmModeGetProperty(m_drm_fd, props->props[i]);
+        if (prop) {
+            if (strcmp(prop->name, name) == 0) {
+                value = props->prop_values[i];
+                drmModeFreeProperty(prop);
+                break;
+            }
+            drmModeFreeProperty(prop);
+        }
+    }
+
+    drmModeFreeObjectProperties(props);
+    return value;
+}
+
+Result DRMDisplay::atomicFlip(uint32_t fb_id, int in_fence_fd, int* out_fence_fd) {
     if (!m_initialized) {
         LOG_ERROR("Display", "Display not initialized");
         return Result::ERROR_NOT_INITIALIZED;
     }
 
+    if (!m_atomic_supported) {
+        return pageFlip(fb_id);
+    }
+
+    // Reap the previous flip if it already landed; if it's still in
+    // flight the caller is running ahead of the display
     if (m_page_flip_pending) {
-        LOG_WARN("Display", "Page flip already pending");
-        return Result::ERROR_BUSY;
+        waitFlipComplete(0);
+        if (m_page_flip_pending) {
+            return Result::ERROR_BUSY;
+        }
     }
 
-    auto start_time = std::chrono::high_resolution_clock::now();
+    drmModeAtomicReq* req = drmModeAtomicAlloc();
+    if (!req) {
+        return Result::ERROR_OUT_OF_MEMORY;
+    }
 
-    // Perform atomic page flip
-    int ret = drmModePageFlip(m_drm_fd, m_crtc_id, fb_id,
-                             DRM_MODE_PAGE_FLIP_EVENT, user_data);
+    uint32_t flags = DRM_MODE_PAGE_FLIP_EVENT;
+
+    // The first commit carries the full mode; later commits only swap
+    // the framebuffer and can be queued without blocking
+    if (!m_modeset_done) {
+        if (m_mode_blob_id == 0 &&
+            drmModeCreatePropertyBlob(m_drm_fd, &m_drm_mode, sizeof(m_drm_mode),
+                                      &m_mode_blob_id) != 0) {
+            LOG_ERROR("Display", "Failed to create mode blob: %s", strerror(errno));
+            drmModeAtomicFree(req);
+            return Result::ERROR_GENERIC;
+        }
+        drmModeAtomicAddProperty(req, m_crtc_id, m_crtc_props.active, 1);
+        drmModeAtomicAddProperty(req, m_crtc_id, m_crtc_props.mode_id, m_mode_blob_id);
+        drmModeAtomicAddProperty(req, m_connector_id, m_connector_props.crtc_id, m_crtc_id);
+        flags |= DRM_MODE_ATOMIC_ALLOW_MODESET;
+    } else {
+        flags |= DRM_MODE_ATOMIC_NONBLOCK;
+    }
+
+    // Full-screen primary plane state (SRC_* are 16.16 fixed point)
+    drmModeAtomicAddProperty(req, m_plane_id, m_plane_props.crtc_id, m_crtc_id);
+    drmModeAtomicAddProperty(req, m_plane_id, m_plane_props.fb_id, fb_id);
+    drmModeAtomicAddProperty(req, m_plane_id, m_plane_props.src_x, 0);
+    drmModeAtomicAddProperty(req, m_plane_id, m_plane_props.src_y, 0);
+    drmModeAtomicAddProperty(req, m_plane_id, m_plane_props.src_w,
+                             (uint64_t)m_drm_mode.hdisplay << 16);
+    drmModeAtomicAddProperty(req, m_plane_id, m_plane_props.src_h,
+                             (uint64_t)m_drm_mode.vdisplay << 16);
+    drmModeAtomicAddProperty(req, m_plane_id, m_plane_props.crtc_x, 0);
+    drmModeAtomicAddProperty(req, m_plane_id, m_plane_props.crtc_y, 0);
+    drmModeAtomicAddProperty(req, m_plane_id, m_plane_props.crtc_w, m_drm_mode.hdisplay);
+    drmModeAtomicAddProperty(req, m_plane_id, m_plane_props.crtc_h, m_drm_mode.vdisplay);
+
+    // VRR state rides along on every commit (toggling it does not need a
+    // modeset, the display just stops quantizing flips to a fixed grid)
+    if (m_crtc_props.vrr_enabled) {
+        drmModeAtomicAddProperty(req, m_crtc_id, m_crtc_props.vrr_enabled,
+                                 m_vrr_enabled ? 1 : 0);
+    }
+
+    // Explicit fencing: scanout waits on the renderer, the out fence
+    // tells the scheduler when the frame actually hit glass
+    if (in_fence_fd >= 0 && m_plane_props.in_fence_fd) {
+        drmModeAtomicAddProperty(req, m_plane_id, m_plane_props.in_fence_fd, in_fence_fd);
+    }
+
+    int64_t out_fence = -1;
+    if (out_fence_fd && m_crtc_props.out_fence_ptr) {
+        drmModeAtomicAddProperty(req, m_crtc_id, m_crtc_props.out_fence_ptr,
+                                 (uint64_t)(uintptr_t)&out_fence);
+    }
+
+    int ret = drmModeAtomicCommit(m_drm_fd, req, flags, this);
+    drmModeAtomicFree(req);
 
     if (ret != 0) {
-        LOG_ERROR("Display", "Page flip failed: %s", strerror(errno));
+        LOG_ERROR("Display", "Atomic commit failed: %s", strerror(errno));
         return Result::ERROR_GENERIC;
     }
 
+    m_modeset_done = true;
     m_page_flip_pending = true;
+    m_stats.frames_presented++;
 
-    // Wait for flip to complete
-    drmEventContext ev_ctx = {};
-    ev_ctx.version = DRM_EVENT_CONTEXT_VERSION;
-    ev_ctx.page_flip_handler = pageFlipHandler;
+    if (out_fence_fd) {
+        *out_fence_fd = (int)out_fence;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result DRMDisplay::waitFlipComplete(int timeout_ms) {
+    if (!m_page_flip_pending) {
+        return Result::SUCCESS;
+    }
+
+    // Serialize against the event loop; it may have reaped the flip
+    // between the check above and here
+    std::lock_guard<std::mutex> lock(m_event_mutex);
+    if (!m_page_flip_pending) {
+        return Result::SUCCESS;
+    }
 
     struct pollfd fds = {};
     fds.fd = m_drm_fd;
     fds.events = POLLIN;
 
-    ret = poll(&fds, 1, 1000);  // 1 second timeout
+    int ret = poll(&fds, 1, timeout_ms);
     if (ret < 0) {
         LOG_ERROR("Display", "Poll failed: %s", strerror(errno));
-        m_page_flip_pending = false;
         return Result::ERROR_GENERIC;
     }
-
     if (ret == 0) {
-        LOG_ERROR("Display", "Page flip timeout");
-        m_page_flip_pending = false;
-        m_stats.missed_vblanks++;
         return Result::ERROR_TIMEOUT;
     }
 
+    drmEventContext ev_ctx = {};
+    ev_ctx.version = DRM_EVENT_CONTEXT_VERSION;
+    ev_ctx.page_flip_handler = pageFlipHandler;
     drmHandleEvent(m_drm_fd, &ev_ctx);
+
     m_page_flip_pending = false;
+    return Result::SUCCESS;
+}
+
+Result DRMDisplay::pageFlip(uint32_t fb_id, void* user_data) {
+    if (!m_initialized) {
+        LOG_ERROR("Display", "Display not initialized");
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+
+    if (m_page_flip_pending) {
+        LOG_WARN("Display", "Page flip already pending");
+        return Result::ERROR_BUSY;
+    }
+
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    // Perform page flip; the event handler needs `this` to record the
+    // kernel's completion timestamp
+    (void)user_data;
+    int ret = drmModePageFlip(m_drm_fd, m_crtc_id, fb_id,
+                             DRM_MODE_PAGE_FLIP_EVENT, this);
+
+    if (ret != 0) {
+        LOG_ERROR("Display", "Page flip failed: %s", strerror(errno));
+        return Result::ERROR_GENERIC;
+    }
+
+    m_page_flip_pending = true;
+
+    // Wait for flip to complete (reap shared with the event loop)
+    Result wait_result = waitFlipComplete(1000);
+    if (wait_result == Result::ERROR_TIMEOUT) {
+        LOG_ERROR("Display", "Page flip timeout");
+        m_page_flip_pending = false;
+        m_stats.missed_vblanks++;
+        return Result::ERROR_TIMEOUT;
+    }
+    if (wait_result != Result::SUCCESS) {
+        m_page_flip_pending = false;
+        return wait_result;
+    }
 
     // Update statistics
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -408,7 +1011,26 @@ Result DRMDisplay::pageFlip(uint32_t fb_id, void* user_data) {
 void DRMDisplay::pageFlipHandler(int fd, unsigned int sequence,
                                  unsigned int tv_sec, unsigned int tv_usec,
                                  void* user_data) {
-    // Page flip completed
+    (void)fd;
+
+    DRMDisplay* self = (DRMDisplay*)user_data;
+    if (!self) {
+        return;
+    }
+
+    // The kernel timestamps the vblank the flip landed on with
+    // CLOCK_MONOTONIC, which is steady_clock's epoch on Linux — convert
+    // directly into our Timestamp domain
+    auto since_epoch = std::chrono::seconds(tv_sec) + std::chrono::microseconds(tv_usec);
+    self->m_last_flip.sequence = sequence;
+    self->m_last_flip.flip_time = Timestamp(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(since_epoch));
+    self->m_last_flip.valid = true;
+
+    if (self->m_flip_callback) {
+        self->m_flip_callback(self->m_last_flip);
+    }
+
     LOG_DEBUG("Display", "Page flip complete (sequence: %u)", sequence);
 }
 
@@ -439,6 +1061,22 @@ void DRMDisplay::shutdown() {
 
     LOG_INFO("Display", "Shutting down DRM display");
 
+    // Drain any queued atomic flip before tearing state down
+    if (m_page_flip_pending) {
+        waitFlipComplete(100);
+    }
+
+    disableOverlayPlane();
+    m_overlay_plane_id = 0;
+
+    if (m_mode_blob_id != 0) {
+        drmModeDestroyPropertyBlob(m_drm_fd, m_mode_blob_id);
+        m_mode_blob_id = 0;
+    }
+    m_atomic_supported = false;
+    m_modeset_done = false;
+    m_plane_id = 0;
+
     // Restore saved CRTC
     if (m_saved_crtc && m_drm_fd >= 0) {
         drmModeSetCrtc(m_drm_fd, m_saved_crtc->crtc_id, m_saved_crtc->buffer_id,
@@ -2,10 +2,14 @@
 
 #include <ares/types.h>
 #include <ares/display_config.h>
+#include "edid_parser.h"
 #include <xf86drm.h>
 #include <xf86drmMode.h>
 #include <vector>
 #include <string>
+#include <functional>
+#include <atomic>
+#include <mutex>
 
 namespace ares {
 namespace display {
@@ -78,14 +82,77 @@ public:
 
     Result parseEDID(EDIDInfo& edid_info) const;
 
+    // Parsed EDID capabilities, resolved during initialize() through
+    // the on-disk cache (fresh parse only when the EDID blob changed)
+    bool hasEDIDCapabilities() const { return m_edid_caps_valid; }
+    const EDIDCapabilities& getEDIDCapabilities() const { return m_edid_caps; }
+
     // Mode management
     Result setMode(const DisplayMode& mode);
+
+    // Fast-path refresh switch: atomically commit the new mode's timing
+    // WITHOUT allowing a full modeset. Requires the same resolution as
+    // the current mode. Drivers that can retime vertical blanking while
+    // keeping the link up accept it and the screen never blanks; when
+    // the driver rejects the test commit this returns ERROR_NOT_FOUND
+    // and the caller falls back to a full setMode
+    Result setModeSeamless(const DisplayMode& mode);
     DisplayMode getCurrentMode() const { return m_current_mode; }
     std::vector<DisplayMode> getAvailableModes() const;
 
-    // Page flip (present frame)
+    // Page flip (present frame) — legacy blocking path
     Result pageFlip(uint32_t fb_id, void* user_data = nullptr);
 
+    // Atomic page flip: non-blocking commit of the next framebuffer so
+    // the main loop can keep working until the flip lands at vblank.
+    // in_fence_fd (-1 = none) makes scanout wait on the GPU's completion
+    // fence instead of the CPU blocking; on success *out_fence_fd (when
+    // requested and supported) receives a fence that signals when the
+    // new frame reaches the screen. The caller keeps ownership of
+    // in_fence_fd and owns the returned out fence.
+    // Falls back to the legacy pageFlip when atomic is unsupported.
+    Result atomicFlip(uint32_t fb_id, int in_fence_fd = -1, int* out_fence_fd = nullptr);
+
+    // Reap a queued atomic flip's completion event (0 = just poll)
+    Result waitFlipComplete(int timeout_ms);
+
+    bool isAtomicSupported() const { return m_atomic_supported; }
+    bool isFlipPending() const { return m_page_flip_pending; }
+
+    // Variable refresh rate: when the connector reports vrr_capable, the
+    // VRR_ENABLED CRTC property lets scanout start as soon as a flip is
+    // committed (within the display's refresh window) instead of on the
+    // fixed vblank grid. Takes effect on the next atomic commit.
+    Result setVRREnabled(bool enabled);
+    bool isVRRCapable() const { return m_vrr_capable; }
+    bool isVRREnabled() const { return m_vrr_enabled; }
+
+    // Overlay plane above the video plane (for the OSD). Commits are
+    // independent of the primary flips, so showing/moving/hiding the
+    // overlay costs the video path nothing. src is the full fb; the
+    // crtc rect positions and (optionally) scales it on screen
+    Result setOverlayPlane(uint32_t fb_id, uint32_t src_width, uint32_t src_height,
+                           int32_t crtc_x, int32_t crtc_y,
+                           uint32_t crtc_w, uint32_t crtc_h);
+    Result disableOverlayPlane();
+    bool hasOverlayPlane() const { return m_overlay_plane_id != 0; }
+
+    // Page-flip completion data from the kernel: the vblank sequence the
+    // flip landed on and its CLOCK_MONOTONIC timestamp — the moment the
+    // frame actually started scanning out
+    struct FlipTimestamp {
+        uint32_t sequence = 0;
+        Timestamp flip_time = {};
+        bool valid = false;
+    };
+    FlipTimestamp getLastFlipTimestamp() const { return m_last_flip; }
+
+    // Invoked from the flip-event reap (waitFlipComplete / pageFlip)
+    // whenever a flip completes; used to feed present timestamps back
+    // into the frame scheduler
+    using FlipCallback = std::function<void(const FlipTimestamp&)>;
+    void setFlipCallback(FlipCallback callback) { m_flip_callback = std::move(callback); }
+
     // Wait for vblank
     Result waitForVBlank();
 
@@ -110,6 +177,10 @@ private:
     Result openDrmDevice(const std::string& card);
     Result findConnector(const std::string& connector_name);
     Result findEncoder();
+
+    // Fetch the connector's EDID blob and resolve capabilities through
+    // the EDIDCache (parse only when the blob hash changed)
+    void loadDisplayCapabilities();
     Result findCrtc();
     Result selectMode(const DisplayMode& requested_mode);
     Result setModeInternal();
@@ -118,6 +189,15 @@ private:
     bool modesMatch(const drmModeModeInfo& a, const DisplayMode& b) const;
     DisplayMode convertDrmMode(const drmModeModeInfo& drm_mode) const;
 
+    // Atomic modesetting helpers
+    Result initAtomic();
+    Result findPrimaryPlane();
+    Result findOverlayPlane();
+    uint32_t getPropertyId(uint32_t object_id, uint32_t object_type,
+                           const char* name) const;
+    uint64_t getPropertyValue(uint32_t object_id, uint32_t object_type,
+                              const char* name) const;
+
     // Page flip callback
     static void pageFlipHandler(int fd, unsigned int sequence,
                                unsigned int tv_sec, unsigned int tv_usec,
@@ -140,15 +220,64 @@ private:
     drmModeModeInfo m_drm_mode = {};
     DisplayMode m_current_mode;
 
+    // Atomic modesetting state
+    // Property IDs are looked up once at init; 0 means the driver does
+    // not expose the property (IN_FENCE_FD/OUT_FENCE_PTR are optional)
+    struct PlaneProps {
+        uint32_t fb_id = 0;
+        uint32_t crtc_id = 0;
+        uint32_t src_x = 0, src_y = 0, src_w = 0, src_h = 0;
+        uint32_t crtc_x = 0, crtc_y = 0, crtc_w = 0, crtc_h = 0;
+        uint32_t in_fence_fd = 0;
+    };
+    struct CrtcProps {
+        uint32_t mode_id = 0;
+        uint32_t active = 0;
+        uint32_t out_fence_ptr = 0;
+        uint32_t vrr_enabled = 0;
+    };
+    struct ConnectorProps {
+        uint32_t crtc_id = 0;
+    };
+
+    uint32_t m_plane_id = 0;          // primary plane driving our CRTC
+    PlaneProps m_plane_props;
+    uint32_t m_overlay_plane_id = 0;  // ARGB overlay above the video (0 = none)
+    PlaneProps m_overlay_props;
+    bool m_overlay_active = false;
+    CrtcProps m_crtc_props;
+    ConnectorProps m_connector_props;
+    uint32_t m_mode_blob_id = 0;      // property blob for the current mode
+    bool m_atomic_supported = false;
+    bool m_modeset_done = false;      // first commit carries the full mode
+
+    // VRR state
+    bool m_vrr_capable = false;       // connector reports vrr_capable
+    bool m_vrr_enabled = false;       // applied on every atomic commit
+
     // Configuration
     DisplayConfig m_config;
 
+    // EDID capabilities (cache-backed, see loadDisplayCapabilities)
+    EDIDCapabilities m_edid_caps;
+    std::vector<DisplayMode> m_edid_modes;
+    bool m_edid_caps_valid = false;
+
     // Statistics
     Stats m_stats;
 
+    // Flip completion feedback
+    FlipTimestamp m_last_flip;
+    FlipCallback m_flip_callback;
+
     // State
     bool m_initialized = false;
-    bool m_page_flip_pending = false;
+
+    // Flip-pending flag and the event-reap lock. The event loop reaps
+    // completed flips from its own thread, so the flag is atomic and
+    // drmHandleEvent is serialized against the frame path.
+    std::atomic<bool> m_page_flip_pending{false};
+    std::mutex m_event_mutex;
 };
 
 } // namespace display
@@ -0,0 +1,168 @@
+#include "edid_cache.h"
+#include "core/logger.h"
+#include <fstream>
+#include <cstring>
+
+namespace ares {
+namespace display {
+
+namespace {
+
+// Bump when the serialized layout changes
+constexpr uint32_t CACHE_MAGIC = 0x43444541;  // "AEDC"
+constexpr uint32_t CACHE_VERSION = 1;
+
+// Lives next to the placebo shader cache
+const char* CACHE_DIR = "/etc/ares/";
+
+void writeString(std::ofstream& out, const std::string& s) {
+    uint32_t len = (uint32_t)s.size();
+    out.write(reinterpret_cast<const char*>(&len), sizeof(len));
+    out.write(s.data(), len);
+}
+
+bool readString(std::ifstream& in, std::string& s) {
+    uint32_t len = 0;
+    in.read(reinterpret_cast<char*>(&len), sizeof(len));
+    if (!in || len > 4096) {
+        return false;
+    }
+    s.resize(len);
+    in.read(s.data(), len);
+    return (bool)in;
+}
+
+template <typename T>
+void writePod(std::ofstream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readPod(std::ifstream& in, T& value) {
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return (bool)in;
+}
+
+} // namespace
+
+uint64_t EDIDCache::hashEDID(const uint8_t* data, size_t size) {
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string EDIDCache::cachePath(const std::string& connector) {
+    return std::string(CACHE_DIR) + "edid-" + connector + ".cache";
+}
+
+Result EDIDCache::load(const std::string& connector, uint64_t edid_hash,
+                       EDIDCapabilities& caps, std::vector<DisplayMode>& modes) {
+    std::ifstream in(cachePath(connector), std::ios::binary);
+    if (!in) {
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    uint32_t magic = 0, version = 0;
+    uint64_t stored_hash = 0;
+    if (!readPod(in, magic) || !readPod(in, version) || !readPod(in, stored_hash)) {
+        return Result::ERROR_INVALID_DATA;
+    }
+    if (magic != CACHE_MAGIC || version != CACHE_VERSION) {
+        return Result::ERROR_INVALID_DATA;
+    }
+    if (stored_hash != edid_hash) {
+        // EDID changed since the cache was written
+        LOG_INFO("Display", "EDID cache for %s is stale, re-parsing", connector.c_str());
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    if (!readString(in, caps.manufacturer) || !readString(in, caps.model_name)) {
+        return Result::ERROR_INVALID_DATA;
+    }
+    if (!readPod(in, caps.serial_number) ||
+        !readPod(in, caps.manufacture_year) ||
+        !readPod(in, caps.manufacture_week) ||
+        !readPod(in, caps.supports_hdr10) ||
+        !readPod(in, caps.supports_dolby_vision) ||
+        !readPod(in, caps.supports_hlg) ||
+        !readPod(in, caps.max_luminance) ||
+        !readPod(in, caps.max_frame_avg_luminance) ||
+        !readPod(in, caps.min_luminance) ||
+        !readPod(in, caps.supports_bt2020) ||
+        !readPod(in, caps.supports_dcip3) ||
+        !readPod(in, caps.supports_vrr) ||
+        !readPod(in, caps.vrr_min_refresh) ||
+        !readPod(in, caps.vrr_max_refresh)) {
+        return Result::ERROR_INVALID_DATA;
+    }
+
+    uint32_t mode_count = 0;
+    if (!readPod(in, mode_count) || mode_count > 256) {
+        return Result::ERROR_INVALID_DATA;
+    }
+    modes.resize(mode_count);
+    for (uint32_t i = 0; i < mode_count; i++) {
+        if (!readPod(in, modes[i])) {
+            modes.clear();
+            return Result::ERROR_INVALID_DATA;
+        }
+    }
+
+    LOG_INFO("Display", "Loaded EDID capabilities for %s from cache (%u modes)",
+             connector.c_str(), mode_count);
+    return Result::SUCCESS;
+}
+
+Result EDIDCache::store(const std::string& connector, uint64_t edid_hash,
+                        const EDIDCapabilities& caps,
+                        const std::vector<DisplayMode>& modes) {
+    std::ofstream out(cachePath(connector), std::ios::binary | std::ios::trunc);
+    if (!out) {
+        LOG_WARN("Display", "Failed to write EDID cache for %s (continuing)",
+                 connector.c_str());
+        return Result::ERROR_WRITE_FAILED;
+    }
+
+    writePod(out, CACHE_MAGIC);
+    writePod(out, CACHE_VERSION);
+    writePod(out, edid_hash);
+
+    writeString(out, caps.manufacturer);
+    writeString(out, caps.model_name);
+    writePod(out, caps.serial_number);
+    writePod(out, caps.manufacture_year);
+    writePod(out, caps.manufacture_week);
+    writePod(out, caps.supports_hdr10);
+    writePod(out, caps.supports_dolby_vision);
+    writePod(out, caps.supports_hlg);
+    writePod(out, caps.max_luminance);
+    writePod(out, caps.max_frame_avg_luminance);
+    writePod(out, caps.min_luminance);
+    writePod(out, caps.supports_bt2020);
+    writePod(out, caps.supports_dcip3);
+    writePod(out, caps.supports_vrr);
+    writePod(out, caps.vrr_min_refresh);
+    writePod(out, caps.vrr_max_refresh);
+
+    uint32_t mode_count = (uint32_t)modes.size();
+    writePod(out, mode_count);
+    for (const auto& mode : modes) {
+        writePod(out, mode);
+    }
+
+    if (!out) {
+        LOG_WARN("Display", "Short write on EDID cache for %s", connector.c_str());
+        return Result::ERROR_WRITE_FAILED;
+    }
+
+    LOG_INFO("Display", "Cached EDID capabilities for %s (%u modes)",
+             connector.c_str(), mode_count);
+    return Result::SUCCESS;
+}
+
+} // namespace display
+} // namespace ares
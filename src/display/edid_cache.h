@@ -0,0 +1,40 @@
+#pragma once
+
+#include <ares/types.h>
+#include <ares/display_config.h>
+#include "edid_parser.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace ares {
+namespace display {
+
+// Persisted display-capability cache. The attached projector's EDID
+// never changes between boots, so the parsed capabilities and mode
+// list are stored on disk keyed by connector name + EDID hash; a warm
+// startup skips the EDID parse entirely and only falls back to the
+// parser when the blob actually differs (new display, firmware update).
+class EDIDCache {
+public:
+    // Look up cached capabilities for this connector. Fails with
+    // ERROR_NOT_FOUND when there is no entry or the stored hash does
+    // not match the current EDID blob (stale cache).
+    static Result load(const std::string& connector, uint64_t edid_hash,
+                       EDIDCapabilities& caps, std::vector<DisplayMode>& modes);
+
+    // Persist freshly parsed capabilities (best effort, like the
+    // placebo shader cache: failure to write is not an error)
+    static Result store(const std::string& connector, uint64_t edid_hash,
+                        const EDIDCapabilities& caps,
+                        const std::vector<DisplayMode>& modes);
+
+    // FNV-1a hash of the raw EDID blob (the invalidation key)
+    static uint64_t hashEDID(const uint8_t* data, size_t size);
+
+private:
+    static std::string cachePath(const std::string& connector);
+};
+
+} // namespace display
+} // namespace ares
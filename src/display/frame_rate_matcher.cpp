@@ -14,10 +14,48 @@ Result FrameRateMatcher::initialize(DRMDisplay* display, capture::DeckLinkCaptur
     m_display = display;
     m_capture = capture;
 
-    LOG_INFO("Display", "Frame rate matcher initialized");
+    buildModeCache();
+
+    LOG_INFO("Display", "Frame rate matcher initialized (%zu cached rate candidates)",
+             m_mode_cache.size());
     return Result::SUCCESS;
 }
 
+void FrameRateMatcher::buildModeCache() {
+    // Every source rate the capture side can report; precomputing the
+    // answers here makes update() a table lookup instead of a mode scan
+    static const double kSourceRates[] = {
+        23.976, 24.0, 25.0, 29.97, 30.0, 47.952, 48.0,
+        50.0, 59.94, 60.0, 100.0, 119.88, 120.0
+    };
+
+    auto current = m_display->getCurrentMode();
+
+    m_mode_cache.clear();
+    for (double fps : kSourceRates) {
+        RateCandidate candidate;
+        candidate.source_fps = fps;
+        candidate.mode = findBestMatch(fps);
+        if (candidate.mode.refresh_rate == 0.0f) {
+            continue;
+        }
+        // Same resolution as the active mode: a cadence change to this
+        // rate can retime the refresh without dropping the HDMI link
+        candidate.seamless = candidate.mode.width == current.width &&
+                             candidate.mode.height == current.height;
+        m_mode_cache.push_back(candidate);
+    }
+}
+
+const FrameRateMatcher::RateCandidate* FrameRateMatcher::lookupRate(double source_fps) const {
+    for (const auto& candidate : m_mode_cache) {
+        if (std::abs(candidate.source_fps - source_fps) < 0.05) {
+            return &candidate;
+        }
+    }
+    return nullptr;
+}
+
 Result FrameRateMatcher::update() {
     if (!m_enabled || !m_display || !m_capture) {
         return Result::SUCCESS;
@@ -51,8 +89,10 @@ Result FrameRateMatcher::update() {
         return Result::SUCCESS;
     }
 
-    // Find best matching mode
-    DisplayMode best_mode = findBestMatch(detected_fps);
+    // Single table lookup decides both the target mode and whether the
+    // seamless path applies; only off-table rates fall back to a scan
+    const RateCandidate* candidate = lookupRate(detected_fps);
+    DisplayMode best_mode = candidate ? candidate->mode : findBestMatch(detected_fps);
     if (best_mode.refresh_rate == 0.0f) {
         LOG_WARN("Display", "No suitable display mode found for %.3f fps", detected_fps);
         m_stats.mode_matched = false;
@@ -63,7 +103,29 @@ Result FrameRateMatcher::update() {
     LOG_INFO("Display", "Switching display mode: %.3f fps → %.2f Hz (source: %.3f fps)",
              m_display->getCurrentMode().refresh_rate, best_mode.refresh_rate, detected_fps);
 
-    Result result = m_display->setMode(best_mode);
+    // Refresh-only change: try retiming without dropping the link first
+    // (a full modeset blanks the projector for seconds while HDMI
+    // resyncs); fall back to the normal path when the driver refuses
+    Result result = Result::ERROR_NOT_FOUND;
+    auto current = m_display->getCurrentMode();
+    bool try_seamless = candidate
+        ? candidate->seamless
+        : (best_mode.width == current.width && best_mode.height == current.height);
+    if (try_seamless) {
+        result = m_display->setModeSeamless(best_mode);
+        if (result == Result::SUCCESS) {
+            m_stats.seamless_switches++;
+        }
+    }
+    if (result != Result::SUCCESS) {
+        result = m_display->setMode(best_mode);
+        // A full modeset may have changed the resolution the seamless
+        // flags were computed against
+        if (result == Result::SUCCESS &&
+            (best_mode.width != current.width || best_mode.height != current.height)) {
+            buildModeCache();
+        }
+    }
     if (result == Result::SUCCESS) {
         m_stats.mode_switches++;
         m_stats.current_display_refresh = best_mode.refresh_rate;
@@ -88,6 +150,11 @@ DisplayMode FrameRateMatcher::findBestMatch(double source_fps) const {
         return DisplayMode{};
     }
 
+    // Cached answer for a known source rate
+    if (const RateCandidate* candidate = lookupRate(source_fps)) {
+        return candidate->mode;
+    }
+
     auto available_modes = m_display->getAvailableModes();
     if (available_modes.empty()) {
         return DisplayMode{};
@@ -32,6 +32,7 @@ public:
     // Statistics
     struct Stats {
         uint64_t mode_switches = 0;
+        uint64_t seamless_switches = 0;  // refresh retimed without a modeset
         double current_source_fps = 0.0;
         float current_display_refresh = 0.0f;
         bool mode_matched = false;
@@ -48,6 +49,10 @@ private:
     // Check if current mode matches source
     bool isCurrentModeOptimal(double source_fps) const;
 
+    // Precompute the best mode for every common source rate so update()
+    // never walks the full mode list on a cadence change
+    void buildModeCache();
+
     DRMDisplay* m_display = nullptr;
     capture::DeckLinkCapture* m_capture = nullptr;
 
@@ -55,6 +60,20 @@ private:
     double m_last_detected_fps = 0.0;
     bool m_last_was_stable = false;
 
+    // source rate -> best display mode, built at init. The seamless
+    // flag records whether the switch keeps the current resolution and
+    // can go through setModeSeamless (no link retrain), so update()
+    // decides both target and path with a single lookup.
+    struct RateCandidate {
+        double source_fps;
+        DisplayMode mode;
+        bool seamless = false;
+    };
+    std::vector<RateCandidate> m_mode_cache;
+
+    // Table lookup for a detected rate (nullptr when off-table)
+    const RateCandidate* lookupRate(double source_fps) const;
+
     Stats m_stats;
 };
 
@@ -0,0 +1,191 @@
+#include "osd_plane.h"
+#include "core/logger.h"
+#include <drm_fourcc.h>
+#include <sys/mman.h>
+#include <cstring>
+#include <cerrno>
+
+namespace ares {
+namespace display {
+
+OSDPlane::~OSDPlane() {
+    shutdown();
+}
+
+Result OSDPlane::initialize(DRMDisplay* display, uint32_t width, uint32_t height) {
+    if (!display || width == 0 || height == 0) {
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
+    if (!display->hasOverlayPlane()) {
+        LOG_INFO("Display", "No overlay plane available, OSD plane disabled");
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    m_display = display;
+    m_width = width;
+    m_height = height;
+
+    for (size_t i = 0; i < BUFFER_COUNT; i++) {
+        Result result = createBuffer(m_buffers[i]);
+        if (result != Result::SUCCESS) {
+            shutdown();
+            return result;
+        }
+    }
+
+    m_initialized = true;
+    LOG_INFO("Display", "OSD plane initialized: %ux%u ARGB, %zu buffers",
+             width, height, BUFFER_COUNT);
+    return Result::SUCCESS;
+}
+
+void OSDPlane::shutdown() {
+    if (m_visible && m_display) {
+        m_display->disableOverlayPlane();
+        m_visible = false;
+    }
+
+    for (size_t i = 0; i < BUFFER_COUNT; i++) {
+        destroyBuffer(m_buffers[i]);
+    }
+
+    m_display = nullptr;
+    m_initialized = false;
+}
+
+Result OSDPlane::update(const uint8_t* argb_data, size_t size,
+                        int32_t crtc_x, int32_t crtc_y) {
+    if (!m_initialized) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+    if (!argb_data) {
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
+    PlaneBuffer& buffer = m_buffers[m_back_buffer];
+
+    // Cairo surfaces are tightly packed; the dumb buffer may have row
+    // padding, so copy per row when the pitches differ
+    const size_t src_pitch = (size_t)m_width * 4;
+    if (size < src_pitch * m_height) {
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
+    if (buffer.pitch == src_pitch) {
+        std::memcpy(buffer.map, argb_data, src_pitch * m_height);
+    } else {
+        for (uint32_t y = 0; y < m_height; y++) {
+            std::memcpy(buffer.map + (size_t)y * buffer.pitch,
+                        argb_data + (size_t)y * src_pitch, src_pitch);
+        }
+    }
+
+    Result result = m_display->setOverlayPlane(buffer.fb_id, m_width, m_height,
+                                               crtc_x, crtc_y, m_width, m_height);
+    if (result != Result::SUCCESS) {
+        return result;
+    }
+
+    if (!m_visible) {
+        m_visible = true;
+        m_stats.shows++;
+    }
+    m_stats.updates++;
+    m_back_buffer = (m_back_buffer + 1) % BUFFER_COUNT;
+
+    return Result::SUCCESS;
+}
+
+Result OSDPlane::hide() {
+    if (!m_initialized) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+    if (!m_visible) {
+        return Result::SUCCESS;
+    }
+
+    Result result = m_display->disableOverlayPlane();
+    if (result == Result::SUCCESS) {
+        m_visible = false;
+        m_stats.hides++;
+    }
+    return result;
+}
+
+Result OSDPlane::createBuffer(PlaneBuffer& buffer) {
+    int drm_fd = m_display->getDrmFd();
+
+    struct drm_mode_create_dumb create = {};
+    create.width = m_width;
+    create.height = m_height;
+    create.bpp = 32;
+
+    if (drmIoctl(drm_fd, DRM_IOCTL_MODE_CREATE_DUMB, &create) != 0) {
+        LOG_ERROR("Display", "Failed to create dumb buffer: %s", strerror(errno));
+        return Result::ERROR_OUT_OF_MEMORY;
+    }
+
+    buffer.handle = create.handle;
+    buffer.pitch = create.pitch;
+    buffer.size = create.size;
+
+    uint32_t handles[4] = { buffer.handle, 0, 0, 0 };
+    uint32_t pitches[4] = { buffer.pitch, 0, 0, 0 };
+    uint32_t offsets[4] = { 0, 0, 0, 0 };
+
+    if (drmModeAddFB2(drm_fd, m_width, m_height, DRM_FORMAT_ARGB8888,
+                      handles, pitches, offsets, &buffer.fb_id, 0) != 0) {
+        LOG_ERROR("Display", "drmModeAddFB2 failed for OSD buffer: %s", strerror(errno));
+        destroyBuffer(buffer);
+        return Result::ERROR_GENERIC;
+    }
+
+    struct drm_mode_map_dumb map = {};
+    map.handle = buffer.handle;
+    if (drmIoctl(drm_fd, DRM_IOCTL_MODE_MAP_DUMB, &map) != 0) {
+        LOG_ERROR("Display", "Failed to map dumb buffer: %s", strerror(errno));
+        destroyBuffer(buffer);
+        return Result::ERROR_GENERIC;
+    }
+
+    buffer.map = (uint8_t*)mmap(nullptr, buffer.size, PROT_READ | PROT_WRITE,
+                                MAP_SHARED, drm_fd, map.offset);
+    if (buffer.map == MAP_FAILED) {
+        buffer.map = nullptr;
+        LOG_ERROR("Display", "mmap of dumb buffer failed: %s", strerror(errno));
+        destroyBuffer(buffer);
+        return Result::ERROR_GENERIC;
+    }
+
+    return Result::SUCCESS;
+}
+
+void OSDPlane::destroyBuffer(PlaneBuffer& buffer) {
+    if (!m_display) {
+        buffer = PlaneBuffer{};
+        return;
+    }
+
+    int drm_fd = m_display->getDrmFd();
+
+    if (buffer.map) {
+        munmap(buffer.map, buffer.size);
+        buffer.map = nullptr;
+    }
+
+    if (buffer.fb_id != 0) {
+        drmModeRmFB(drm_fd, buffer.fb_id);
+        buffer.fb_id = 0;
+    }
+
+    if (buffer.handle != 0) {
+        struct drm_mode_destroy_dumb destroy = {};
+        destroy.handle = buffer.handle;
+        drmIoctl(drm_fd, DRM_IOCTL_MODE_DESTROY_DUMB, &destroy);
+        buffer.handle = 0;
+    }
+}
+
+} // namespace display
+} // namespace ares
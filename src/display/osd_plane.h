@@ -0,0 +1,79 @@
+#pragma once
+
+#include <ares/types.h>
+#include "drm_display.h"
+
+namespace ares {
+namespace display {
+
+// OSD on a hardware overlay plane
+// Double-buffered ARGB dumb buffers scanned out on a DRM overlay plane
+// above the video plane. Showing, moving or hiding the OSD is a plane
+// commit only — the video path does zero extra work while the menu is
+// up, instead of copying and re-compositing every frame.
+class OSDPlane {
+public:
+    OSDPlane() = default;
+    ~OSDPlane();
+
+    // Initialize with an overlay-capable display and the OSD surface size
+    Result initialize(DRMDisplay* display, uint32_t width, uint32_t height);
+
+    // Cleanup
+    void shutdown();
+
+    bool isInitialized() const { return m_initialized; }
+
+    // Upload a new OSD surface (Cairo ARGB32, premultiplied — the same
+    // memory layout as DRM_FORMAT_ARGB8888 on little endian) into the
+    // back buffer and flip the overlay to it at the given position
+    Result update(const uint8_t* argb_data, size_t size,
+                  int32_t crtc_x = 0, int32_t crtc_y = 0);
+
+    // Take the overlay off screen (buffers stay allocated)
+    Result hide();
+
+    bool isVisible() const { return m_visible; }
+
+    uint32_t getWidth() const { return m_width; }
+    uint32_t getHeight() const { return m_height; }
+
+    // Statistics
+    struct Stats {
+        uint64_t updates = 0;
+        uint64_t shows = 0;
+        uint64_t hides = 0;
+    };
+
+    Stats getStats() const { return m_stats; }
+
+private:
+    // One dumb buffer + its framebuffer object
+    struct PlaneBuffer {
+        uint32_t handle = 0;
+        uint32_t pitch = 0;
+        uint64_t size = 0;
+        uint32_t fb_id = 0;
+        uint8_t* map = nullptr;
+    };
+
+    Result createBuffer(PlaneBuffer& buffer);
+    void destroyBuffer(PlaneBuffer& buffer);
+
+    DRMDisplay* m_display = nullptr;
+
+    static constexpr size_t BUFFER_COUNT = 2;
+    PlaneBuffer m_buffers[BUFFER_COUNT];
+    size_t m_back_buffer = 0;
+
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+
+    Stats m_stats;
+
+    bool m_initialized = false;
+    bool m_visible = false;
+};
+
+} // namespace display
+} // namespace ares
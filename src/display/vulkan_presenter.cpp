@@ -1,4 +1,5 @@
 #include "vulkan_presenter.h"
+#include "processing/placebo_renderer.h"
 #include "core/logger.h"
 #include <chrono>
 #include <cstring>
@@ -73,6 +74,11 @@ Result VulkanPresenter::initialize(processing::VulkanContext* vk_context,
         return result;
     }
 
+    // Per-pass GPU timing for the presenter's transfer passes (resolved
+    // asynchronously a few frames behind; see VulkanContext)
+    m_gpu_upload_timer = m_vk_context->createGpuTimer("present_upload");
+    m_gpu_blit_timer = m_vk_context->createGpuTimer("present_blit");
+
     m_initialized = true;
     LOG_INFO("Display", "Vulkan presenter initialized successfully");
     LOG_INFO("Display", "Buffers: %zu (triple buffering)", m_buffers.size());
@@ -125,7 +131,10 @@ Result VulkanPresenter::createVulkanImages() {
         image_info.arrayLayers = 1;
         image_info.samples = VK_SAMPLE_COUNT_1_BIT;
         image_info.tiling = VK_IMAGE_TILING_LINEAR;  // LINEAR for DMA-BUF export
-        image_info.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+        // COLOR_ATTACHMENT so the renderer's final pass can target the
+        // scanout image directly (see attachRenderer)
+        image_info.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
+                           VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
         image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
         image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
 
@@ -283,6 +292,52 @@ Result VulkanPresenter::createCommandBuffers() {
     return Result::SUCCESS;
 }
 
+Result VulkanPresenter::attachRenderer(processing::PlaceboRenderer* renderer) {
+    if (!m_initialized) {
+        LOG_ERROR("Display", "Presenter not initialized");
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+
+    if (!renderer) {
+        LOG_ERROR("Display", "Invalid renderer");
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
+    // Wrap every scanout image as a libplacebo render target; any
+    // failure means falling back to the upload/blit path for all of them
+    for (auto& buffer : m_buffers) {
+        pl_tex target = renderer->wrapDisplayImage(buffer.image,
+                                                   buffer.width, buffer.height);
+        if (!target) {
+            LOG_WARN("Display", "Direct scanout unavailable, keeping upload/blit path");
+            for (auto& b : m_buffers) {
+                pl_tex tex = (pl_tex)b.render_target;
+                renderer->releaseWrappedImage(tex);
+                b.render_target = nullptr;
+            }
+            return Result::ERROR_GENERIC;
+        }
+        buffer.render_target = (void*)target;
+    }
+
+    m_renderer = renderer;
+    m_direct_scanout = true;
+
+    // Arm the renderer at the current buffer; swapBuffers re-arms after
+    // every flip
+    armRenderTarget();
+
+    LOG_INFO("Display", "Direct render-to-scanout enabled (%zu targets)",
+             m_buffers.size());
+    return Result::SUCCESS;
+}
+
+void VulkanPresenter::armRenderTarget() {
+    if (m_renderer && m_current_buffer < m_buffers.size()) {
+        m_renderer->setRenderTarget((pl_tex)m_buffers[m_current_buffer].render_target);
+    }
+}
+
 Result VulkanPresenter::presentFrame(const VideoFrame& frame) {
     if (!m_initialized) {
         LOG_ERROR("Display", "Presenter not initialized");
@@ -291,6 +346,25 @@ Result VulkanPresenter::presentFrame(const VideoFrame& frame) {
 
     auto start_time = std::chrono::high_resolution_clock::now();
 
+    // Direct scanout: the renderer's final pass already wrote this
+    // buffer's image, so there is nothing to upload or blit — just flip
+    if (m_direct_scanout && frame.gpu_tex &&
+        frame.gpu_tex == m_buffers[m_current_buffer].render_target) {
+        Result result = swapBuffers();
+        if (result != Result::SUCCESS) {
+            return result;
+        }
+
+        auto end_time = std::chrono::high_resolution_clock::now();
+        auto elapsed = std::chrono::duration<double, std::milli>(end_time - start_time);
+        m_stats.last_present_time_ms = elapsed.count();
+        m_stats.frames_presented++;
+        m_stats.avg_present_time_ms =
+            (m_stats.avg_present_time_ms * (m_stats.frames_presented - 1) +
+             m_stats.last_present_time_ms) / m_stats.frames_presented;
+        return Result::SUCCESS;
+    }
+
     // Upload frame to GPU
     Result result = uploadFrameToGpu(frame, m_current_buffer);
     if (result != Result::SUCCESS) {
@@ -309,11 +383,14 @@ Result VulkanPresenter::presentFrame(const VideoFrame& frame) {
         return result;
     }
 
-    // Update statistics
+    // Update statistics; the GPU timings trail the passes they measure
+    // by a few frames (asynchronous timestamp resolution)
     auto end_time = std::chrono::high_resolution_clock::now();
     auto elapsed = std::chrono::duration<double, std::milli>(end_time - start_time);
 
     m_stats.last_present_time_ms = elapsed.count();
+    m_stats.gpu_upload_ms = m_vk_context->getGpuTimerMs(m_gpu_upload_timer);
+    m_stats.gpu_blit_ms = m_vk_context->getGpuTimerMs(m_gpu_blit_timer);
     m_stats.frames_presented++;
 
     if (m_stats.frames_presented == 1) {
@@ -389,6 +466,8 @@ Result VulkanPresenter::uploadFrameToGpu(const VideoFrame& frame, uint32_t buffe
     // Create one-time command buffer for upload
     VkCommandBuffer cmd_buffer = m_vk_context->beginSingleTimeCommands(m_command_pool);
 
+    m_vk_context->writeGpuTimerBegin(cmd_buffer, m_gpu_upload_timer);
+
     // Transition image layout to TRANSFER_DST_OPTIMAL
     VkImageMemoryBarrier barrier = {};
     barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -436,6 +515,8 @@ Result VulkanPresenter::uploadFrameToGpu(const VideoFrame& frame, uint32_t buffe
                         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
                         0, 0, nullptr, 0, nullptr, 1, &barrier);
 
+    m_vk_context->writeGpuTimerEnd(cmd_buffer, m_gpu_upload_timer);
+
     m_vk_context->endSingleTimeCommands(cmd_buffer, m_command_pool, m_graphics_queue);
 
     return Result::SUCCESS;
@@ -461,6 +542,8 @@ Result VulkanPresenter::blitToFramebuffer(uint32_t src_image_index, uint32_t fb_
     // Create one-time command buffer for blit
     VkCommandBuffer cmd_buffer = m_vk_context->beginSingleTimeCommands(m_command_pool);
 
+    m_vk_context->writeGpuTimerBegin(cmd_buffer, m_gpu_blit_timer);
+
     // Transition source to TRANSFER_SRC_OPTIMAL
     VkImageMemoryBarrier src_barrier = {};
     src_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
@@ -532,30 +615,59 @@ Result VulkanPresenter::blitToFramebuffer(uint32_t src_image_index, uint32_t fb_
                         VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
                         0, 0, nullptr, 0, nullptr, 1, &dst_barrier);
 
+    m_vk_context->writeGpuTimerEnd(cmd_buffer, m_gpu_blit_timer);
+
     m_vk_context->endSingleTimeCommands(cmd_buffer, m_command_pool, m_graphics_queue);
 
     return Result::SUCCESS;
 }
 
 Result VulkanPresenter::swapBuffers() {
-    // Wait for vsync if enabled
-    if (m_config.vsync) {
-        Result result = m_drm_display->waitForVBlank();
-        if (result != Result::SUCCESS) {
-            LOG_WARN("Display", "VBlank wait failed");
+    if (m_drm_display->isAtomicSupported()) {
+        // Atomic path: queue the flip non-blocking with the GPU's
+        // completion fence attached, so scanout waits on the render
+        // instead of the CPU blocking in waitForVBlank
+        if (m_buffers[m_current_buffer].fb_id != 0) {
+            int in_fence = m_vk_context->exportSyncFd();
+
+            Result result = m_drm_display->atomicFlip(
+                m_buffers[m_current_buffer].fb_id, in_fence, nullptr);
+
+            if (in_fence >= 0) {
+                close(in_fence);  // the kernel holds its own reference
+            }
+
+            if (result == Result::ERROR_BUSY) {
+                // Previous flip hasn't landed yet: running ahead of the
+                // display, drop this frame rather than stalling
+                m_stats.dropped_frames++;
+                return result;
+            }
+            if (result != Result::SUCCESS) {
+                LOG_ERROR("Display", "Atomic flip failed");
+                m_stats.dropped_frames++;
+                return result;
+            }
+        }
+    } else {
+        // Legacy path: blocking vblank wait + page flip
+        if (m_config.vsync) {
+            Result result = m_drm_display->waitForVBlank();
+            if (result != Result::SUCCESS) {
+                LOG_WARN("Display", "VBlank wait failed");
+            }
         }
-    }
 
-    // Present current buffer
-    if (m_buffers[m_current_buffer].fb_id != 0) {
-        Result result = m_drm_display->pageFlip(
-            m_buffers[m_current_buffer].fb_id,
-            nullptr);
+        if (m_buffers[m_current_buffer].fb_id != 0) {
+            Result result = m_drm_display->pageFlip(
+                m_buffers[m_current_buffer].fb_id,
+                nullptr);
 
-        if (result != Result::SUCCESS) {
-            LOG_ERROR("Display", "Page flip failed");
-            m_stats.dropped_frames++;
-            return result;
+            if (result != Result::SUCCESS) {
+                LOG_ERROR("Display", "Page flip failed");
+                m_stats.dropped_frames++;
+                return result;
+            }
         }
     }
 
@@ -563,6 +675,11 @@ Result VulkanPresenter::swapBuffers() {
     m_current_buffer = (m_current_buffer + 1) % m_buffers.size();
     m_stats.buffer_swaps++;
 
+    // Point the renderer at the buffer the next frame will scan out from
+    if (m_direct_scanout) {
+        armRenderTarget();
+    }
+
     return Result::SUCCESS;
 }
 
@@ -607,6 +724,18 @@ void VulkanPresenter::shutdown() {
         vkDeviceWaitIdle(m_device);
     }
 
+    // Release wrapped scanout render targets before their images go away
+    if (m_renderer) {
+        m_renderer->setRenderTarget(nullptr);
+        for (auto& buffer : m_buffers) {
+            pl_tex tex = (pl_tex)buffer.render_target;
+            m_renderer->releaseWrappedImage(tex);
+            buffer.render_target = nullptr;
+        }
+        m_renderer = nullptr;
+        m_direct_scanout = false;
+    }
+
     // Destroy command buffers
     if (!m_command_buffers.empty() && m_command_pool) {
         vkFreeCommandBuffers(m_device, m_command_pool,
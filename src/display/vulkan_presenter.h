@@ -9,6 +9,9 @@
 #include <vector>
 
 namespace ares {
+namespace processing {
+    class PlaceboRenderer;  // Forward declaration
+}
 namespace display {
 
 // Vulkan-based display presenter with DRM integration
@@ -29,7 +32,16 @@ public:
     // Check if initialized
     bool isInitialized() const { return m_initialized; }
 
-    // Present frame (upload VideoFrame to display)
+    // Direct render-to-scanout: wrap the scanout images as render targets
+    // so the renderer's final pass writes straight into the DRM
+    // framebuffer, eliminating the per-frame download, re-upload and blit.
+    // The renderer is re-armed at the next scanout buffer after every
+    // flip. Falls back to the upload/blit path when wrapping fails
+    Result attachRenderer(processing::PlaceboRenderer* renderer);
+    bool hasDirectScanout() const { return m_direct_scanout; }
+
+    // Present frame (upload VideoFrame to display, or flip directly when
+    // the frame was rendered into the current scanout buffer)
     Result presentFrame(const VideoFrame& frame);
 
     // Get current framebuffer for rendering
@@ -45,6 +57,11 @@ public:
         double avg_present_time_ms = 0.0;
         double last_present_time_ms = 0.0;
         uint32_t dropped_frames = 0;
+        // GPU execution time of the presenter's transfer passes
+        // (timestamp queries, resolved a few frames behind); zero on
+        // the direct-scanout path, which has neither pass
+        double gpu_upload_ms = 0.0;
+        double gpu_blit_ms = 0.0;
     };
 
     Stats getStats() const { return m_stats; }
@@ -60,6 +77,9 @@ private:
     Result uploadFrameToGpu(const VideoFrame& frame, uint32_t buffer_index);
     Result blitToFramebuffer(uint32_t src_image_index, uint32_t fb_index);
 
+    // Point the attached renderer's final pass at the current scanout buffer
+    void armRenderTarget();
+
     // DRM helpers
     uint32_t createDrmFb(uint32_t width, uint32_t height, uint32_t* handles,
                         uint32_t* pitches, uint32_t* offsets);
@@ -72,6 +92,11 @@ private:
     // DRM display (not owned)
     DRMDisplay* m_drm_display = nullptr;
 
+    // Attached renderer for direct scanout (not owned); null when
+    // presenting via the upload/blit path
+    processing::PlaceboRenderer* m_renderer = nullptr;
+    bool m_direct_scanout = false;
+
     // Configuration
     DisplayConfig m_config;
 
@@ -83,6 +108,7 @@ private:
         VkImage image = VK_NULL_HANDLE;
         VkDeviceMemory memory = VK_NULL_HANDLE;
         VkImageView view = VK_NULL_HANDLE;
+        void* render_target = nullptr;  // pl_tex wrapping `image` (direct scanout)
     };
 
     std::vector<DrmBuffer> m_buffers;
@@ -90,6 +116,11 @@ private:
 
     // Command pool and buffers
     VkCommandPool m_command_pool = VK_NULL_HANDLE;
+
+    // GPU timestamp timers for the upload and blit passes (-1 = no
+    // timestamp support)
+    int m_gpu_upload_timer = -1;
+    int m_gpu_blit_timer = -1;
     std::vector<VkCommandBuffer> m_command_buffers;
 
     // Staging resources
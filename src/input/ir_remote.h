@@ -79,6 +79,10 @@ public:
     // Poll for button events (non-blocking)
     Result pollEvents();
 
+    // Device fd, for registering with a shared event loop so button
+    // events dispatch on readability instead of a per-frame poll
+    int getFd() const { return m_fd; }
+
     // Set button callback
     using ButtonCallback = std::function<void(const ButtonEvent&)>;
     void setButtonCallback(ButtonCallback callback) { m_callback = callback; }
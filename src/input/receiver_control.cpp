@@ -1,4 +1,5 @@
 #include "receiver_control.h"
+#include "core/event_loop.h"
 #include "core/logger.h"
 #include <sys/socket.h>
 #include <netinet/in.h>
@@ -75,6 +76,18 @@ Result ReceiverControl::initialize(const std::string& ip_address, uint16_t port)
 }
 
 void ReceiverControl::shutdown() {
+    // Unregister from the event loop before closing the socket
+    if (m_event_loop) {
+        if (m_socket >= 0) {
+            m_event_loop->removeFd(m_socket);
+        }
+        if (m_query_timer_fd >= 0) {
+            m_event_loop->removeFd(m_query_timer_fd);
+            m_query_timer_fd = -1;
+        }
+        m_event_loop = nullptr;
+    }
+
     // Stop monitoring thread
     if (m_monitor_running) {
         m_monitor_running = false;
@@ -205,6 +218,70 @@ Result ReceiverControl::sendCommand(const std::string& command,
     return Result::SUCCESS;
 }
 
+Result ReceiverControl::enqueueCommand(const std::string& command,
+                                       const std::string& parameter) {
+    if (!m_connected || m_socket < 0) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+
+    // No event loop attached: behave like the old synchronous path
+    if (!m_event_loop) {
+        return sendCommand(command, parameter);
+    }
+
+    bool need_flush = false;
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_stats.commands_queued++;
+
+        // Coalesce: a still-queued command with the same tag is stale,
+        // the receiver only cares about the latest value. Queries are
+        // never folded into value changes (or vice versa).
+        if (parameter != "QSTN") {
+            for (auto& pending : m_command_queue) {
+                if (pending.command == command && pending.parameter != "QSTN") {
+                    pending.parameter = parameter;
+                    m_stats.commands_coalesced++;
+                    return Result::SUCCESS;
+                }
+            }
+        }
+
+        need_flush = m_command_queue.empty();
+        m_command_queue.push_back({command, parameter});
+    }
+
+    // First entry after an empty queue: wake the loop thread to write
+    if (need_flush) {
+        m_event_loop->post([this]() { flushCommandQueue(); });
+    }
+    return Result::SUCCESS;
+}
+
+void ReceiverControl::flushCommandQueue() {
+    while (true) {
+        EISCPMessage message;
+        {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            if (m_command_queue.empty()) {
+                break;
+            }
+            message = m_command_queue.front();
+            m_command_queue.pop_front();
+        }
+
+        if (sendCommand(message.command, message.parameter) == Result::SUCCESS) {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            m_stats.commands_sent++;
+            m_inflight_tags.push_back(message.command);
+            // A silent receiver must not grow this without bound
+            if (m_inflight_tags.size() > 16) {
+                m_inflight_tags.pop_front();
+            }
+        }
+    }
+}
+
 Result ReceiverControl::receiveResponse(EISCPMessage& message, int timeout_ms) {
     if (!m_connected || m_socket < 0) {
         return Result::ERROR_NOT_INITIALIZED;
@@ -257,6 +334,13 @@ Result ReceiverControl::receiveResponse(EISCPMessage& message, int timeout_ms) {
 Result ReceiverControl::queryVolume() {
     // MVL = Master Volume Level
     // QSTN = Query
+
+    // Event-loop mode: fire the query and let processIncoming() pick
+    // up the response; blocking here would stall the loop thread
+    if (m_event_loop) {
+        return enqueueCommand("MVL", "QSTN");
+    }
+
     Result result = sendCommand("MVL", "QSTN");
     if (result != Result::SUCCESS) {
         return result;
@@ -292,23 +376,23 @@ Result ReceiverControl::setVolumeRaw(int raw_level) {
     char param[3];
     snprintf(param, sizeof(param), "%02X", raw_level);
 
-    return sendCommand("MVL", param);
+    return enqueueCommand("MVL", param);
 }
 
 Result ReceiverControl::volumeUp() {
-    return sendCommand("MVL", "UP");
+    return enqueueCommand("MVL", "UP");
 }
 
 Result ReceiverControl::volumeDown() {
-    return sendCommand("MVL", "DOWN");
+    return enqueueCommand("MVL", "DOWN");
 }
 
 Result ReceiverControl::toggleMute() {
-    return sendCommand("AMT", "TG");
+    return enqueueCommand("AMT", "TG");
 }
 
 Result ReceiverControl::setMute(bool muted) {
-    return sendCommand("AMT", muted ? "01" : "00");
+    return enqueueCommand("AMT", muted ? "01" : "00");
 }
 
 ReceiverControl::VolumeInfo ReceiverControl::getVolumeInfo() const {
@@ -316,6 +400,11 @@ ReceiverControl::VolumeInfo ReceiverControl::getVolumeInfo() const {
     return m_volume_info;
 }
 
+ReceiverControl::Stats ReceiverControl::getStats() const {
+    std::lock_guard<std::mutex> lock(m_queue_mutex);
+    return m_stats;
+}
+
 void ReceiverControl::setMaxVolume(int max_volume) {
     std::lock_guard<std::mutex> lock(m_volume_mutex);
     m_volume_info.max_volume = max_volume;
@@ -333,6 +422,14 @@ void ReceiverControl::setMonitoringEnabled(bool enabled) {
 
     m_monitoring_enabled = enabled;
 
+    // Event-loop driven: readability callbacks and the query timer are
+    // already registered, no thread to manage
+    if (m_event_loop) {
+        LOG_INFO("Receiver", "Volume monitoring %s (event loop)",
+                 enabled ? "enabled" : "disabled");
+        return;
+    }
+
     if (enabled && m_connected) {
         // Start monitoring thread
         m_monitor_running = true;
@@ -356,21 +453,7 @@ void ReceiverControl::monitoringThread() {
         Result result = receiveResponse(message, 500);
 
         if (result == Result::SUCCESS) {
-            // Handle volume updates
-            if (message.command == "MVL") {
-                parseVolumeResponse(message.parameter);
-            } else if (message.command == "AMT") {
-                // Mute status: "00" = unmuted, "01" = muted
-                std::lock_guard<std::mutex> lock(m_volume_mutex);
-                m_volume_info.muted = (message.parameter == "01");
-                m_volume_info.changed = true;
-                m_volume_info.last_change_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                    std::chrono::steady_clock::now().time_since_epoch()).count();
-
-                if (m_volume_callback) {
-                    m_volume_callback(m_volume_info);
-                }
-            }
+            handleMessage(message);
         } else if (result != Result::ERROR_TIMEOUT) {
             LOG_WARN("Receiver", "Error receiving update: %d", static_cast<int>(result));
         }
@@ -387,6 +470,83 @@ void ReceiverControl::monitoringThread() {
     LOG_INFO("Receiver", "Volume monitoring thread stopped");
 }
 
+void ReceiverControl::handleMessage(const EISCPMessage& message) {
+    // Pair the response with its in-flight command tag (the protocol
+    // echoes the tag, e.g. MVL query and MVL status share "MVL")
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        for (auto it = m_inflight_tags.begin(); it != m_inflight_tags.end(); ++it) {
+            if (*it == message.command) {
+                m_inflight_tags.erase(it);
+                m_stats.responses_matched++;
+                break;
+            }
+        }
+    }
+
+    // Handle volume updates
+    if (message.command == "MVL") {
+        parseVolumeResponse(message.parameter);
+    } else if (message.command == "AMT") {
+        // Mute status: "00" = unmuted, "01" = muted
+        std::lock_guard<std::mutex> lock(m_volume_mutex);
+        m_volume_info.muted = (message.parameter == "01");
+        m_volume_info.changed = true;
+        m_volume_info.last_change_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+
+        if (m_volume_callback) {
+            m_volume_callback(m_volume_info);
+        }
+    }
+}
+
+void ReceiverControl::processIncoming() {
+    // The event loop signalled readability, so the short timeout only
+    // bounds a truncated packet; a full response completes immediately.
+    // Level-triggered epoll re-fires if more responses are buffered.
+    EISCPMessage message;
+    Result result = receiveResponse(message, 50);
+
+    if (result == Result::SUCCESS) {
+        handleMessage(message);
+    } else if (result != Result::ERROR_TIMEOUT) {
+        LOG_WARN("Receiver", "Error receiving update: %d", static_cast<int>(result));
+    }
+}
+
+Result ReceiverControl::attachEventLoop(core::EventLoop* loop) {
+    if (!loop || !loop->isInitialized()) {
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+    if (!m_connected || m_socket < 0) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+
+    // The monitoring thread and the loop must not both read the socket
+    if (m_monitor_running) {
+        LOG_WARN("Receiver", "Monitoring thread active, stopping it before attach");
+        setMonitoringEnabled(false);
+        m_monitoring_enabled = true;
+    }
+
+    Result result = loop->addFd(m_socket, [this](int, uint32_t) {
+        processIncoming();
+    });
+    if (result != Result::SUCCESS) {
+        return result;
+    }
+
+    // Replaces the periodic query the monitoring thread used to run
+    loop->addTimer(5000, [this]() {
+        queryVolume();
+    }, &m_query_timer_fd);
+
+    m_event_loop = loop;
+    LOG_INFO("Receiver", "Attached to event loop (fd %d)", m_socket);
+    return Result::SUCCESS;
+}
+
 void ReceiverControl::parseVolumeResponse(const std::string& parameter) {
     // Parameter is hex value (e.g., "32" = 50 decimal)
     // Or "N/A" if not available
@@ -6,8 +6,14 @@
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <deque>
 
 namespace ares {
+
+namespace core {
+class EventLoop;
+}
+
 namespace input {
 
 // EISCP (Ethernet-based protocol for Onkyo/Integra receivers)
@@ -67,10 +73,26 @@ public:
     void setMonitoringEnabled(bool enabled);
     bool isMonitoringEnabled() const { return m_monitoring_enabled; }
 
+    // Drive monitoring from a shared event loop instead of a dedicated
+    // blocking thread: registers the eISCP socket for readability and a
+    // periodic volume query timer. Call after initialize(); once
+    // attached, setMonitoringEnabled() no longer spawns a thread.
+    Result attachEventLoop(core::EventLoop* loop);
+
     // Set maximum volume for 0-100 scaling
     void setMaxVolume(int max_volume);
     int getMaxVolume() const { return m_volume_info.max_volume; }
 
+    // Statistics
+    struct Stats {
+        uint64_t commands_queued = 0;
+        uint64_t commands_coalesced = 0;  // rapid repeats folded together
+        uint64_t commands_sent = 0;
+        uint64_t responses_matched = 0;   // responses paired to a sent tag
+    };
+
+    Stats getStats() const;
+
 private:
     // EISCP protocol implementation
     struct EISCPMessage {
@@ -88,12 +110,28 @@ private:
     // Send command to receiver
     Result sendCommand(const std::string& command, const std::string& parameter = "");
 
+    // Queue a command for the event loop to write. Non-blocking: a
+    // queued command with the same tag is overwritten with the latest
+    // parameter (volume ramps coalesce instead of backing up). Falls
+    // back to a direct blocking send when no event loop is attached.
+    Result enqueueCommand(const std::string& command, const std::string& parameter);
+
+    // Drain the command queue onto the socket (loop thread only)
+    void flushCommandQueue();
+
     // Receive response from receiver
     Result receiveResponse(EISCPMessage& message, int timeout_ms = 1000);
 
     // Connection thread for monitoring updates
     void monitoringThread();
 
+    // Dispatch one parsed update (shared by the monitoring thread and
+    // the event-loop path)
+    void handleMessage(const EISCPMessage& message);
+
+    // Event-loop readability callback: drain one pending response
+    void processIncoming();
+
     // Parse volume response
     void parseVolumeResponse(const std::string& parameter);
 
@@ -117,6 +155,17 @@ private:
 
     // Callback
     VolumeCallback m_volume_callback;
+
+    // Shared event loop (optional, replaces the monitoring thread)
+    core::EventLoop* m_event_loop = nullptr;
+    int m_query_timer_fd = -1;
+
+    // Pending commands and in-flight tags awaiting a response
+    std::deque<EISCPMessage> m_command_queue;
+    std::deque<std::string> m_inflight_tags;
+    mutable std::mutex m_queue_mutex;
+
+    Stats m_stats;
 };
 
 } // namespace input
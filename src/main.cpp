@@ -2,7 +2,10 @@
 #include <ares/types.h>
 #include <ares/ares_config.h>
 #include "config/config_manager.h"
+#include "config/config_watcher.h"
 #include "capture/decklink_capture.h"
+#include "capture/frame_recorder.h"
+#include "capture/frame_replayer.h"
 #include "processing/processing_pipeline.h"
 #include "display/drm_display.h"
 #include "display/frame_rate_matcher.h"
@@ -10,13 +13,21 @@
 #include "input/receiver_control.h"
 #include "osd/menu_system.h"
 #include "osd/osd_renderer.h"
+#include "sync/latency_tracer.h"
+#include "core/event_loop.h"
+#include "core/frame_pool.h"
 #include "core/logger.h"
+#include "core/metrics_exporter.h"
+#include "core/rt_sched.h"
+#include "core/thread_pool.h"
 #include <cstdio>
 #include <cstring>
 #include <getopt.h>
 #include <chrono>
 #include <thread>
 #include <atomic>
+#include <mutex>
+#include <future>
 #include <signal.h>
 
 // Global flag for graceful shutdown
@@ -42,6 +53,8 @@ static void print_usage(const char* program_name) {
     printf("  -h, --help           Print this help message\n");
     printf("  -d, --daemon         Run as daemon (suppress console output)\n");
     printf("  --validate-config    Validate configuration and exit\n");
+    printf("  --record PATH        Record raw captured frames to PATH\n");
+    printf("  --replay PATH        Replay raw frames from PATH instead of capturing\n");
 }
 
 int main(int argc, char* argv[]) {
@@ -50,6 +63,8 @@ int main(int argc, char* argv[]) {
     const char* config_path = "/etc/ares/ares.ini";
     bool daemon_mode = false;
     bool validate_only = false;
+    const char* record_path = nullptr;
+    const char* replay_path = nullptr;
 
     // Command-line argument parsing
     static struct option long_options[] = {
@@ -58,6 +73,8 @@ int main(int argc, char* argv[]) {
         {"help", no_argument, 0, 'h'},
         {"daemon", no_argument, 0, 'd'},
         {"validate-config", no_argument, 0, 0},
+        {"record", required_argument, 0, 0},
+        {"replay", required_argument, 0, 0},
         {0, 0, 0, 0}
     };
 
@@ -81,6 +98,10 @@ int main(int argc, char* argv[]) {
             case 0:
                 if (strcmp(long_options[option_index].name, "validate-config") == 0) {
                     validate_only = true;
+                } else if (strcmp(long_options[option_index].name, "record") == 0) {
+                    record_path = optarg;
+                } else if (strcmp(long_options[option_index].name, "replay") == 0) {
+                    replay_path = optarg;
                 }
                 break;
             default:
@@ -124,68 +145,168 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
+    // Switch logging to the async backend so frame-path log calls never
+    // block on a terminal or journald flush
+    core::Logger::getInstance().setAsync(true);
+
     // Setup signal handlers for graceful shutdown
     signal(SIGINT, signal_handler);
     signal(SIGTERM, signal_handler);
 
-    // Initialize DeckLink capture
-    LOG_INFO("Main", "Initializing DeckLink capture...");
+    // Apply realtime scheduling before anything allocates: mlockall
+    // covers future mappings, and threads started later pick up their
+    // class (capture/worker) from their own context
+    core::RTSched::configure(config.realtime);
+    if (config.realtime.enabled && config.realtime.lock_memory) {
+        core::RTSched::lockMemory();
+    }
+    core::RTSched::applyCurrentThread(core::RTSched::CLASS_MAIN);
+
+    // Initialize the shared frame pool before any frames flow.
+    // Slot size covers a 4K 10-bit frame; count covers the capture queue,
+    // the frame buffer and in-flight intermediates. Locked so frame memory
+    // is never paged out mid-session.
+    LOG_INFO("Main", "Initializing frame pool...");
+    const size_t frame_slot_size = 3840ULL * 2160ULL * 4;
+    const size_t frame_slot_count = (size_t)config.capture.buffer_size * 2 + 8;
+    result = core::FramePool::getInstance().initialize(frame_slot_size, frame_slot_count, true);
+    if (result != Result::SUCCESS) {
+        LOG_ERROR("Main", "Failed to initialize frame pool");
+        return 1;
+    }
+
+    // Parallel startup phase: the DeckLink probe, DRM display bring-up,
+    // OSD surface allocation and IR device open spend most of their time
+    // in independent driver waits, so run them concurrently and join
+    // before anything that depends on them. The pool sticks around for
+    // the deferred receiver connection.
+    auto startup_begin = std::chrono::steady_clock::now();
+    core::ThreadPool startup_pool(4);
+
     capture::DeckLinkCapture capture;
-    result = capture.initialize(config.capture.device_index);
+    capture::DeckLinkCapture secondary_capture;
+    capture::FrameReplayer replayer;
+    display::DRMDisplay display;
+    osd::OSDRenderer osd_renderer;
+    input::IRRemote ir_remote;
+    const bool replay_mode = (replay_path != nullptr);
+
+    LOG_INFO("Main", "Initializing capture, display, OSD and IR remote in parallel...");
+    auto capture_init = startup_pool.enqueue([&capture, &replayer, &config,
+                                              replay_mode, replay_path] {
+        // Replay mode feeds the pipeline from a raw recording instead of
+        // the DeckLink (same getFrame interface)
+        if (replay_mode) {
+            return replayer.initialize(replay_path);
+        }
+        return capture.initialize(config.capture.device_index);
+    });
+    auto display_init = startup_pool.enqueue([&display, &config] {
+        return display.initialize(config.display);
+    });
+    auto osd_init = startup_pool.enqueue([&osd_renderer, &config] {
+        return osd_renderer.initialize(config.display.mode.width,
+                                       config.display.mode.height, config.osd);
+    });
+    auto ir_init = startup_pool.enqueue([&ir_remote] {
+        return ir_remote.initialize("/dev/input/event0");  // TODO: Make configurable
+    });
+
+    result = capture_init.get();
     if (result != Result::SUCCESS) {
-        LOG_ERROR("Main", "Failed to initialize DeckLink capture");
+        LOG_ERROR("Main", replay_mode ? "Failed to initialize frame replayer"
+                                      : "Failed to initialize DeckLink capture");
+        display_init.wait();
+        osd_init.wait();
+        ir_init.wait();
         return 1;
     }
     LOG_INFO("Main", "DeckLink capture initialized successfully");
 
-    // Initialize DRM display
-    LOG_INFO("Main", "Initializing DRM display...");
-    display::DRMDisplay display;
-    result = display.initialize(config.display);
+    // Secondary DeckLink input (optional): runs concurrently with its own
+    // driver queue, so switching the active source or toggling PiP never
+    // re-initializes a device or waits out an HDMI resync
+    bool secondary_enabled = false;
+    if (!replay_mode && config.capture.secondary_device_index >= 0) {
+        result = secondary_capture.initialize(config.capture.secondary_device_index);
+        if (result == Result::SUCCESS) {
+            secondary_enabled = true;
+            LOG_INFO("Main", "Secondary capture initialized (device %d)",
+                     config.capture.secondary_device_index);
+        } else {
+            LOG_WARN("Main", "Failed to initialize secondary capture (continuing without it)");
+        }
+    }
+
+    result = display_init.get();
     if (result != Result::SUCCESS) {
         LOG_ERROR("Main", "Failed to initialize DRM display");
+        osd_init.wait();
+        ir_init.wait();
+        if (secondary_enabled) {
+            secondary_capture.shutdown();
+        }
         capture.shutdown();
         return 1;
     }
     LOG_INFO("Main", "DRM display initialized successfully");
 
-    // Initialize frame rate matcher
-    LOG_INFO("Main", "Initializing frame rate matcher...");
+    // Initialize frame rate matcher (needs display and capture)
     display::FrameRateMatcher framerate_matcher;
-    result = framerate_matcher.initialize(&display, &capture);
-    if (result != Result::SUCCESS) {
-        LOG_WARN("Main", "Failed to initialize frame rate matcher");
+    if (replay_mode) {
+        LOG_INFO("Main", "Replay mode: frame rate matcher disabled");
+    } else {
+        LOG_INFO("Main", "Initializing frame rate matcher...");
+        result = framerate_matcher.initialize(&display, &capture);
+        if (result != Result::SUCCESS) {
+            LOG_WARN("Main", "Failed to initialize frame rate matcher");
+        }
     }
 
-    // Initialize processing pipeline
+    // Initialize processing pipeline (needs the display's output mode)
     LOG_INFO("Main", "Initializing processing pipeline...");
     processing::ProcessingPipeline pipeline;
     result = pipeline.initialize(config.processing, &display);
     if (result != Result::SUCCESS) {
         LOG_ERROR("Main", "Failed to initialize processing pipeline");
+        osd_init.wait();
+        ir_init.wait();
         display.shutdown();
+        if (secondary_enabled) {
+            secondary_capture.shutdown();
+        }
         capture.shutdown();
         return 1;
     }
     LOG_INFO("Main", "Processing pipeline initialized successfully");
 
-    // Initialize OSD renderer
-    LOG_INFO("Main", "Initializing OSD...");
-    osd::OSDRenderer osd_renderer;
-    result = osd_renderer.initialize(config.display.mode.width, config.display.mode.height, config.osd);
-    if (result != Result::SUCCESS) {
-        LOG_WARN("Main", "Failed to initialize OSD renderer");
+    // Multi-GPU: note when the configured render device is not the GPU
+    // driving the display — processed frames then cross to the scanout
+    // device as dma-bufs instead of staying device-local
+    if (pipeline.getVulkanContext() &&
+        !pipeline.getVulkanContext()->drivesDisplayDevice(config.display.card)) {
+        LOG_INFO("Main", "Render GPU does not drive %s; frames shared with scanout device via dma-buf",
+                 config.display.card.c_str());
     }
 
-    // Initialize IR remote
-    LOG_INFO("Main", "Initializing IR remote...");
-    input::IRRemote ir_remote;
-    result = ir_remote.initialize("/dev/input/event0");  // TODO: Make configurable
-    if (result != Result::SUCCESS) {
+    // Remote preview tap (optional): downsampled rendered output served
+    // asynchronously over loopback HTTP; never touches the frame path
+    if (config.preview.enabled) {
+        if (pipeline.enablePreviewTap((uint16_t)config.preview.port,
+                                      (uint32_t)config.preview.width) != Result::SUCCESS) {
+            LOG_WARN("Main", "Failed to enable preview tap (continuing without it)");
+        }
+    }
+
+    // Join the remaining optional subsystems
+    if (osd_init.get() != Result::SUCCESS) {
+        LOG_WARN("Main", "Failed to initialize OSD renderer");
+    }
+    if (ir_init.get() != Result::SUCCESS) {
         LOG_WARN("Main", "Failed to initialize IR remote (continuing without remote)");
     }
 
-    // Initialize menu system
+    // Initialize menu system (needs OSD renderer and IR remote)
     LOG_INFO("Main", "Initializing menu system...");
     osd::MenuSystem menu;
     result = menu.initialize(&osd_renderer, &ir_remote, config.osd);
@@ -193,46 +314,193 @@ int main(int argc, char* argv[]) {
         LOG_WARN("Main", "Failed to initialize menu system");
     }
 
-    // Initialize receiver (optional)
+    auto startup_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startup_begin).count();
+    LOG_INFO("Main", "Subsystem initialization took %ld ms", (long)startup_elapsed);
+
+    // Event loop for the low-rate fds (IR remote, eISCP socket, DRM
+    // flip events): one epoll thread replaces the receiver's blocking
+    // monitoring thread and reaps page flips before the frame path
+    // needs to wait for them
+    core::EventLoop event_loop;
+    if (event_loop.initialize() != Result::SUCCESS) {
+        LOG_WARN("Main", "Failed to initialize event loop (falling back to per-source threads)");
+    }
+
+    if (event_loop.isInitialized() && ir_remote.isInitialized()) {
+        event_loop.addFd(ir_remote.getFd(), [&ir_remote](int, uint32_t) {
+            ir_remote.pollEvents();
+        });
+    }
+    if (event_loop.isInitialized() && display.isInitialized()) {
+        event_loop.addFd(display.getDrmFd(), [&display](int, uint32_t) {
+            display.waitFlipComplete(0);
+        });
+    }
+
+    // Latency measurement mode (system.latency_trace): per-stage
+    // capture->flip tracing fed by the DRM flip callback, plus an OSD
+    // corner marker for external glass-to-glass measurement
+    sync::LatencyTracer latency_tracer;
+    latency_tracer.setEnabled(config.latency_trace);
+    if (latency_tracer.isEnabled() && display.isInitialized()) {
+        display.setFlipCallback([&latency_tracer](const display::DRMDisplay::FlipTimestamp& ts) {
+            latency_tracer.onFlip(ts.flip_time);
+        });
+        LOG_INFO("Main", "Latency trace enabled (marker square in top-left corner)");
+    }
+
+    // Initialize receiver (optional): the TCP connect can take seconds,
+    // so it is fully deferred off the startup path and flips
+    // receiver_enabled once the connection is up
     input::ReceiverControl receiver;
-    bool receiver_enabled = false;
+    std::atomic<bool> receiver_enabled{false};
+    std::future<void> receiver_init;
     if (config.receiver.enabled) {
-        LOG_INFO("Main", "Initializing receiver control...");
-        result = receiver.initialize(config.receiver.ip_address, config.receiver.port);
-        if (result == Result::SUCCESS) {
-            receiver.setMaxVolume(config.receiver.max_volume);
-            receiver.setMonitoringEnabled(true);
-            receiver_enabled = true;
-            LOG_INFO("Main", "Receiver control initialized successfully");
-        } else {
-            LOG_WARN("Main", "Failed to initialize receiver control (continuing without receiver)");
+        receiver_init = startup_pool.enqueue([&receiver, &receiver_enabled, &config,
+                                              &event_loop] {
+            LOG_INFO("Main", "Connecting receiver control in background...");
+            Result r = receiver.initialize(config.receiver.ip_address, config.receiver.port);
+            if (r == Result::SUCCESS) {
+                receiver.setMaxVolume(config.receiver.max_volume);
+                if (event_loop.isInitialized()) {
+                    receiver.attachEventLoop(&event_loop);
+                }
+                receiver.setMonitoringEnabled(true);
+                receiver_enabled = true;
+                LOG_INFO("Main", "Receiver control initialized successfully");
+            } else {
+                LOG_WARN("Main", "Failed to initialize receiver control (continuing without receiver)");
+            }
+        });
+    }
+
+    // UI tick: menu logic, stats string formatting and overlay drawing
+    // run at a fixed 30 Hz on the event-loop thread instead of inside
+    // the frame loop, so UI work never taxes the frame deadline and menu
+    // animation speed no longer depends on source cadence (24 Hz film vs
+    // 60 Hz video). The frame path only consumes the composited surface;
+    // osd_mutex keeps the tick and the frame loop's latency-marker draw
+    // off the cairo surface at the same time
+    std::mutex osd_mutex;
+    auto last_ui_tick = std::chrono::steady_clock::now();
+    auto ui_tick = [&]() {
+        auto now = std::chrono::steady_clock::now();
+        float delta_ms = std::chrono::duration<float, std::milli>(now - last_ui_tick).count();
+        last_ui_tick = now;
+
+        std::lock_guard<std::mutex> osd_lock(osd_mutex);
+
+        // Update menu system (handle input, update OSD)
+        menu.update(delta_ms);
+
+        // Update GPU performance info in menu
+        auto pipeline_stats = pipeline.getStats();
+        menu.updateGPUPerformanceInfo(
+            pipeline_stats.tone_mapping_stats.last_frame_time_ms,
+            pipeline_stats.tone_mapping_stats.avg_frame_time_ms,
+            pipeline_stats.tone_mapping_stats.gpu_render_ms
+        );
+
+        // Render volume overlay if receiver is active and volume changed recently
+        if (receiver_enabled) {
+            auto volume_info = receiver.getVolumeInfo();
+            if (volume_info.changed) {
+                // Check if volume change was recent (within last 3 seconds)
+                auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+                if (now_ms - volume_info.last_change_ms < 3000) {
+                    float opacity = 1.0f;
+                    // Fade out in last 500ms
+                    if (now_ms - volume_info.last_change_ms > 2500) {
+                        opacity = 1.0f - (now_ms - volume_info.last_change_ms - 2500) / 500.0f;
+                    }
+                    osd_renderer.drawVolumeOverlay(volume_info.level, volume_info.muted, opacity);
+                }
+            }
         }
+
+        // Composite OSD over video if menu is visible
+        if (menu.isVisible()) {
+            menu.render();
+        }
+    };
+    if (event_loop.isInitialized()) {
+        event_loop.addTimer(33, ui_tick);
+    }
+
+    // Initialize metrics exporter (optional): publishes a seqlock-guarded
+    // snapshot to shared memory plus a Prometheus textfile for scrapers
+    core::MetricsExporter metrics;
+    if (metrics.initialize() != Result::SUCCESS) {
+        LOG_WARN("Main", "Failed to initialize metrics exporter (continuing without metrics)");
+    }
+
+    // Initialize raw frame recorder (optional): taps delivered frames
+    // before processing so recordings match what the DeckLink produced
+    capture::FrameRecorder recorder;
+    if (record_path) {
+        if (recorder.initialize(record_path) != Result::SUCCESS) {
+            LOG_WARN("Main", "Failed to initialize frame recorder (continuing without recording)");
+        }
+    }
+
+    // Watch the config file for edits (optional): the watcher thread
+    // parses changed files in the background and the main loop applies
+    // them between two frames through the pipeline's config snapshot
+    config::ConfigWatcher config_watcher;
+    if (config_watcher.initialize(config_path) != Result::SUCCESS) {
+        LOG_WARN("Main", "Failed to initialize config watcher (continuing without hot reload)");
     }
 
     // Start capture
     LOG_INFO("Main", "Starting capture...");
-    result = capture.start();
+    result = replay_mode ? replayer.start() : capture.start();
     if (result != Result::SUCCESS) {
         LOG_ERROR("Main", "Failed to start capture");
         pipeline.shutdown();
         display.shutdown();
+        if (secondary_enabled) {
+            secondary_capture.shutdown();
+        }
         capture.shutdown();
         return 1;
     }
+    if (secondary_enabled && secondary_capture.start() != Result::SUCCESS) {
+        LOG_WARN("Main", "Failed to start secondary capture (continuing without it)");
+        secondary_capture.shutdown();
+        secondary_enabled = false;
+    }
 
     LOG_INFO("Main", "Initialization complete, entering main loop");
     printf("\nAres is now running. Press Ctrl+C to stop.\n\n");
 
     // Statistics
     uint64_t frame_count = 0;
+    uint64_t triage_dropped = 0;
+    uint64_t pip_frames_pending = 0;
     auto start_time = std::chrono::steady_clock::now();
     auto last_stats_time = start_time;
+    auto last_metrics_time = start_time;
 
     // Main processing loop
     while (g_running) {
+        // Active source selection: both inputs stay initialized and
+        // running, so a switch just changes which queue feeds the
+        // pipeline — it takes effect on the next frame with no
+        // re-initialization and no HDMI resync on either device
+        const bool secondary_active =
+            secondary_enabled && config.capture.active_source == 1;
+        capture::DeckLinkCapture& active_capture =
+            secondary_active ? secondary_capture : capture;
+        capture::DeckLinkCapture* pip_capture =
+            secondary_enabled ? (secondary_active ? &capture : &secondary_capture)
+                              : nullptr;
+
         // Get frame from capture
         VideoFrame input_frame;
-        result = capture.getFrame(input_frame, 100);  // 100ms timeout
+        result = replay_mode ? replayer.getFrame(input_frame, 100)
+                             : active_capture.getFrame(input_frame, 100);  // 100ms timeout
 
         if (result == Result::ERROR_TIMEOUT) {
             // No frame available, continue
@@ -242,48 +510,78 @@ int main(int argc, char* argv[]) {
             break;
         }
 
+        // Tap the raw frame for the recorder before any processing
+        if (recorder.isInitialized()) {
+            recorder.recordFrame(input_frame);
+        }
+
+        // Late-frame triage: if the capture queue already holds a newer
+        // frame, this one can no longer make its presentation slot and
+        // processing it would only push us further behind. Dropping at
+        // pop costs a buffer release instead of a full GPU pass, and
+        // looping here until the queue is drained skips straight to the
+        // newest frame after a stall — recovery is bounded to one frame
+        // interval instead of grinding through the backlog
+        if (!replay_mode && active_capture.hasFrame()) {
+            input_frame.release();
+            triage_dropped++;
+            LOG_DEBUG("Main", "Dropped late frame at pop (%lu total)",
+                      (unsigned long)triage_dropped);
+            continue;
+        }
+
+        // Inactive input: drain its queue every iteration so it never
+        // backs up, but only upload every Nth frame (the newest drained
+        // one) as the PiP overlay — the reduced rate keeps GPU headroom
+        // for the primary path
+        if (pip_capture) {
+            int divisor = config.processing.pip.frame_divisor;
+            if (divisor < 1) divisor = 1;
+            VideoFrame pip_frame;
+            while (pip_capture->getFrame(pip_frame, 0) == Result::SUCCESS) {
+                pip_frames_pending++;
+                if (!pip_capture->hasFrame() && config.processing.pip.enabled &&
+                    pip_frames_pending >= (uint64_t)divisor) {
+                    pipeline.submitSecondaryFrame(pip_frame);
+                    pip_frames_pending = 0;
+                }
+                pip_frame.release();
+            }
+        }
+
         // Update frame rate matcher (automatic display mode switching)
-        framerate_matcher.update();
+        if (!replay_mode) {
+            framerate_matcher.update();
+        }
+
+        if (latency_tracer.isEnabled()) {
+            latency_tracer.onFramePopped(input_frame.pts);
+        }
 
         // Process frame through pipeline
         VideoFrame output_frame;
         result = pipeline.processFrame(input_frame, output_frame);
+
+        // Zero-copy capture: drop the driver buffer reference now that the
+        // frame has been uploaded to the GPU
+        input_frame.release();
+
         if (result != Result::SUCCESS) {
             LOG_ERROR("Main", "Failed to process frame");
             continue;
         }
 
-        // Update menu system (handle input, update OSD)
-        menu.update(16.67f); // ~60 FPS frame time
-
-        // Update GPU performance info in menu (every frame for real-time display)
-        auto pipeline_stats = pipeline.getStats();
-        menu.updateGPUPerformanceInfo(
-            pipeline_stats.tone_mapping_stats.last_frame_time_ms,
-            pipeline_stats.tone_mapping_stats.avg_frame_time_ms
-        );
-
-        // Render volume overlay if receiver is active and volume changed recently
-        if (receiver_enabled) {
-            auto volume_info = receiver.getVolumeInfo();
-            if (volume_info.changed) {
-                // Check if volume change was recent (within last 3 seconds)
-                auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
-                    std::chrono::steady_clock::now().time_since_epoch()).count();
-                if (now - volume_info.last_change_ms < 3000) {
-                    float opacity = 1.0f;
-                    // Fade out in last 500ms
-                    if (now - volume_info.last_change_ms > 2500) {
-                        opacity = 1.0f - (now - volume_info.last_change_ms - 2500) / 500.0f;
-                    }
-                    osd_renderer.drawVolumeOverlay(volume_info.level, volume_info.muted, opacity);
-                }
-            }
+        if (latency_tracer.isEnabled()) {
+            latency_tracer.onFrameProcessed();
+            std::lock_guard<std::mutex> osd_lock(osd_mutex);
+            osd_renderer.drawLatencyMarker(latency_tracer.markerState());
         }
 
-        // Composite OSD over video if menu is visible
-        if (menu.isVisible()) {
-            menu.render();
+        // UI work (menu logic, stats refresh, overlays) runs on the
+        // event-loop UI tick; the frame path only consumes the
+        // composited surface. Tick inline when there is no event loop
+        if (!event_loop.isInitialized()) {
+            ui_tick();
         }
 
         // Present frame to display (via page flip - actual presentation happens through Vulkan)
@@ -293,26 +591,99 @@ int main(int argc, char* argv[]) {
 
         frame_count++;
 
-        // Print statistics every 10 seconds
+        // Apply config file edits: parsing and validation already ran on
+        // the watcher thread, so this is a few struct copies plus a
+        // snapshot publish — settings land between two frames with no
+        // frames dropped. Only capture/display topology needs a restart
+        uint32_t config_changes = 0;
+        if (config_watcher.poll(config, config_changes)) {
+            pipeline.updateConfig(config.processing);
+            {
+                // The UI tick touches the menu from the event loop's
+                // thread, so its config swap needs the same lock
+                std::lock_guard<std::mutex> osd_lock(osd_mutex);
+                menu.setConfig(config.osd);
+            }
+
+            if (config.log_level == "DEBUG") core::Logger::getInstance().setLevel(core::LogLevel::DEBUG);
+            else if (config.log_level == "INFO") core::Logger::getInstance().setLevel(core::LogLevel::INFO);
+            else if (config.log_level == "WARN") core::Logger::getInstance().setLevel(core::LogLevel::WARN);
+            else if (config.log_level == "ERROR") core::Logger::getInstance().setLevel(core::LogLevel::ERROR);
+
+            if (receiver_enabled) {
+                receiver.setMaxVolume(config.receiver.max_volume);
+            }
+
+            if (config_changes & config::ConfigWatcher::CHANGED_CAPTURE) {
+                LOG_WARN("Main", "Capture settings changed in config file; restart to apply");
+            }
+            if (config_changes & config::ConfigWatcher::CHANGED_DISPLAY) {
+                LOG_WARN("Main", "Display settings changed in config file; restart to apply");
+            }
+            if (config_changes & config::ConfigWatcher::CHANGED_RECEIVER_CONN) {
+                LOG_WARN("Main", "Receiver connection settings changed in config file; restart to apply");
+            }
+        }
+
+        // Publish metrics once per second (wait-free seqlock write)
         auto now = std::chrono::steady_clock::now();
+        if (metrics.isInitialized() &&
+            std::chrono::duration_cast<std::chrono::seconds>(now - last_metrics_time).count() >= 1) {
+            auto matcher_stats = framerate_matcher.getStats();
+            auto display_stats = display.getStats();
+            auto pipeline_stats = pipeline.getStats();
+
+            core::MetricsSnapshot snapshot;
+            if (replay_mode) {
+                auto replay_stats = replayer.getStats();
+                snapshot.frames_captured = replay_stats.frames_captured;
+                snapshot.frames_dropped = replay_stats.frames_dropped;
+                snapshot.capture_fps = replay_stats.current_fps;
+            } else {
+                auto capture_stats = capture.getStats();
+                snapshot.frames_captured = capture_stats.frames_captured;
+                snapshot.frames_dropped = capture_stats.frames_dropped;
+                snapshot.capture_fps = capture_stats.current_fps;
+            }
+            snapshot.frames_processed = pipeline_stats.frames_processed;
+            snapshot.frame_time_ms = pipeline_stats.avg_frame_time_ms;
+            snapshot.tone_map_time_ms = pipeline_stats.tone_mapping_stats.avg_frame_time_ms;
+            snapshot.frames_presented = display_stats.frames_presented;
+            snapshot.missed_vblanks = display_stats.missed_vblanks;
+            snapshot.mode_switches = matcher_stats.mode_switches;
+            snapshot.source_fps = matcher_stats.current_source_fps;
+            snapshot.display_refresh_hz = matcher_stats.current_display_refresh;
+            snapshot.log_records_dropped = core::Logger::getInstance().getStats().records_dropped;
+            snapshot.uptime_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(
+                now - start_time).count();
+            metrics.publish(snapshot);
+            last_metrics_time = now;
+        }
+
+        // Print statistics every 10 seconds
         auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - last_stats_time).count();
         if (elapsed >= 10) {
             auto total_elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - start_time).count();
             double avg_fps = frame_count / (double)total_elapsed;
 
-            auto capture_stats = capture.getStats();
+            uint64_t capture_dropped = replay_mode ? replayer.getStats().frames_dropped
+                                                   : capture.getStats().frames_dropped;
             auto pipeline_stats = pipeline.getStats();
             auto matcher_stats = framerate_matcher.getStats();
 
             LOG_INFO("Main", "=== Statistics ===");
             LOG_INFO("Main", "Frames processed: %lu (%.2f fps avg)", frame_count, avg_fps);
-            LOG_INFO("Main", "Frames dropped: %lu", capture_stats.frames_dropped);
+            LOG_INFO("Main", "Frames dropped: %lu (triaged at pop: %lu)",
+                     capture_dropped, triage_dropped);
             LOG_INFO("Main", "Source FPS: %.3f (stable: %s)",
                      matcher_stats.current_source_fps,
                      matcher_stats.mode_matched ? "yes" : "no");
             LOG_INFO("Main", "Display refresh: %.2f Hz", matcher_stats.current_display_refresh);
             LOG_INFO("Main", "Mode switches: %lu", matcher_stats.mode_switches);
             LOG_INFO("Main", "Processing time: %.2f ms/frame", pipeline_stats.avg_frame_time_ms);
+            if (latency_tracer.isEnabled()) {
+                latency_tracer.logReport();
+            }
 
             last_stats_time = now;
         }
@@ -322,18 +693,43 @@ int main(int argc, char* argv[]) {
     LOG_INFO("Main", "Shutting down...");
 
     // Stop capture first
-    capture.stop();
+    if (replay_mode) {
+        replayer.stop();
+    } else {
+        capture.stop();
+    }
+    if (secondary_enabled) {
+        secondary_capture.stop();
+    }
+
+    // Flush outstanding recorder writes before tearing anything else down
+    config_watcher.shutdown();
+    recorder.shutdown();
 
     // Shutdown all modules in reverse order
+    if (receiver_init.valid()) {
+        receiver_init.wait();
+    }
     if (receiver_enabled) {
         receiver.shutdown();
     }
+    // Stop dispatching before the fds it watches are closed
+    event_loop.shutdown();
+    metrics.shutdown();
     menu.shutdown();
     ir_remote.shutdown();
     osd_renderer.shutdown();
     pipeline.shutdown();
     display.shutdown();
-    capture.shutdown();
+    if (replay_mode) {
+        replayer.shutdown();
+    } else {
+        capture.shutdown();
+    }
+    if (secondary_enabled) {
+        secondary_capture.shutdown();
+    }
+    core::FramePool::getInstance().shutdown();
 
     // Print final statistics
     auto total_time = std::chrono::duration_cast<std::chrono::seconds>(
@@ -52,6 +52,7 @@ Result MenuSystem::loadMenu(const OSDMenuStructure& menu) {
     m_current_tab = 0;
     m_current_item = 0;
     m_scroll_offset = 0;
+    invalidate();
 
     LOG_INFO("OSD", "Loaded menu with %zu tabs", m_menu.tabs.size());
     return Result::SUCCESS;
@@ -63,6 +64,7 @@ void MenuSystem::show() {
         m_animation_progress = 0.0f;
         resetTimeout();
         m_stats.menu_opens++;
+        invalidate();
         LOG_DEBUG("OSD", "Menu shown");
     }
 }
@@ -70,6 +72,7 @@ void MenuSystem::show() {
 void MenuSystem::hide() {
     if (m_visible) {
         m_visible = false;
+        invalidate();
         LOG_DEBUG("OSD", "Menu hidden");
     }
 }
@@ -91,6 +94,7 @@ void MenuSystem::update(float delta_time_ms) {
         if (m_animation_progress > 1.0f) {
             m_animation_progress = 1.0f;
         }
+        invalidate();
     }
 
     // Check timeout
@@ -108,7 +112,12 @@ void MenuSystem::render() {
 
     auto start = std::chrono::high_resolution_clock::now();
 
-    m_renderer->beginFrame();
+    if (!m_renderer->beginFrame(m_content_version)) {
+        // Nothing changed since the last rendered frame; the previous
+        // surface is reused as-is
+        m_stats.frames_skipped++;
+        return;
+    }
 
     renderBackground();
     renderTabs();
@@ -322,6 +331,7 @@ void MenuSystem::navigateUp() {
     } while (!menu->items[m_current_item].visible || !menu->items[m_current_item].enabled);
 
     resetTimeout();
+    invalidate();
     LOG_DEBUG("OSD", "Navigate up to item %d", m_current_item);
 }
 
@@ -337,6 +347,7 @@ void MenuSystem::navigateDown() {
     } while (!menu->items[m_current_item].visible || !menu->items[m_current_item].enabled);
 
     resetTimeout();
+    invalidate();
     LOG_DEBUG("OSD", "Navigate down to item %d", m_current_item);
 }
 
@@ -352,6 +363,7 @@ void MenuSystem::navigateLeft() {
         m_current_item = 0;
         m_scroll_offset = 0;
         resetTimeout();
+        invalidate();
         LOG_DEBUG("OSD", "Navigate left to tab %d", m_current_tab);
     }
 }
@@ -368,6 +380,7 @@ void MenuSystem::navigateRight() {
         m_current_item = 0;
         m_scroll_offset = 0;
         resetTimeout();
+        invalidate();
         LOG_DEBUG("OSD", "Navigate right to tab %d", m_current_tab);
     }
 }
@@ -378,6 +391,7 @@ void MenuSystem::navigateTab(int tab_index) {
         m_current_item = 0;
         m_scroll_offset = 0;
         resetTimeout();
+        invalidate();
     }
 }
 
@@ -386,6 +400,7 @@ void MenuSystem::selectCurrent() {
     if (!item || !item->enabled) return;
 
     m_stats.items_selected++;
+    invalidate();
 
     switch (item->type) {
         case MenuItemType::TOGGLE:
@@ -437,6 +452,7 @@ void MenuSystem::selectCurrent() {
 void MenuSystem::goBack() {
     if (m_adjusting_value) {
         m_adjusting_value = false;
+        invalidate();
     } else {
         hide();
     }
@@ -469,6 +485,9 @@ void MenuSystem::adjustValue(float delta) {
     if (value_changed && item->on_change) {
         item->on_change();
     }
+    if (value_changed) {
+        invalidate();
+    }
 
     resetTimeout();
 }
@@ -554,12 +573,22 @@ MenuItem* MenuSystem::getCurrentItem() {
     return &menu->items[m_current_item];
 }
 
-void MenuSystem::updateGPUPerformanceInfo(double frame_time_ms, double avg_frame_time_ms) {
+void MenuSystem::updateGPUPerformanceInfo(double frame_time_ms, double avg_frame_time_ms,
+                                          double gpu_render_ms) {
     // Update GPU frame time
     char buffer[64];
     snprintf(buffer, sizeof(buffer), "%.2f ms", frame_time_ms);
     updateInfoItem("gpu_frame_time", buffer);
 
+    // Update GPU render time (timestamp queries — actual GPU execution,
+    // unlike the CPU-side wall clock above)
+    if (gpu_render_ms > 0.0) {
+        snprintf(buffer, sizeof(buffer), "%.2f ms", gpu_render_ms);
+    } else {
+        snprintf(buffer, sizeof(buffer), "N/A");
+    }
+    updateInfoItem("gpu_render_time", buffer);
+
     // Update GPU frame rate (max FPS based on frame time)
     double max_fps = (frame_time_ms > 0.0) ? (1000.0 / frame_time_ms) : 0.0;
     snprintf(buffer, sizeof(buffer), "%.1f FPS", max_fps);
@@ -594,7 +623,10 @@ void MenuSystem::updateInfoItem(const std::string& item_id, const std::string& v
     for (auto& tab : m_menu.tabs) {
         for (auto& item : tab.items) {
             if (item.id == item_id && item.type == MenuItemType::INFO) {
-                item.info_text = value;
+                if (item.info_text != value) {
+                    item.info_text = value;
+                    invalidate();
+                }
                 return;
             }
         }
@@ -57,7 +57,7 @@ public:
     int getCurrentItemIndex() const { return m_current_item; }
 
     // Configuration
-    void setConfig(const OSDConfig& config) { m_config = config; }
+    void setConfig(const OSDConfig& config) { m_config = config; invalidate(); }
     const OSDConfig& getConfig() const { return m_config; }
 
     // Access menu structure (for wiring values and callbacks)
@@ -65,7 +65,10 @@ public:
     const OSDMenuStructure& getMenuStructure() const { return m_menu; }
 
     // Update dynamic info items (GPU stats, input info, etc.)
-    void updateGPUPerformanceInfo(double frame_time_ms, double avg_frame_time_ms);
+    // gpu_render_ms is actual GPU execution time of the render pass
+    // (timestamp queries); <= 0 hides the item (no timestamp support)
+    void updateGPUPerformanceInfo(double frame_time_ms, double avg_frame_time_ms,
+                                  double gpu_render_ms = 0.0);
     void updateInfoItem(const std::string& item_id, const std::string& value);
 
     // Statistics
@@ -73,6 +76,7 @@ public:
         uint64_t inputs_processed = 0;
         uint64_t menu_opens = 0;
         uint64_t items_selected = 0;
+        uint64_t frames_skipped = 0;   // unchanged frames, no rasterization
         double avg_render_time_ms = 0.0;
     };
 
@@ -107,6 +111,10 @@ private:
     void resetTimeout();
     bool isTimedOut() const;
 
+    // Mark the menu content changed; render() skips rasterization
+    // entirely while the version stands still
+    void invalidate() { m_content_version++; }
+
     // Menu structure
     OSDMenuStructure m_menu;
     NavState m_nav_state;
@@ -137,6 +145,9 @@ private:
 
     // Animation state
     float m_animation_progress = 0.0f;
+
+    // Damage-tracking version fed to OSDRenderer::beginFrame
+    uint64_t m_content_version = 1;
 };
 
 } // namespace osd
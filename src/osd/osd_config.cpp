@@ -270,6 +270,22 @@ OSDMenuStructure createDefaultOSDMenu() {
     chroma_antiring.tooltip = "Reduce ringing artifacts (0.8 recommended)";
     enhancements_tab.items.push_back(chroma_antiring);
 
+    // Image (luma) upscaling
+    // Option order mirrors ScalingAlgorithm so the value binds directly
+    MenuItem upscale_algorithm;
+    upscale_algorithm.id = "upscale_algorithm";
+    upscale_algorithm.label = "Image Upscaling";
+    upscale_algorithm.type = MenuItemType::ENUM;
+    upscale_algorithm.enum_options = {
+        "Bilinear", "Nearest", "Bicubic", "Mitchell", "Catmull-Rom",
+        "Hermite", "Lanczos", "Spline16", "Spline36", "Spline64",
+        "EWA Lanczos", "EWA Lanczos Sharp", "EWA Lanczos 4-tap", "Jinc",
+        "NNEDI3 (16)", "NNEDI3 (32)", "NNEDI3 (64)", "NNEDI3 (128)",
+        "Super-xBR", "RAVU Lite", "RAVU"
+    };
+    upscale_algorithm.tooltip = "Luma upscaling algorithm (EWA Lanczos = best built-in)";
+    enhancements_tab.items.push_back(upscale_algorithm);
+
     menu.tabs.push_back(enhancements_tab);
 
     // Tab 5: Color
@@ -412,6 +428,14 @@ OSDMenuStructure createDefaultOSDMenu() {
     gpu_frame_time.tooltip = "GPU processing time per frame (target: 10-16ms @ 60Hz)";
     info_tab.items.push_back(gpu_frame_time);
 
+    MenuItem gpu_render_time;
+    gpu_render_time.id = "gpu_render_time";
+    gpu_render_time.label = "GPU Render Time";
+    gpu_render_time.type = MenuItemType::INFO;
+    gpu_render_time.info_text = "-- ms";
+    gpu_render_time.tooltip = "GPU execution time of the render pass (timestamp queries)";
+    info_tab.items.push_back(gpu_render_time);
+
     MenuItem gpu_frame_rate;
     gpu_frame_rate.id = "gpu_frame_rate";
     gpu_frame_rate.label = "GPU Frame Rate";
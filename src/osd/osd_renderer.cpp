@@ -1,5 +1,6 @@
 #include "osd_renderer.h"
 #include "core/logger.h"
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <cstdio>
@@ -53,11 +54,20 @@ Result OSDRenderer::initialize(uint32_t width, uint32_t height, const OSDConfig&
     pango_font_description_set_size(m_font_desc, config.font_size * PANGO_SCALE);
     pango_layout_set_font_description(m_layout, m_font_desc);
 
+    m_damage.clear();
+    m_cleared_damage.clear();
+    m_last_frame_damage.clear();
+    m_rendered_version = ~0ull;
+    m_full_damage = true;
+    m_surface_unchanged = false;
+
     m_initialized = true;
     return Result::SUCCESS;
 }
 
 void OSDRenderer::shutdown() {
+    clearTextCache();
+
     if (m_font_desc) {
         pango_font_description_free(m_font_desc);
         m_font_desc = nullptr;
@@ -84,6 +94,12 @@ void OSDRenderer::shutdown() {
 void OSDRenderer::beginFrame() {
     if (!m_initialized) return;
 
+    // Legacy full-redraw path: everything is damage
+    m_full_damage = true;
+    m_rendered_version = ~0ull;
+    m_surface_unchanged = false;
+    m_damage.clear();
+
     // Clear surface with transparent background
     cairo_save(m_cr);
     cairo_set_operator(m_cr, CAIRO_OPERATOR_CLEAR);
@@ -94,11 +110,121 @@ void OSDRenderer::beginFrame() {
     cairo_set_operator(m_cr, CAIRO_OPERATOR_OVER);
 }
 
+bool OSDRenderer::beginFrame(uint64_t content_version) {
+    if (!m_initialized) return false;
+
+    // Nothing changed since the last rendered frame: reuse the surface
+    // and skip rasterization entirely
+    if (content_version == m_rendered_version) {
+        m_surface_unchanged = true;
+        return false;
+    }
+
+    m_rendered_version = content_version;
+    m_surface_unchanged = false;
+    m_damage.clear();
+
+    if (m_full_damage || m_last_frame_damage.empty()) {
+        // First frame (or legacy caller mixed in): clear everything
+        m_full_damage = false;
+        m_cleared_damage.clear();
+        m_cleared_damage.push_back({0, 0, (int)m_width, (int)m_height});
+
+        cairo_save(m_cr);
+        cairo_set_operator(m_cr, CAIRO_OPERATOR_CLEAR);
+        cairo_paint(m_cr);
+        cairo_restore(m_cr);
+    } else {
+        // Clear only the regions the previous rendered frame drew into;
+        // the new frame's draws repaint (and re-damage) whatever
+        // replaces them
+        m_cleared_damage = m_last_frame_damage;
+
+        cairo_save(m_cr);
+        cairo_set_operator(m_cr, CAIRO_OPERATOR_CLEAR);
+        for (const auto& rect : m_cleared_damage) {
+            cairo_rectangle(m_cr, rect.x, rect.y, rect.width, rect.height);
+        }
+        cairo_fill(m_cr);
+        cairo_restore(m_cr);
+    }
+
+    cairo_set_operator(m_cr, CAIRO_OPERATOR_OVER);
+    return true;
+}
+
 void OSDRenderer::endFrame() {
     if (!m_initialized) return;
 
     // Flush Cairo surface to ensure all drawing is complete
     cairo_surface_flush(m_surface);
+
+    // Remember what this frame drew: the next redraw clears exactly
+    // these regions (skipped frames in between leave it untouched)
+    if (!m_surface_unchanged) {
+        m_last_frame_damage = m_damage;
+    }
+}
+
+DirtyRect OSDRenderer::getDamageBounds() const {
+    // A skipped frame left the surface bit-for-bit identical
+    if (m_surface_unchanged) {
+        return DirtyRect{};
+    }
+
+    // Union of what beginFrame cleared and what this frame drew —
+    // everything composition has to refresh
+    int min_x = (int)m_width, min_y = (int)m_height;
+    int max_x = 0, max_y = 0;
+
+    auto accumulate = [&](const std::vector<DirtyRect>& rects) {
+        for (const auto& rect : rects) {
+            min_x = std::min(min_x, rect.x);
+            min_y = std::min(min_y, rect.y);
+            max_x = std::max(max_x, rect.x + rect.width);
+            max_y = std::max(max_y, rect.y + rect.height);
+        }
+    };
+    accumulate(m_cleared_damage);
+    accumulate(m_damage);
+
+    if (max_x <= min_x || max_y <= min_y) {
+        return DirtyRect{};
+    }
+    return DirtyRect{min_x, min_y, max_x - min_x, max_y - min_y};
+}
+
+void OSDRenderer::markDirty(int x, int y, int width, int height) {
+    // Clamp to the surface
+    int x0 = std::max(x, 0);
+    int y0 = std::max(y, 0);
+    int x1 = std::min(x + width, (int)m_width);
+    int y1 = std::min(y + height, (int)m_height);
+    if (x1 <= x0 || y1 <= y0) {
+        return;
+    }
+
+    // Past a handful of rects the bookkeeping costs more than it saves:
+    // collapse into a single bounding box
+    if (m_damage.size() >= MAX_DAMAGE_RECTS) {
+        DirtyRect& bounds = m_damage[0];
+        int bx1 = std::max(bounds.x + bounds.width, x1);
+        int by1 = std::max(bounds.y + bounds.height, y1);
+        for (size_t i = 1; i < m_damage.size(); i++) {
+            bounds.x = std::min(bounds.x, m_damage[i].x);
+            bounds.y = std::min(bounds.y, m_damage[i].y);
+            bx1 = std::max(bx1, m_damage[i].x + m_damage[i].width);
+            by1 = std::max(by1, m_damage[i].y + m_damage[i].height);
+        }
+        bounds.x = std::min(bounds.x, x0);
+        bounds.y = std::min(bounds.y, y0);
+        bounds.width = bx1 - bounds.x;
+        bounds.height = by1 - bounds.y;
+        m_damage.resize(1);
+        return;
+    }
+
+    m_damage.push_back({x0, y0, x1 - x0, y1 - y0});
 }
 
 void OSDRenderer::setColor(uint32_t rgba) {
@@ -109,6 +235,92 @@ void OSDRenderer::setColor(uint32_t rgba) {
     cairo_set_source_rgba(m_cr, r, g, b, a);
 }
 
+const OSDRenderer::TextRun* OSDRenderer::getTextRun(const std::string& text,
+                                                    const std::string& font, int size) {
+    std::string key = font;
+    key += '\x1f';
+    key += std::to_string(size);
+    key += '\x1f';
+    key += text;
+
+    auto it = m_text_cache.find(key);
+    if (it != m_text_cache.end()) {
+        it->second.last_used = ++m_text_cache_clock;
+        m_text_cache_stats.hits++;
+        return &it->second;
+    }
+
+    m_text_cache_stats.misses++;
+
+    // Shape and measure the run once through Pango
+    setFont(font, size);
+    pango_layout_set_text(m_layout, text.c_str(), -1);
+
+    int width, height;
+    pango_layout_get_pixel_size(m_layout, &width, &height);
+    if (width <= 0 || height <= 0) {
+        width = std::max(width, 1);
+        height = std::max(height, 1);
+    }
+
+    // Rasterize its alpha coverage into an A8 mask
+    TextRun run;
+    run.surface = cairo_image_surface_create(CAIRO_FORMAT_A8, width, height);
+    if (cairo_surface_status(run.surface) != CAIRO_STATUS_SUCCESS) {
+        cairo_surface_destroy(run.surface);
+        return nullptr;
+    }
+
+    cairo_t* mask_cr = cairo_create(run.surface);
+    PangoLayout* mask_layout = pango_cairo_create_layout(mask_cr);
+    pango_layout_set_font_description(mask_layout, m_font_desc);
+    pango_layout_set_text(mask_layout, text.c_str(), -1);
+    cairo_set_source_rgba(mask_cr, 1.0, 1.0, 1.0, 1.0);
+    pango_cairo_show_layout(mask_cr, mask_layout);
+    g_object_unref(mask_layout);
+    cairo_destroy(mask_cr);
+    cairo_surface_flush(run.surface);
+
+    run.width = width;
+    run.height = height;
+    run.last_used = ++m_text_cache_clock;
+
+    // Bounded cache: evict the least recently used run
+    if (m_text_cache.size() >= MAX_TEXT_RUNS) {
+        auto oldest = m_text_cache.begin();
+        for (auto entry = m_text_cache.begin(); entry != m_text_cache.end(); ++entry) {
+            if (entry->second.last_used < oldest->second.last_used) {
+                oldest = entry;
+            }
+        }
+        cairo_surface_destroy(oldest->second.surface);
+        m_text_cache.erase(oldest);
+        m_text_cache_stats.evictions++;
+    }
+
+    auto inserted = m_text_cache.emplace(std::move(key), run);
+    return &inserted.first->second;
+}
+
+void OSDRenderer::paintTextRun(const TextRun& run, int x, int y, uint32_t color) {
+    setColor(color);
+    cairo_mask_surface(m_cr, run.surface, x, y);
+}
+
+void OSDRenderer::clearTextCache() {
+    for (auto& entry : m_text_cache) {
+        cairo_surface_destroy(entry.second.surface);
+    }
+    m_text_cache.clear();
+    m_text_cache_clock = 0;
+}
+
+OSDRenderer::TextCacheStats OSDRenderer::getTextCacheStats() const {
+    TextCacheStats stats = m_text_cache_stats;
+    stats.entries = m_text_cache.size();
+    return stats;
+}
+
 void OSDRenderer::setFont(const std::string& font, int size) {
     if (m_font_desc) {
         pango_font_description_free(m_font_desc);
@@ -121,37 +333,24 @@ void OSDRenderer::setFont(const std::string& font, int size) {
 void OSDRenderer::drawText(const std::string& text, int x, int y, const OSDConfig& config) {
     if (!m_initialized) return;
 
-    // Set font
-    setFont(config.font_family, config.font_size);
+    // Shaped once, painted from the cache thereafter; the shadow reuses
+    // the same coverage mask in the shadow color
+    const TextRun* run = getTextRun(text, config.font_family, config.font_size);
+    if (!run) return;
 
-    // Set text color
-    setColor(config.text_color);
+    markDirty(x, y, run->width + 2, run->height + 2);  // +2 covers the shadow
 
-    // Set text
-    pango_layout_set_text(m_layout, text.c_str(), -1);
-
-    // Move to position
-    cairo_move_to(m_cr, x, y);
-
-    // Draw text with shadow if enabled
     if (config.text_shadow) {
-        cairo_save(m_cr);
-        cairo_move_to(m_cr, x + 2, y + 2);
-        setColor(config.shadow_color);
-        pango_cairo_show_layout(m_cr, m_layout);
-        cairo_restore(m_cr);
-
-        cairo_move_to(m_cr, x, y);
-        setColor(config.text_color);
+        paintTextRun(*run, x + 2, y + 2, config.shadow_color);
     }
-
-    // Draw text
-    pango_cairo_show_layout(m_cr, m_layout);
+    paintTextRun(*run, x, y, config.text_color);
 }
 
 void OSDRenderer::drawRectangle(int x, int y, int width, int height, uint32_t color, bool filled) {
     if (!m_initialized) return;
 
+    markDirty(x - 1, y - 1, width + 2, height + 2);  // include stroke width
+
     setColor(color);
     cairo_rectangle(m_cr, x, y, width, height);
 
@@ -166,6 +365,8 @@ void OSDRenderer::drawTab(const std::string& title, int x, int y, int width, int
                           bool active, const OSDConfig& config) {
     if (!m_initialized) return;
 
+    markDirty(x - 1, y - 1, width + 2, height + 2);
+
     // Draw tab background
     uint32_t bg_color = active ? config.tab_active_bg : config.tab_inactive_bg;
     drawRectangle(x, y, width, height, bg_color, true);
@@ -178,26 +379,23 @@ void OSDRenderer::drawTab(const std::string& title, int x, int y, int width, int
         cairo_stroke(m_cr);
     }
 
-    // Draw tab text (centered)
-    setFont(config.font_family, config.font_size);
-    pango_layout_set_text(m_layout, title.c_str(), -1);
+    // Draw tab text (centered); measurement comes free with the cached run
+    const TextRun* run = getTextRun(title, config.font_family, config.font_size);
+    if (!run) return;
 
-    int text_width, text_height;
-    pango_layout_get_pixel_size(m_layout, &text_width, &text_height);
-
-    int text_x = x + (width - text_width) / 2;
-    int text_y = y + (height - text_height) / 2;
+    int text_x = x + (width - run->width) / 2;
+    int text_y = y + (height - run->height) / 2;
 
     uint32_t text_color = active ? config.tab_active_text : config.tab_inactive_text;
-    setColor(text_color);
-    cairo_move_to(m_cr, text_x, text_y);
-    pango_cairo_show_layout(m_cr, m_layout);
+    paintTextRun(*run, text_x, text_y, text_color);
 }
 
 void OSDRenderer::drawMenuItem(const MenuItem& item, int x, int y, int width, int height,
                                bool selected, const OSDConfig& config) {
     if (!m_initialized) return;
 
+    markDirty(x, y, width, height);
+
     // Draw selection highlight
     if (selected) {
         drawRectangle(x, y, width, height, config.selection_color, true);
@@ -215,27 +413,24 @@ void OSDRenderer::drawMenuItem(const MenuItem& item, int x, int y, int width, in
     }
 
     // Draw item label
-    setFont(config.font_family, config.font_size);
     uint32_t text_color = item.enabled ? config.text_color : config.disabled_text_color;
     if (selected) {
         text_color = config.selected_text_color;
     }
-    setColor(text_color);
 
-    pango_layout_set_text(m_layout, item.label.c_str(), -1);
-    cairo_move_to(m_cr, text_x, y + (height - config.font_size) / 2);
-    pango_cairo_show_layout(m_cr, m_layout);
+    const TextRun* label_run = getTextRun(item.label, config.font_family, config.font_size);
+    if (label_run) {
+        paintTextRun(*label_run, text_x, y + (height - config.font_size) / 2, text_color);
+    }
 
     // Draw value if present
     if (!item.value.empty()) {
-        setColor(selected ? config.selected_text_color : config.value_color);
-        pango_layout_set_text(m_layout, item.value.c_str(), -1);
-
-        int value_width;
-        pango_layout_get_pixel_size(m_layout, &value_width, nullptr);
-
-        cairo_move_to(m_cr, x + width - value_width - 10, y + (height - config.font_size) / 2);
-        pango_cairo_show_layout(m_cr, m_layout);
+        const TextRun* value_run = getTextRun(item.value, config.font_family, config.font_size);
+        if (value_run) {
+            uint32_t value_color = selected ? config.selected_text_color : config.value_color;
+            paintTextRun(*value_run, x + width - value_run->width - 10,
+                         y + (height - config.font_size) / 2, value_color);
+        }
     }
 
     // Draw submenu indicator
@@ -259,17 +454,16 @@ void OSDRenderer::drawSlider(const std::string& label, float value, float min, f
     int bar_height = 8;
     int handle_size = 16;
 
+    markDirty(x, y, width, config.font_size + slider_height + 15);
+
     // Draw label
-    setFont(config.font_family, config.font_size);
     uint32_t text_color = selected ? config.selected_text_color : config.text_color;
-    setColor(text_color);
 
-    pango_layout_set_text(m_layout, label.c_str(), -1);
-    cairo_move_to(m_cr, x, y);
-    pango_cairo_show_layout(m_cr, m_layout);
+    const TextRun* label_run = getTextRun(label, config.font_family, config.font_size);
+    if (!label_run) return;
+    paintTextRun(*label_run, x, y, text_color);
 
-    int label_height;
-    pango_layout_get_pixel_size(m_layout, nullptr, &label_height);
+    int label_height = label_run->height;
 
     // Calculate slider bar position
     int bar_y = y + label_height + 5;
@@ -298,19 +492,18 @@ void OSDRenderer::drawSlider(const std::string& label, float value, float min, f
     // Draw value text
     char value_text[32];
     snprintf(value_text, sizeof(value_text), "%.2f", value);
-    pango_layout_set_text(m_layout, value_text, -1);
-
-    int value_width;
-    pango_layout_get_pixel_size(m_layout, &value_width, nullptr);
 
-    setColor(text_color);
-    cairo_move_to(m_cr, x + width - value_width, y);
-    pango_cairo_show_layout(m_cr, m_layout);
+    const TextRun* value_run = getTextRun(value_text, config.font_family, config.font_size);
+    if (value_run) {
+        paintTextRun(*value_run, x + width - value_run->width, y, text_color);
+    }
 }
 
 void OSDRenderer::drawProgressBar(float progress, int x, int y, int width, int height, uint32_t color) {
     if (!m_initialized) return;
 
+    markDirty(x - 1, y - 1, width + 2, height + 2);
+
     // Draw background
     drawRectangle(x, y, width, height, 0x404040FF, true);
 
@@ -335,6 +528,9 @@ void OSDRenderer::drawVolumeOverlay(int level, bool muted, float opacity) {
     const int x = m_width - overlay_width - margin;
     const int y = m_height - overlay_height - margin;
 
+    // The overlay is self-contained: one dirty rect, not a full repaint
+    markDirty(x - 2, y - 2, overlay_width + 4, overlay_height + 4);
+
     // Background with rounded corners and opacity
     cairo_save(m_cr);
 
@@ -434,20 +630,21 @@ void OSDRenderer::drawVolumeOverlay(int level, bool muted, float opacity) {
     const int text_y = y + 70;
 
     cairo_save(m_cr);
-    setFont(m_config.font_family, 36);
 
     char volume_text[32];
+    uint32_t volume_color;
     if (muted) {
         snprintf(volume_text, sizeof(volume_text), "MUTED");
-        setColor(0xFF4040FF);  // Red
+        volume_color = 0xFF4040FF;  // Red
     } else {
         snprintf(volume_text, sizeof(volume_text), "%d%%", level);
-        setColor(0xFFFFFFFF);  // White
+        volume_color = 0xFFFFFFFF;  // White
     }
 
-    pango_layout_set_text(m_layout, volume_text, -1);
-    cairo_move_to(m_cr, text_x, text_y);
-    pango_cairo_show_layout(m_cr, m_layout);
+    const TextRun* volume_run = getTextRun(volume_text, m_config.font_family, 36);
+    if (volume_run) {
+        paintTextRun(*volume_run, text_x, text_y, volume_color);
+    }
     cairo_restore(m_cr);
 
     // Volume bar
@@ -489,6 +686,24 @@ void OSDRenderer::drawVolumeOverlay(int level, bool muted, float opacity) {
     cairo_restore(m_cr);
 }
 
+void OSDRenderer::drawLatencyMarker(bool state) {
+    if (!m_initialized) return;
+
+    // Solid square in the top-left corner, alternating black/white per
+    // frame, for external glass-to-glass measurement (photodiode or
+    // high-speed camera aimed at this corner of the panel)
+    const int size = 64;
+
+    markDirty(0, 0, size, size);
+
+    cairo_save(m_cr);
+    double v = state ? 1.0 : 0.0;
+    cairo_set_source_rgba(m_cr, v, v, v, 1.0);
+    cairo_rectangle(m_cr, 0, 0, size, size);
+    cairo_fill(m_cr);
+    cairo_restore(m_cr);
+}
+
 const uint8_t* OSDRenderer::getSurfaceData() const {
     if (!m_initialized || !m_surface) {
         return nullptr;
@@ -573,27 +788,36 @@ void OSDCompositor::shutdown() {
 
 Result OSDCompositor::composite(const VideoFrame& video, const uint8_t* osd_data,
                                 uint32_t osd_width, uint32_t osd_height,
-                                VideoFrame& output, const OSDConfig& config) {
+                                VideoFrame& output, const OSDConfig& config,
+                                const DirtyRect* damage) {
     if (!m_initialized) {
         return Result::ERROR_NOT_INITIALIZED;
     }
 
-    // Allocate output frame
+    // Frame metadata (payload allocated below depending on path)
     size_t output_size = video.width * video.height * 3;  // RGB 8-bit
-    output.data = new uint8_t[output_size];
-    output.size = output_size;
+    output.data = nullptr;
+    output.size = 0;
     output.width = video.width;
     output.height = video.height;
     output.format = video.format;
     output.pts = video.pts;
     output.hdr_metadata = video.hdr_metadata;
 
+    // CPU fallback needs CPU-side video data; GPU-resident input forces GPU path
+    if (!m_gpu && video.gpu_tex) {
+        LOG_ERROR("OSD", "GPU-resident input but compositor has no GPU");
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
     if (m_gpu) {
         // Use libplacebo for GPU-based compositing
         LOG_DEBUG("OSD", "Using GPU-accelerated OSD compositing");
 
-        // Create or update video texture
-        if (!m_video_tex || m_video_width != video.width || m_video_height != video.height) {
+        // Create or update video texture (skipped when the video frame is
+        // already GPU-resident from the previous stage)
+        if (!video.gpu_tex &&
+            (!m_video_tex || m_video_width != video.width || m_video_height != video.height)) {
             if (m_video_tex) {
                 pl_tex_destroy(m_gpu, &m_video_tex);
             }
@@ -659,34 +883,54 @@ Result OSDCompositor::composite(const VideoFrame& video, const uint8_t* osd_data
             }
         }
 
-        // Upload video data to GPU
-        struct pl_tex_transfer_params video_upload_params = {};
-        video_upload_params.tex = m_video_tex;
-        video_upload_params.ptr = (void*)video.data;
-        video_upload_params.row_pitch = video.width * 3;
-        bool upload_ok = pl_tex_upload(m_gpu, &video_upload_params);
+        // Upload video data to GPU (not needed when GPU-resident)
+        pl_tex video_tex = (pl_tex)video.gpu_tex;
+        if (!video_tex) {
+            struct pl_tex_transfer_params video_upload_params = {};
+            video_upload_params.tex = m_video_tex;
+            video_upload_params.ptr = (void*)video.data;
+            video_upload_params.row_pitch = video.width * 3;
+            bool upload_ok = pl_tex_upload(m_gpu, &video_upload_params);
+
+            if (!upload_ok) {
+                LOG_ERROR("OSD", "Failed to upload video data to GPU");
+                return Result::ERROR_GENERIC;
+            }
 
-        if (!upload_ok) {
-            LOG_ERROR("OSD", "Failed to upload video data to GPU");
-            return Result::ERROR_GENERIC;
+            video_tex = m_video_tex;
         }
 
-        // Upload OSD data to GPU
-        struct pl_tex_transfer_params osd_upload_params = {};
-        osd_upload_params.tex = m_osd_tex;
-        osd_upload_params.ptr = (void*)osd_data;
-        osd_upload_params.row_pitch = osd_width * 4;
-        upload_ok = pl_tex_upload(m_gpu, &osd_upload_params);
+        // Upload OSD data to GPU. The texture persists between frames,
+        // so when the renderer reports damage only that region needs
+        // uploading; an empty damage rect means the texture is current
+        bool osd_changed = !damage || !damage->empty();
+        if (osd_changed) {
+            struct pl_tex_transfer_params osd_upload_params = {};
+            osd_upload_params.tex = m_osd_tex;
+            osd_upload_params.row_pitch = osd_width * 4;
+
+            if (damage && ((uint32_t)damage->width < osd_width ||
+                           (uint32_t)damage->height < osd_height)) {
+                osd_upload_params.rc.x0 = damage->x;
+                osd_upload_params.rc.y0 = damage->y;
+                osd_upload_params.rc.x1 = damage->x + damage->width;
+                osd_upload_params.rc.y1 = damage->y + damage->height;
+                osd_upload_params.ptr = (void*)(osd_data +
+                    (size_t)damage->y * osd_width * 4 + (size_t)damage->x * 4);
+            } else {
+                osd_upload_params.ptr = (void*)osd_data;
+            }
 
-        if (!upload_ok) {
-            LOG_ERROR("OSD", "Failed to upload OSD data to GPU");
-            return Result::ERROR_GENERIC;
+            if (!pl_tex_upload(m_gpu, &osd_upload_params)) {
+                LOG_ERROR("OSD", "Failed to upload OSD data to GPU");
+                return Result::ERROR_GENERIC;
+            }
         }
 
         // Use libplacebo's built-in alpha blending
         // First, copy video to output
         struct pl_tex_blit_params video_blit_params = {};
-        video_blit_params.src = m_video_tex;
+        video_blit_params.src = video_tex;
         video_blit_params.dst = m_output_tex;
         pl_tex_blit(m_gpu, &video_blit_params);
 
@@ -702,7 +946,17 @@ Result OSDCompositor::composite(const VideoFrame& video, const uint8_t* osd_data
         // libplacebo will respect the alpha channel in the OSD texture
         pl_tex_blit(m_gpu, &osd_blit_params);
 
-        // Download result from GPU
+        // GPU-resident output: hand the texture to the presenter, no readback
+        if (m_gpu_resident) {
+            output.gpu_tex = (void*)m_output_tex;
+            LOG_DEBUG("OSD", "GPU compositing completed (GPU-resident)");
+            return Result::SUCCESS;
+        }
+
+        // Download result from GPU (debug fallback)
+        output.data = new uint8_t[output_size];
+        output.size = output_size;
+
         struct pl_tex_transfer_params download_params = {};
         download_params.tex = m_output_tex;
         download_params.ptr = output.data;
@@ -711,6 +965,9 @@ Result OSDCompositor::composite(const VideoFrame& video, const uint8_t* osd_data
 
         if (!download_ok) {
             LOG_ERROR("OSD", "Failed to download composited frame from GPU");
+            delete[] output.data;
+            output.data = nullptr;
+            output.size = 0;
             return Result::ERROR_GENERIC;
         }
 
@@ -723,6 +980,8 @@ cpu_fallback:
     LOG_DEBUG("OSD", "Using CPU alpha blending fallback");
 
     // Copy video as base
+    output.data = new uint8_t[output_size];
+    output.size = output_size;
     std::memcpy(output.data, video.data, output_size);
 
     // Blend OSD over video with alpha channel
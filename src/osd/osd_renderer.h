@@ -7,11 +7,23 @@
 #include <vulkan/vulkan.h>
 #include <libplacebo/gpu.h>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ares {
 namespace osd {
 
+// Damaged area of the OSD surface, in surface pixels
+struct DirtyRect {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+
+    bool empty() const { return width <= 0 || height <= 0; }
+};
+
 // OSD rendering with Cairo/Pango for text and graphics
 class OSDRenderer {
 public:
@@ -30,9 +42,21 @@ public:
     // Begin frame (clear surface)
     void beginFrame();
 
+    // Begin frame with damage tracking: content_version identifies what
+    // the caller is about to draw (bump it on any state change). When it
+    // matches the previously rendered frame, returns false and the
+    // caller skips all drawing — the surface is reused as-is. Otherwise
+    // only the previous frame's damaged regions are cleared and draw
+    // operations accumulate this frame's damage
+    bool beginFrame(uint64_t content_version);
+
     // End frame (prepare for display)
     void endFrame();
 
+    // Area composition needs to touch: union of the previous and current
+    // frame's damage. An empty rect means the surface is unchanged
+    DirtyRect getDamageBounds() const;
+
     // Drawing operations
     void drawText(const std::string& text, int x, int y, const OSDConfig& config);
     void drawRectangle(int x, int y, int width, int height, uint32_t color, bool filled = true);
@@ -47,6 +71,10 @@ public:
     // Volume overlay (bottom right corner)
     void drawVolumeOverlay(int level, bool muted, float opacity = 1.0f);
 
+    // Latency measurement marker: alternating black/white corner square
+    // for external glass-to-glass capture (see sync::LatencyTracer)
+    void drawLatencyMarker(bool state);
+
     // Get rendered surface data (RGBA8)
     const uint8_t* getSurfaceData() const;
     size_t getSurfaceDataSize() const;
@@ -58,7 +86,36 @@ public:
     // Get configuration
     const OSDConfig& getConfig() const { return m_config; }
 
+    // Text run cache statistics
+    struct TextCacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t entries = 0;
+    };
+
+    TextCacheStats getTextCacheStats() const;
+
 private:
+    // A shaped and rasterized text run: the string's alpha coverage at a
+    // given font/size, shaped through Pango exactly once. Color is
+    // applied at paint time via cairo_mask_surface, so one cached run
+    // serves every color it's drawn in (including its own shadow)
+    struct TextRun {
+        cairo_surface_t* surface = nullptr;  // A8 coverage mask
+        int width = 0;
+        int height = 0;
+        uint64_t last_used = 0;
+    };
+
+    // Look up (or shape and rasterize) a run. Returned pointer is valid
+    // until the next cache mutation
+    const TextRun* getTextRun(const std::string& text, const std::string& font, int size);
+
+    // Paint a cached run at (x, y) in the current source color
+    void paintTextRun(const TextRun& run, int x, int y, uint32_t color);
+
+    void clearTextCache();
     // Cairo context
     cairo_surface_t* m_surface = nullptr;
     cairo_t* m_cr = nullptr;
@@ -77,6 +134,30 @@ private:
     // State
     bool m_initialized = false;
 
+    // Damage tracking: draw operations record their bounding boxes so
+    // clears and composition only touch what actually changed.
+    // m_damage accumulates during the current frame; m_cleared_damage is
+    // what beginFrame just erased (the previous rendered frame's
+    // content); m_last_frame_damage persists across skipped frames so a
+    // later redraw still knows what to clear
+    std::vector<DirtyRect> m_damage;
+    std::vector<DirtyRect> m_cleared_damage;
+    std::vector<DirtyRect> m_last_frame_damage;
+    uint64_t m_rendered_version = ~0ull;
+    bool m_full_damage = true;      // first frame / after resize
+    bool m_surface_unchanged = false;
+    static constexpr size_t MAX_DAMAGE_RECTS = 16;
+
+    void markDirty(int x, int y, int width, int height);
+
+    // Shaped-run cache, keyed by (font, size, text). Bounded LRU: the
+    // automation overlays redraw the same strings every frame, so
+    // steady-state text drawing is a mask blit from here
+    static constexpr size_t MAX_TEXT_RUNS = 256;
+    std::unordered_map<std::string, TextRun> m_text_cache;
+    uint64_t m_text_cache_clock = 0;
+    TextCacheStats m_text_cache_stats;
+
     // Helper functions
     void setColor(uint32_t rgba);
     void setFont(const std::string& font, int size);
@@ -94,10 +175,15 @@ public:
     // Shutdown
     void shutdown();
 
-    // Composite OSD over video frame
+    // Composite OSD over video frame. When damage is given and smaller
+    // than the surface, only that region is uploaded/blended
     Result composite(const VideoFrame& video, const uint8_t* osd_data,
                     uint32_t osd_width, uint32_t osd_height,
-                    VideoFrame& output, const OSDConfig& config);
+                    VideoFrame& output, const OSDConfig& config,
+                    const DirtyRect* damage = nullptr);
+
+    // Enable GPU-resident output (skip readback, hand texture to next stage)
+    void setGPUResident(bool enabled) { m_gpu_resident = enabled; }
 
 private:
     VkDevice m_device = VK_NULL_HANDLE;
@@ -123,6 +209,7 @@ private:
     uint32_t m_osd_height = 0;
 
     bool m_initialized = false;
+    bool m_gpu_resident = false;
 };
 
 } // namespace osd
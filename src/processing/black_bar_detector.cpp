@@ -13,15 +13,16 @@ BlackBarDetector::BlackBarDetector() {
     LOG_INFO("Processing", "BlackBarDetector created");
 }
 
-BlackBarDetector::~BlackBarDetector() = default;
-
-void BlackBarDetector::analyzeFrame(const VideoFrame& frame, const BlackBarConfig& config) {
-    if (!config.enabled) {
-        return;
+BlackBarDetector::~BlackBarDetector() {
+    if (m_row_profile_tex) {
+        pl_tex_destroy(m_gpu, &m_row_profile_tex);
     }
+    if (m_col_profile_tex) {
+        pl_tex_destroy(m_gpu, &m_col_profile_tex);
+    }
+}
 
-    m_stats.frames_analyzed++;
-
+bool BlackBarDetector::applyOverrides(const BlackBarConfig& config) {
     // Manual crop overrides detection
     if (config.manual_crop.enabled) {
         m_current_crop.top = config.manual_crop.top;
@@ -30,17 +31,21 @@ void BlackBarDetector::analyzeFrame(const VideoFrame& frame, const BlackBarConfi
         m_current_crop.right = config.manual_crop.right;
         m_current_crop.confidence = 1.0f;
         m_current_crop.is_symmetric = true;
-        return;
+        return true;
     }
 
+    // In-process bootstrap runs the normal detection path at full rate
+    // (handled in updateDetection), so it never pre-empts detection
+
     // FFmpeg bootstrap phase (skip detection during delay and bootstrap)
-    if (config.use_ffmpeg_bootstrap && !m_bootstrap_complete) {
+    if (config.use_ffmpeg_bootstrap && !config.use_inprocess_bootstrap &&
+        !m_bootstrap_complete) {
         // Calculate delay in frames (assume 60fps for simplicity)
         uint64_t delay_frames = static_cast<uint64_t>(config.bootstrap_delay * 60.0f);
 
         if (m_stats.frames_analyzed <= delay_frames) {
             // Still in delay period - don't detect anything yet
-            return;
+            return true;
         }
 
         // Bootstrap period active - use FFmpeg-detected crop if available
@@ -48,6 +53,20 @@ void BlackBarDetector::analyzeFrame(const VideoFrame& frame, const BlackBarConfi
             m_current_crop = m_bootstrap_crop;
             m_stable_crop = m_bootstrap_crop;
         }
+        return true;
+    }
+
+    return false;
+}
+
+void BlackBarDetector::analyzeFrame(const VideoFrame& frame, const BlackBarConfig& config) {
+    if (!config.enabled) {
+        return;
+    }
+
+    m_stats.frames_analyzed++;
+
+    if (applyOverrides(config)) {
         return;
     }
 
@@ -59,9 +78,130 @@ void BlackBarDetector::analyzeFrame(const VideoFrame& frame, const BlackBarConfi
     analyzeHorizontal(luma, frame.width, frame.height, config.threshold, top, bottom);
     analyzeVertical(luma, frame.width, frame.height, config.threshold, left, right);
 
+    updateDetection(top, bottom, left, right, frame.width, frame.height, config);
+}
+
+bool BlackBarDetector::analyzeFrameGPU(pl_gpu gpu, pl_tex source, const VideoFrame& frame,
+                                       const BlackBarConfig& config) {
+    if (!config.enabled) {
+        return true;
+    }
+
+    if (!gpu || !source) {
+        return false;
+    }
+
+    m_gpu = gpu;
+
+    // Lazily create the 1-pixel-wide profile targets
+    if (!m_row_profile_tex) {
+        pl_fmt fmt = pl_find_fmt(gpu, PL_FMT_UNORM, 4, 0, 8,
+                                 static_cast<pl_fmt_caps>(PL_FMT_CAP_BLITTABLE | PL_FMT_CAP_HOST_READABLE));
+
+        struct pl_tex_params row_params = {};
+        row_params.w = 1;
+        row_params.h = PROFILE_SIZE;
+        row_params.format = fmt;
+        row_params.blit_dst = true;
+        row_params.host_readable = true;
+        m_row_profile_tex = pl_tex_create(gpu, &row_params);
+
+        struct pl_tex_params col_params = {};
+        col_params.w = PROFILE_SIZE;
+        col_params.h = 1;
+        col_params.format = fmt;
+        col_params.blit_dst = true;
+        col_params.host_readable = true;
+        m_col_profile_tex = pl_tex_create(gpu, &col_params);
+
+        if (!m_row_profile_tex || !m_col_profile_tex) {
+            LOG_WARN("Processing", "Failed to create profile textures, using CPU bar detection");
+            return false;
+        }
+
+        m_row_profile_buf.resize((size_t)PROFILE_SIZE * 4);
+        m_col_profile_buf.resize((size_t)PROFILE_SIZE * 4);
+        LOG_INFO("Processing", "GPU black bar detection enabled (%d-line profiles)", PROFILE_SIZE);
+    }
+
+    m_stats.frames_analyzed++;
+
+    if (applyOverrides(config)) {
+        return true;
+    }
+
+    // GPU reduction: a linear blit collapses every row (and every column)
+    // to a single averaged value, so only 2 x 4 KB cross the bus. A black
+    // bar row averages to ~0 while any content row averages well above
+    // the threshold.
+    struct pl_tex_blit_params row_blit = {};
+    row_blit.src = source;
+    row_blit.dst = m_row_profile_tex;
+    row_blit.sample_mode = PL_TEX_SAMPLE_LINEAR;
+    pl_tex_blit(gpu, &row_blit);
+
+    struct pl_tex_blit_params col_blit = {};
+    col_blit.src = source;
+    col_blit.dst = m_col_profile_tex;
+    col_blit.sample_mode = PL_TEX_SAMPLE_LINEAR;
+    pl_tex_blit(gpu, &col_blit);
+
+    struct pl_tex_transfer_params row_download = {};
+    row_download.tex = m_row_profile_tex;
+    row_download.ptr = m_row_profile_buf.data();
+
+    struct pl_tex_transfer_params col_download = {};
+    col_download.tex = m_col_profile_tex;
+    col_download.ptr = m_col_profile_buf.data();
+
+    if (!pl_tex_download(gpu, &row_download) || !pl_tex_download(gpu, &col_download)) {
+        LOG_WARN("Processing", "Profile readback failed");
+        return false;
+    }
+
+    // Scan the profiles the same way the CPU path scans rows/columns
+    auto profile_luma = [](const std::vector<uint8_t>& buf, int idx) {
+        const uint8_t* px = buf.data() + (size_t)idx * 4;
+        return (int)(0.2126f * px[0] + 0.7152f * px[1] + 0.0722f * px[2]);
+    };
+
+    int top = 0, bottom = 0, left = 0, right = 0;
+
+    for (int i = 0; i < PROFILE_SIZE / 2; i++) {
+        if (profile_luma(m_row_profile_buf, i) > config.threshold) {
+            top = (int)((int64_t)i * frame.height / PROFILE_SIZE);
+            break;
+        }
+    }
+    for (int i = PROFILE_SIZE - 1; i > PROFILE_SIZE / 2; i--) {
+        if (profile_luma(m_row_profile_buf, i) > config.threshold) {
+            bottom = (int)((int64_t)(PROFILE_SIZE - 1 - i) * frame.height / PROFILE_SIZE);
+            break;
+        }
+    }
+    for (int i = 0; i < PROFILE_SIZE / 2; i++) {
+        if (profile_luma(m_col_profile_buf, i) > config.threshold) {
+            left = (int)((int64_t)i * frame.width / PROFILE_SIZE);
+            break;
+        }
+    }
+    for (int i = PROFILE_SIZE - 1; i > PROFILE_SIZE / 2; i--) {
+        if (profile_luma(m_col_profile_buf, i) > config.threshold) {
+            right = (int)((int64_t)(PROFILE_SIZE - 1 - i) * frame.width / PROFILE_SIZE);
+            break;
+        }
+    }
+
+    updateDetection(top, bottom, left, right, frame.width, frame.height, config);
+    return true;
+}
+
+void BlackBarDetector::updateDetection(int top, int bottom, int left, int right,
+                                       uint32_t width, uint32_t height,
+                                       const BlackBarConfig& config) {
     // Check minimum content size
-    float content_height = (frame.height - top - bottom) / (float)frame.height;
-    float content_width = (frame.width - left - right) / (float)frame.width;
+    float content_height = (height - top - bottom) / (float)height;
+    float content_width = (width - left - right) / (float)width;
 
     if (content_height < config.min_content_height ||
         content_width < config.min_content_width) {
@@ -70,7 +210,7 @@ void BlackBarDetector::analyzeFrame(const VideoFrame& frame, const BlackBarConfi
     }
 
     // Check symmetry if required
-    bool symmetric = isSymmetric(top, bottom, left, right, frame.width, frame.height);
+    bool symmetric = isSymmetric(top, bottom, left, right, width, height);
     if (config.symmetric_only && !symmetric) {
         top = bottom = left = right = 0;
     }
@@ -99,6 +239,38 @@ void BlackBarDetector::analyzeFrame(const VideoFrame& frame, const BlackBarConfi
         m_current_crop = new_crop;
     }
 
+    // In-process bootstrap: right after an input change, accept a crop at
+    // a relaxed confidence bar so lock-on takes ~1 second instead of
+    // waiting for the full steady-state history to agree
+    if (config.use_inprocess_bootstrap && !m_bootstrap_complete) {
+        m_bootstrap_frames_sampled++;
+
+        if (new_crop.confidence >= config.bootstrap_confidence &&
+            (int)m_history.size() >= config.detection_frames) {
+            m_stable_crop = new_crop;
+            m_current_crop = new_crop;
+            seedHistoryWithBootstrap(new_crop);
+            m_bootstrap_complete = true;
+            m_stats.bars_detected++;
+
+            LOG_INFO("Processing", "In-process bootstrap locked crop after %lu frames "
+                     "(TBLR={%d,%d,%d,%d}, confidence=%.2f)",
+                     (unsigned long)m_bootstrap_frames_sampled,
+                     new_crop.top, new_crop.bottom, new_crop.left, new_crop.right,
+                     new_crop.confidence);
+        } else if (m_bootstrap_frames_sampled >= (uint64_t)config.bootstrap_frames) {
+            // No confident crop in the bootstrap window; fall through to
+            // steady-state detection with the normal threshold
+            m_bootstrap_complete = true;
+            LOG_INFO("Processing", "In-process bootstrap found no stable crop in %d frames",
+                     config.bootstrap_frames);
+        }
+
+        m_stats.current_confidence = new_crop.confidence;
+        m_stats.current_crop = m_current_crop;
+        return;
+    }
+
     // Update stable crop if confidence is high
     if (new_crop.confidence >= config.confidence_threshold) {
         m_stable_crop = new_crop;
@@ -270,6 +442,7 @@ void BlackBarDetector::reset() {
     m_bootstrap_crop = CropRegion();
     m_bootstrap_complete = false;
     m_bootstrap_delay_frames = 0;
+    m_bootstrap_frames_sampled = 0;
     LOG_INFO("Processing", "BlackBarDetector reset");
 }
 
@@ -2,6 +2,7 @@
 
 #include <ares/types.h>
 #include <ares/processing_config.h>
+#include <libplacebo/gpu.h>
 #include <vector>
 #include <deque>
 
@@ -27,7 +28,19 @@ public:
     // Analyze frame for black bars
     void analyzeFrame(const VideoFrame& frame, const BlackBarConfig& config);
 
+    // GPU analysis path: reduce the uploaded source texture to per-row and
+    // per-column luma profiles (linear blits down to 1-pixel-wide strips),
+    // read back a few KB and scan those instead of walking frame pixels.
+    // Cheap enough to run every frame, so crop lock-on is not throttled.
+    // Returns false when the GPU path is unavailable (caller falls back to
+    // the CPU scan).
+    bool analyzeFrameGPU(pl_gpu gpu, pl_tex source, const VideoFrame& frame,
+                         const BlackBarConfig& config);
+
     // Bootstrap detection using FFmpeg cropdetect
+    // Deprecated in favor of the in-process bootstrap (see
+    // BlackBarConfig::use_inprocess_bootstrap), which needs no external
+    // process and no second capture of the signal
     Result bootstrapWithFFmpeg(const std::string& video_source,
                               uint32_t frame_width, uint32_t frame_height,
                               const BlackBarConfig& config);
@@ -55,6 +68,16 @@ public:
     Stats getStats() const;
 
 private:
+    // Shared override handling (manual crop, bootstrap phase)
+    // Returns true when detection is pre-empted for this frame
+    bool applyOverrides(const BlackBarConfig& config);
+
+    // Shared back half of detection: content-size/symmetry checks,
+    // history, confidence and smoothing (used by CPU and GPU paths)
+    void updateDetection(int top, int bottom, int left, int right,
+                         uint32_t width, uint32_t height,
+                         const BlackBarConfig& config);
+
     // Analyze horizontal bars (letterbox)
     void analyzeHorizontal(const uint8_t* data, uint32_t width, uint32_t height,
                           int threshold, int& top, int& bottom);
@@ -92,6 +115,15 @@ private:
     // Bootstrap state
     bool m_bootstrap_complete = false;
     uint64_t m_bootstrap_delay_frames = 0;
+    uint64_t m_bootstrap_frames_sampled = 0;
+
+    // GPU edge-profile resources (lazily created on first GPU analysis)
+    static constexpr int PROFILE_SIZE = 1024;
+    pl_gpu m_gpu = nullptr;
+    pl_tex m_row_profile_tex = nullptr;  // 1 x PROFILE_SIZE (per-row luma)
+    pl_tex m_col_profile_tex = nullptr;  // PROFILE_SIZE x 1 (per-column luma)
+    std::vector<uint8_t> m_row_profile_buf;
+    std::vector<uint8_t> m_col_profile_buf;
 
     // Statistics
     mutable Stats m_stats;
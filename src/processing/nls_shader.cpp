@@ -23,9 +23,14 @@ layout(push_constant) uniform PushConstants {
     float centerProtect;
     vec2 inputSize;
     vec2 outputSize;
-    uint interpolationQuality;
+    vec4 sourceRect;        // Normalized source sub-rect (x, y, w, h)
 } params;
 
+// Interpolation quality is a specialization constant, not a push
+// constant: it only changes from the menu, so each quality gets its own
+// compiled pipeline variant and the per-pixel branch folds away
+layout(constant_id = 0) const uint INTERP_QUALITY = 1u;
+
 // NLS-Next bidirectional nonlinear stretch
 // Uses power curves for sophisticated center protection
 vec2 stretch(vec2 pos, float h_par, float v_par) {
@@ -130,15 +135,18 @@ void main() {
     if (outOfBounds) {
         color = vec4(0.0);  // Black bars for out-of-bounds
     } else {
-        if (params.interpolationQuality == 0u) {
+        // Remap into the active source sub-rectangle (zero-copy crop)
+        vec2 samplePos = params.sourceRect.xy + stretchedPos * params.sourceRect.zw;
+
+        if (INTERP_QUALITY == 0u) {
             // Bilinear (fast)
-            color = texture(inputTex, stretchedPos);
-        } else if (params.interpolationQuality == 1u) {
+            color = texture(inputTex, samplePos);
+        } else if (INTERP_QUALITY == 1u) {
             // Bicubic (high quality)
-            color = sampleBicubic(inputTex, stretchedPos, params.inputSize);
+            color = sampleBicubic(inputTex, samplePos, params.inputSize);
         } else {
             // Lanczos approximation (best quality)
-            color = sampleBicubic(inputTex, stretchedPos, params.inputSize);
+            color = sampleBicubic(inputTex, samplePos, params.inputSize);
         }
 
         // Clamp to valid range
@@ -178,9 +186,11 @@ NLSShader::~NLSShader() {
         destroyBuffer(m_uniform_buffer, m_uniform_memory);
     }
 
-    // Destroy pipeline
-    if (m_pipeline) {
-        vkDestroyPipeline(m_device, m_pipeline, nullptr);
+    // Destroy pipeline variants
+    for (int i = 0; i < INTERP_VARIANTS; i++) {
+        if (m_pipelines[i]) {
+            vkDestroyPipeline(m_device, m_pipelines[i], nullptr);
+        }
     }
     if (m_pipeline_layout) {
         vkDestroyPipelineLayout(m_device, m_pipeline_layout, nullptr);
@@ -225,6 +235,10 @@ Result NLSShader::initialize(VulkanContext* vk_context, pl_gpu gpu) {
 
     LOG_INFO("Processing", "Initializing NLS shader");
 
+    if (m_vk_context->hasAsyncComputeQueue()) {
+        LOG_INFO("Processing", "NLS dispatches will run on the async compute queue");
+    }
+
     // Create command pool
     m_command_pool = m_vk_context->createCommandPool(
         m_vk_context->getComputeQueueFamily(),
@@ -235,6 +249,9 @@ Result NLSShader::initialize(VulkanContext* vk_context, pl_gpu gpu) {
         return Result::ERROR_GENERIC;
     }
 
+    // Per-pass GPU timing for the warp dispatch (see VulkanContext)
+    m_gpu_timer = m_vk_context->createGpuTimer("nls_warp");
+
     // Allocate command buffer
     VkCommandBufferAllocateInfo alloc_info = {};
     alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -272,6 +289,12 @@ Result NLSShader::initialize(VulkanContext* vk_context, pl_gpu gpu) {
 }
 
 Result NLSShader::createDescriptorSetLayout() {
+    // Prefer push descriptors: bindings are recorded straight into the
+    // command buffer (vkCmdPushDescriptorSetKHR), so no pool, no sets
+    // and nothing to rewrite when the textures change
+    m_use_push_descriptors =
+        m_vk_context->hasExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+
     // Input sampler + output image
     VkDescriptorSetLayoutBinding bindings[2] = {};
 
@@ -291,6 +314,9 @@ Result NLSShader::createDescriptorSetLayout() {
     layout_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
     layout_info.bindingCount = 2;
     layout_info.pBindings = bindings;
+    if (m_use_push_descriptors) {
+        layout_info.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+    }
 
     if (vkCreateDescriptorSetLayout(m_device, &layout_info, nullptr,
                                    &m_descriptor_set_layout) != VK_SUCCESS) {
@@ -302,38 +328,97 @@ Result NLSShader::createDescriptorSetLayout() {
 }
 
 Result NLSShader::createDescriptorPool() {
+    if (m_use_push_descriptors) {
+        // Bindings are pushed at record time, nothing to allocate
+        LOG_INFO("Processing", "NLS descriptors via VK_KHR_push_descriptor");
+        return Result::SUCCESS;
+    }
+
+    // One baked set per output slot: input sampler + that slot's output
+    // image, written once in bakeDescriptorSets() and bound per frame
     VkDescriptorPoolSize pool_sizes[2] = {};
     pool_sizes[0].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-    pool_sizes[0].descriptorCount = 1;
+    pool_sizes[0].descriptorCount = OUTPUT_BUFFERS;
     pool_sizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-    pool_sizes[1].descriptorCount = 1;
+    pool_sizes[1].descriptorCount = OUTPUT_BUFFERS;
 
     VkDescriptorPoolCreateInfo pool_info = {};
     pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
     pool_info.poolSizeCount = 2;
     pool_info.pPoolSizes = pool_sizes;
-    pool_info.maxSets = 1;
+    pool_info.maxSets = OUTPUT_BUFFERS;
 
     if (vkCreateDescriptorPool(m_device, &pool_info, nullptr, &m_descriptor_pool) != VK_SUCCESS) {
         LOG_ERROR("Processing", "Failed to create descriptor pool");
         return Result::ERROR_GENERIC;
     }
 
-    // Allocate descriptor set
+    // Allocate one set per output slot
+    VkDescriptorSetLayout layouts[OUTPUT_BUFFERS];
+    for (int i = 0; i < OUTPUT_BUFFERS; i++) {
+        layouts[i] = m_descriptor_set_layout;
+    }
+
     VkDescriptorSetAllocateInfo alloc_info = {};
     alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
     alloc_info.descriptorPool = m_descriptor_pool;
-    alloc_info.descriptorSetCount = 1;
-    alloc_info.pSetLayouts = &m_descriptor_set_layout;
+    alloc_info.descriptorSetCount = OUTPUT_BUFFERS;
+    alloc_info.pSetLayouts = layouts;
 
-    if (vkAllocateDescriptorSets(m_device, &alloc_info, &m_descriptor_set) != VK_SUCCESS) {
-        LOG_ERROR("Processing", "Failed to allocate descriptor set");
+    if (vkAllocateDescriptorSets(m_device, &alloc_info, m_descriptor_sets) != VK_SUCCESS) {
+        LOG_ERROR("Processing", "Failed to allocate descriptor sets");
         return Result::ERROR_GENERIC;
     }
 
     return Result::SUCCESS;
 }
 
+Result NLSShader::bakeDescriptorSets() {
+    if (m_use_push_descriptors) {
+        return Result::SUCCESS;
+    }
+
+    // libplacebo-owned textures run through pl_dispatch, which manages
+    // its own descriptors; the baked sets cover the raw Vulkan path
+    if (!m_input_view || !m_input_sampler || !m_output_view) {
+        return Result::SUCCESS;
+    }
+
+    VkDescriptorImageInfo input_info = {};
+    input_info.sampler = m_input_sampler;
+    input_info.imageView = m_input_view;
+    input_info.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+    // The legacy path has a single output image today, so every slot's
+    // set references the same view; the loop keeps the bake per-slot so
+    // double-buffered output views drop in without restructuring
+    VkDescriptorImageInfo output_info = {};
+    output_info.imageView = m_output_view;
+    output_info.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+    for (int i = 0; i < OUTPUT_BUFFERS; i++) {
+        VkWriteDescriptorSet writes[2] = {};
+
+        writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[0].dstSet = m_descriptor_sets[i];
+        writes[0].dstBinding = 0;
+        writes[0].descriptorCount = 1;
+        writes[0].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        writes[0].pImageInfo = &input_info;
+
+        writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        writes[1].dstSet = m_descriptor_sets[i];
+        writes[1].dstBinding = 1;
+        writes[1].descriptorCount = 1;
+        writes[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        writes[1].pImageInfo = &output_info;
+
+        vkUpdateDescriptorSets(m_device, 2, writes, 0, nullptr);
+    }
+
+    return Result::SUCCESS;
+}
+
 Result NLSShader::createPipeline() {
     // Compile GLSL to SPIR-V (simplified - in production use glslang or shaderc)
     // For now, we'll use a pre-compiled shader or runtime compilation
@@ -366,8 +451,44 @@ Result NLSShader::createPipeline() {
         return Result::ERROR_GENERIC;
     }
 
-    // Note: Actual shader module creation and pipeline creation would go here
-    // Requires shaderc library to compile GLSL to SPIR-V at runtime
+    // Note: Actual shader module creation requires shaderc to compile
+    // GLSL to SPIR-V at runtime; once it exists the variant loop below
+    // compiles all interpolation qualities through the pipeline cache,
+    // so after the first run they come back as cache hits
+    if (m_shader_module) {
+        // Specialization constant 0 = interpolation quality; each value
+        // produces a branchless variant of the sampling code
+        VkSpecializationMapEntry spec_entry = {};
+        spec_entry.constantID = 0;
+        spec_entry.offset = 0;
+        spec_entry.size = sizeof(uint32_t);
+
+        for (uint32_t variant = 0; variant < (uint32_t)INTERP_VARIANTS; variant++) {
+            VkSpecializationInfo spec_info = {};
+            spec_info.mapEntryCount = 1;
+            spec_info.pMapEntries = &spec_entry;
+            spec_info.dataSize = sizeof(uint32_t);
+            spec_info.pData = &variant;
+
+            VkComputePipelineCreateInfo pipeline_info = {};
+            pipeline_info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+            pipeline_info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+            pipeline_info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+            pipeline_info.stage.module = m_shader_module;
+            pipeline_info.stage.pName = "main";
+            pipeline_info.stage.pSpecializationInfo = &spec_info;
+            pipeline_info.layout = m_pipeline_layout;
+
+            if (vkCreateComputePipelines(m_device, m_vk_context->getPipelineCache(),
+                                         1, &pipeline_info, nullptr,
+                                         &m_pipelines[variant]) != VK_SUCCESS) {
+                LOG_ERROR("Processing", "Failed to create NLS pipeline variant %u", variant);
+                return Result::ERROR_GENERIC;
+            }
+        }
+
+        LOG_INFO("Processing", "Compiled %d NLS pipeline variants", INTERP_VARIANTS);
+    }
 
     return Result::SUCCESS;
 }
@@ -387,11 +508,25 @@ Result NLSShader::processFrame(const VideoFrame& input, VideoFrame& output,
 
     auto start_time = std::chrono::high_resolution_clock::now();
 
-    // Calculate output dimensions
+    // Calculate output dimensions from the active (cropped) region
     uint32_t output_width, output_height;
-    calculateOutputDimensions(input.width, input.height, config,
+    calculateOutputDimensions(input.croppedWidth(), input.croppedHeight(), config,
                              output_width, output_height);
 
+    // Record the source sub-rectangle (normalized texture coordinates)
+    // so the warp samples only the active region of the input texture
+    if (input.hasCrop() && input.width > 0 && input.height > 0) {
+        m_src_rect[0] = (float)input.crop_x / (float)input.width;
+        m_src_rect[1] = (float)input.crop_y / (float)input.height;
+        m_src_rect[2] = (float)input.croppedWidth() / (float)input.width;
+        m_src_rect[3] = (float)input.croppedHeight() / (float)input.height;
+    } else {
+        m_src_rect[0] = 0.0f;
+        m_src_rect[1] = 0.0f;
+        m_src_rect[2] = 1.0f;
+        m_src_rect[3] = 1.0f;
+    }
+
     // Create textures if dimensions changed
     if (m_input_width != input.width || m_input_height != input.height ||
         m_output_width != output_width || m_output_height != output_height) {
@@ -425,11 +560,16 @@ Result NLSShader::processFrame(const VideoFrame& input, VideoFrame& output,
     output.pts = input.pts;
     output.hdr_metadata = input.hdr_metadata;
 
+    // Alternate output textures so the texture handed downstream for this
+    // frame is not overwritten while a pipelined consumer still reads it
+    m_output_index = (m_output_index + 1) % OUTPUT_BUFFERS;
+
     // Update statistics
     auto end_time = std::chrono::high_resolution_clock::now();
     auto elapsed = std::chrono::duration<double, std::milli>(end_time - start_time);
 
     m_stats.last_frame_time_ms = elapsed.count();
+    m_stats.gpu_time_ms = m_vk_context->getGpuTimerMs(m_gpu_timer);
     m_stats.frames_processed++;
 
     if (m_stats.frames_processed == 1) {
@@ -506,22 +646,29 @@ Result NLSShader::createTextures(uint32_t input_width, uint32_t input_height,
             return Result::ERROR_GENERIC;
         }
 
-        // Create output texture (renderable, readable)
+        // Create output texture (renderable, readable). 16-bit float:
+        // the warp output is an intermediate, not display output, so it
+        // stays at working precision — a 10-bit HDR capture would band
+        // if squeezed through 8 bits here. Quantization to output depth
+        // (with dithering) happens exactly once, in the final render pass
         struct pl_tex_params output_params = {};
         output_params.w = (int)output_width;
         output_params.h = (int)output_height;
-        output_params.format = pl_find_fmt(m_gpu, PL_FMT_UNORM, 3, 0, 8,
+        output_params.format = pl_find_fmt(m_gpu, PL_FMT_FLOAT, 3, 0, 16,
                                           static_cast<pl_fmt_caps>(PL_FMT_CAP_RENDERABLE | PL_FMT_CAP_HOST_READABLE));
         output_params.renderable = true;
         output_params.host_readable = true;
 
-        m_output_tex = pl_tex_create(m_gpu, &output_params);
+        for (int i = 0; i < OUTPUT_BUFFERS; i++) {
+            m_output_tex[i] = pl_tex_create(m_gpu, &output_params);
 
-        if (!m_output_tex) {
-            LOG_ERROR("Processing", "Failed to create output texture");
-            pl_tex_destroy(m_gpu, &m_input_tex);
-            return Result::ERROR_GENERIC;
+            if (!m_output_tex[i]) {
+                LOG_ERROR("Processing", "Failed to create output texture");
+                destroyTextures();
+                return Result::ERROR_GENERIC;
+            }
         }
+        m_output_index = 0;
 
         LOG_INFO("Processing", "Created NLS textures (libplacebo): %ux%u -> %ux%u",
                  input_width, input_height, output_width, output_height);
@@ -530,7 +677,9 @@ Result NLSShader::createTextures(uint32_t input_width, uint32_t input_height,
         LOG_WARN("Processing", "NLS shader initialized without libplacebo GPU");
     }
 
-    return Result::SUCCESS;
+    // Texture configuration changed: rewrite the baked descriptor sets
+    // here, once, instead of on the frame path
+    return bakeDescriptorSets();
 }
 
 void NLSShader::destroyTextures() {
@@ -541,9 +690,11 @@ void NLSShader::destroyTextures() {
             m_input_tex = nullptr;
         }
 
-        if (m_output_tex) {
-            pl_tex_destroy(m_gpu, &m_output_tex);
-            m_output_tex = nullptr;
+        for (int i = 0; i < OUTPUT_BUFFERS; i++) {
+            if (m_output_tex[i]) {
+                pl_tex_destroy(m_gpu, &m_output_tex[i]);
+                m_output_tex[i] = nullptr;
+            }
         }
     }
 
@@ -590,6 +741,12 @@ Result NLSShader::uploadFrame(const VideoFrame& frame) {
         return Result::ERROR_NOT_INITIALIZED;
     }
 
+    // GPU-resident input: warp directly from the previous stage's texture
+    if (frame.gpu_tex) {
+        m_source_tex = (pl_tex)frame.gpu_tex;
+        return Result::SUCCESS;
+    }
+
     // Upload frame data to GPU using libplacebo
     struct pl_tex_transfer_params upload_params = {};
     upload_params.tex = m_input_tex;
@@ -601,11 +758,12 @@ Result NLSShader::uploadFrame(const VideoFrame& frame) {
         return Result::ERROR_GENERIC;
     }
 
+    m_source_tex = m_input_tex;
     return Result::SUCCESS;
 }
 
 Result NLSShader::runCompute(const NLSConfig& config) {
-    if (!m_gpu || !m_input_tex || !m_output_tex) {
+    if (!m_gpu || !m_input_tex || !m_output_tex[m_output_index]) {
         LOG_ERROR("Processing", "NLS shader GPU not initialized");
         return Result::ERROR_NOT_INITIALIZED;
     }
@@ -614,8 +772,19 @@ Result NLSShader::runCompute(const NLSConfig& config) {
     // This requires:
     // 1. Compile GLSL to SPIR-V using shaderc library
     // 2. Create pl_pass with custom compute shader
-    // 3. Set push constants for NLS parameters
+    // 3. Bind m_pipelines[m_active_variant] (pre-specialized for the
+    //    configured interpolation quality), set push constants, then
+    //    either push the texture bindings (m_use_push_descriptors) or
+    //    bind the baked set for the active slot
+    //    (m_descriptor_sets[m_output_index]) — descriptors are written
+    //    in bakeDescriptorSets() on texture change, never per frame
     // 4. Execute pass via pl_pass_run or pl_dispatch
+    // 5. Submit the dispatch on m_compute_queue (async compute when the
+    //    device exposes one) and hand the timeline value returned by
+    //    VulkanContext::submitCommands to the render queue as a wait, so
+    //    the warp overlaps the previous frame's render work
+    // 6. Bracket the dispatch with writeGpuTimerBegin/End(m_gpu_timer)
+    //    so Stats::gpu_time_ms reports its GPU execution time
     //
     // For now, we implement a simple resize as placeholder
     // The NLS GLSL shader code is already defined at the top of this file
@@ -646,24 +815,36 @@ Result NLSShader::runCompute(const NLSConfig& config) {
 }
 
 Result NLSShader::downloadFrame(VideoFrame& output) {
-    if (!m_gpu || !m_output_tex) {
+    if (!m_gpu || !m_output_tex[m_output_index]) {
         LOG_ERROR("Processing", "NLS shader GPU not initialized");
         return Result::ERROR_NOT_INITIALIZED;
     }
 
-    // Allocate output buffer
-    size_t output_size = m_output_width * m_output_height * 3;  // RGB 8-bit
+    // GPU-resident output: hand the texture to the next stage, no readback
+    if (m_gpu_resident) {
+        output.data = nullptr;
+        output.size = 0;
+        output.width = m_output_width;
+        output.height = m_output_height;
+        output.format = PixelFormat::RGB_16BIT_FLOAT;
+        output.gpu_tex = (void*)m_output_tex[m_output_index];
+        return Result::SUCCESS;
+    }
+
+    // Allocate output buffer (16f intermediate, matching the texture)
+    size_t bpp = bytesPerPixel(PixelFormat::RGB_16BIT_FLOAT);
+    size_t output_size = (size_t)m_output_width * m_output_height * bpp;
     output.data = new uint8_t[output_size];
     output.size = output_size;
     output.width = m_output_width;
     output.height = m_output_height;
-    output.format = PixelFormat::RGB_8BIT;
+    output.format = PixelFormat::RGB_16BIT_FLOAT;
 
     // Download from GPU using libplacebo
     struct pl_tex_transfer_params download_params = {};
-    download_params.tex = m_output_tex;
+    download_params.tex = m_output_tex[m_output_index];
     download_params.ptr = output.data;
-    download_params.row_pitch = m_output_width * 3;
+    download_params.row_pitch = m_output_width * bpp;
 
     if (!pl_tex_download(m_gpu, &download_params)) {
         LOG_ERROR("Processing", "Failed to download frame from GPU");
@@ -719,8 +900,17 @@ void NLSShader::destroyBuffer(VkBuffer buffer, VkDeviceMemory memory) {
 }
 
 void NLSShader::updateConfig(const NLSConfig& config) {
-    // Configuration is applied per-frame in processFrame()
-    // This is a no-op for now
+    // Scalar parameters travel as push constants per frame; the only
+    // thing latched here is which compiled variant the dispatch binds
+    int variant = static_cast<int>(config.interpolation);
+    if (variant < 0 || variant >= INTERP_VARIANTS) {
+        variant = 1;  // BICUBIC
+    }
+
+    if (variant != m_active_variant) {
+        m_active_variant = variant;
+        LOG_DEBUG("Processing", "NLS interpolation variant -> %d", variant);
+    }
 }
 
 NLSShader::Stats NLSShader::getStats() const {
@@ -30,11 +30,17 @@ public:
     // Update shader parameters
     void updateConfig(const NLSConfig& config);
 
+    // Enable GPU-resident output (skip readback, hand texture to next stage)
+    void setGPUResident(bool enabled) { m_gpu_resident = enabled; }
+
     // Statistics
     struct Stats {
         uint64_t frames_processed = 0;
         double last_frame_time_ms = 0.0;
         double avg_frame_time_ms = 0.0;
+        double gpu_time_ms = 0.0;   // GPU execution time of the warp
+                                    // dispatch (timestamp queries,
+                                    // resolved a few frames behind)
         uint32_t input_width = 0;
         uint32_t input_height = 0;
         uint32_t output_width = 0;
@@ -49,6 +55,7 @@ private:
     Result createPipeline();
     Result createDescriptorSetLayout();
     Result createDescriptorPool();
+    Result bakeDescriptorSets();
     Result createShaderModule(const std::vector<uint32_t>& code, VkShaderModule* module);
 
     // Texture management
@@ -83,19 +90,41 @@ private:
     // libplacebo GPU (for simplified GPU operations)
     pl_gpu m_gpu = nullptr;
 
-    // Pipeline
-    VkPipeline m_pipeline = VK_NULL_HANDLE;
+    // Output double-buffering depth (see m_output_tex)
+    static constexpr int OUTPUT_BUFFERS = 2;
+
+    // Pipeline: one compiled variant per interpolation quality, baked
+    // with a specialization constant so the per-pixel quality branch is
+    // eliminated at compile time. All variants are created up front
+    // (through the shared pipeline cache); updateConfig() just switches
+    // m_active_variant, no recompile on the frame path
+    static constexpr int INTERP_VARIANTS = 3;  // bilinear / bicubic / lanczos
+    VkPipeline m_pipelines[INTERP_VARIANTS] = {};
+    int m_active_variant = 1;  // NLSConfig default is BICUBIC
     VkPipelineLayout m_pipeline_layout = VK_NULL_HANDLE;
     VkDescriptorSetLayout m_descriptor_set_layout = VK_NULL_HANDLE;
+
+    // Descriptor sets are baked once per texture configuration (one per
+    // output slot, written in bakeDescriptorSets() when the textures are
+    // recreated); the per-frame dispatch just binds the set for the
+    // active slot — no vkUpdateDescriptorSets on the frame path. When
+    // the device has VK_KHR_push_descriptor the layout is created
+    // push-capable instead and the bindings are pushed at record time,
+    // so no pool or sets exist at all
     VkDescriptorPool m_descriptor_pool = VK_NULL_HANDLE;
-    VkDescriptorSet m_descriptor_set = VK_NULL_HANDLE;
+    VkDescriptorSet m_descriptor_sets[OUTPUT_BUFFERS] = {};
+    bool m_use_push_descriptors = false;
 
     // Shader
     VkShaderModule m_shader_module = VK_NULL_HANDLE;
 
     // libplacebo textures
+    // Output is double-buffered: in pipelined mode the texture handed to
+    // the next stage for frame N is still being consumed while frame N+1
+    // is warped, so each frame renders into the other slot
     pl_tex m_input_tex = nullptr;
-    pl_tex m_output_tex = nullptr;
+    pl_tex m_output_tex[OUTPUT_BUFFERS] = {};
+    int m_output_index = 0;
 
     // Legacy Vulkan handles (kept for compatibility)
     VkImage m_input_image = VK_NULL_HANDLE;
@@ -119,6 +148,9 @@ private:
 
     // Command pool and buffers
     VkCommandPool m_command_pool = VK_NULL_HANDLE;
+
+    // GPU timestamp timer for the warp dispatch (-1 = no support)
+    int m_gpu_timer = -1;
     VkCommandBuffer m_command_buffer = VK_NULL_HANDLE;
 
     // Dimensions
@@ -132,6 +164,15 @@ private:
 
     // State
     bool m_initialized = false;
+    bool m_gpu_resident = false;
+
+    // Texture to warp from this frame (input upload target, or the
+    // previous stage's texture when the input is GPU-resident)
+    pl_tex m_source_tex = nullptr;
+
+    // Normalized source sub-rectangle from the zero-copy crop stage
+    // (x, y, w, h); full texture when no crop is pending
+    float m_src_rect[4] = {0.0f, 0.0f, 1.0f, 1.0f};
 
     // Push constants for shader parameters (NLS-Next style)
     struct PushConstants {
@@ -144,9 +185,11 @@ private:
         float input_height;
         float output_width;
         float output_height;
-        uint32_t interpolation_quality;
-        uint32_t padding[2];  // Alignment to 16-byte boundary
+        float source_rect[4];  // Normalized source sub-rect (x, y, w, h)
+        uint32_t padding[3];  // Alignment to 16-byte boundary
     };
+    // Interpolation quality is not pushed per frame: it selects one of
+    // the pre-compiled pipeline variants (specialization constant 0)
 };
 
 } // namespace processing
@@ -1,14 +1,24 @@
 #include "placebo_renderer.h"
+#include "preview_tap.h"
 #include "scene_analyzer.h"
+#include "core/frame_pool.h"
 #include "core/logger.h"
 
 #include <libplacebo/colorspace.h>
 #include <libplacebo/filters.h>
+#include <cmath>
 #include <cstring>
+#include <fstream>
+#include <vector>
+#include <unistd.h>
 
 namespace ares {
 namespace processing {
 
+// On-disk location of the serialized libplacebo shader cache (config
+// directory, next to the Vulkan pipeline cache)
+static const char* PLACEBO_CACHE_PATH = "/etc/ares/placebo.cache";
+
 // libplacebo log callback
 static void pl_log_callback(void* priv, pl_log_level level, const char* msg) {
     switch (level) {
@@ -38,12 +48,30 @@ PlaceboRenderer::PlaceboRenderer() {
 }
 
 PlaceboRenderer::~PlaceboRenderer() {
+    // Destroy staging buffers
+    destroyStagingBuffers();
+
+    // Destroy imported capture dma-bufs (the underlying pages belong to
+    // the capture allocator)
+    for (auto& entry : m_dmabuf_imports) {
+        pl_buf_destroy(m_gpu, &entry.second);
+    }
+    m_dmabuf_imports.clear();
+
     // Destroy textures
     if (m_input_tex) {
         pl_tex_destroy(m_gpu, &m_input_tex);
     }
-    if (m_output_tex) {
-        pl_tex_destroy(m_gpu, &m_output_tex);
+    for (int i = 0; i < STAGING_BUFFERS; i++) {
+        if (m_output_tex[i]) {
+            pl_tex_destroy(m_gpu, &m_output_tex[i]);
+        }
+    }
+    if (m_osd_tex) {
+        pl_tex_destroy(m_gpu, &m_osd_tex);
+    }
+    if (m_pip_tex) {
+        pl_tex_destroy(m_gpu, &m_pip_tex);
     }
 
     // Destroy renderer
@@ -56,6 +84,26 @@ PlaceboRenderer::~PlaceboRenderer() {
         pl_vulkan_destroy(&m_vk);
     }
 
+    // Persist the shader cache for the next run, then destroy it
+    if (m_cache) {
+        size_t size = pl_cache_save(m_cache, nullptr, 0);
+        if (size > 0) {
+            std::vector<uint8_t> data(size);
+            pl_cache_save(m_cache, data.data(), data.size());
+
+            std::ofstream file(PLACEBO_CACHE_PATH, std::ios::binary | std::ios::trunc);
+            if (file && file.write(reinterpret_cast<const char*>(data.data()),
+                                   static_cast<std::streamsize>(size))) {
+                LOG_INFO("Processing", "Saved libplacebo shader cache to %s (%zu bytes)",
+                         PLACEBO_CACHE_PATH, size);
+            } else {
+                LOG_WARN("Processing", "Failed to write libplacebo shader cache to %s",
+                         PLACEBO_CACHE_PATH);
+            }
+        }
+        pl_cache_destroy(&m_cache);
+    }
+
     // Destroy log
     if (m_log) {
         pl_log_destroy(&m_log);
@@ -91,6 +139,13 @@ Result PlaceboRenderer::initialize(VulkanContext* vk_context) {
         return result;
     }
 
+    // Bake the deband/dither noise textures and their shader passes now,
+    // not on the first live frame or a menu change
+    warmupNoiseTextures();
+
+    // Per-pass GPU timing (resolved asynchronously; see VulkanContext)
+    m_gpu_render_timer = vk_context->createGpuTimer("placebo_render");
+
     m_initialized = true;
     LOG_INFO("Processing", "libplacebo renderer initialized successfully");
 
@@ -130,6 +185,29 @@ Result PlaceboRenderer::initializePlacebo(VulkanContext* vk_context) {
 
     m_gpu = m_vk->gpu;
 
+    // Restore the persistent shader cache so the first frames don't
+    // stall compiling tone-mapping shaders that ran on the last boot
+    struct pl_cache_params cache_params = {};
+    cache_params.log = m_log;
+    cache_params.max_total_size = 64 << 20;
+    m_cache = pl_cache_create(&cache_params);
+    if (m_cache) {
+        std::ifstream file(PLACEBO_CACHE_PATH, std::ios::binary | std::ios::ate);
+        if (file) {
+            std::streamsize size = file.tellg();
+            if (size > 0) {
+                std::vector<uint8_t> data(static_cast<size_t>(size));
+                file.seekg(0);
+                if (file.read(reinterpret_cast<char*>(data.data()), size)) {
+                    int loaded = pl_cache_load(m_cache, data.data(), data.size());
+                    LOG_INFO("Processing", "Restored %d libplacebo cache objects from %s",
+                             loaded, PLACEBO_CACHE_PATH);
+                }
+            }
+        }
+        pl_gpu_set_cache(m_gpu, m_cache);
+    }
+
     LOG_INFO("Processing", "libplacebo Vulkan integration successful");
 
     return Result::SUCCESS;
@@ -146,15 +224,89 @@ Result PlaceboRenderer::createRenderer() {
     return Result::SUCCESS;
 }
 
+void PlaceboRenderer::warmupNoiseTextures() {
+    // The dither LUTs (blue noise / ordered) and the deband grain pass
+    // are generated lazily by libplacebo on the first frame that needs
+    // them, which lands the texture bake plus shader compile in the
+    // middle of live playback. Render a tiny dummy frame with both
+    // stages enabled for the common dither methods so everything is
+    // built here at init; the compiled passes land in m_cache, so on
+    // subsequent runs this is a cache replay rather than a compile
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    struct pl_tex_params src_params = {};
+    src_params.w = 64;
+    src_params.h = 64;
+    src_params.format = pl_find_fmt(m_gpu, PL_FMT_UNORM, 3, 0, 8,
+                                    static_cast<pl_fmt_caps>(PL_FMT_CAP_SAMPLEABLE));
+    src_params.sampleable = true;
+    pl_tex src = pl_tex_create(m_gpu, &src_params);
+
+    struct pl_tex_params dst_params = {};
+    dst_params.w = 64;
+    dst_params.h = 64;
+    dst_params.format = pl_find_fmt(m_gpu, PL_FMT_UNORM, 3, 0, 8,
+                                    static_cast<pl_fmt_caps>(PL_FMT_CAP_RENDERABLE));
+    dst_params.renderable = true;
+    pl_tex dst = pl_tex_create(m_gpu, &dst_params);
+
+    if (src && dst) {
+        struct pl_frame source = {0};
+        struct pl_swapchain_frame source_swapchain = {};
+        source_swapchain.fbo = src;
+        pl_frame_from_swapchain(&source, &source_swapchain);
+
+        struct pl_frame target = {0};
+        struct pl_swapchain_frame target_swapchain = {};
+        target_swapchain.fbo = dst;
+        pl_frame_from_swapchain(&target, &target_swapchain);
+
+        struct pl_deband_params deband_params = pl_deband_default_params;
+        struct pl_dither_params dither_params = pl_dither_default_params;
+
+        const enum pl_dither_method methods[] = {
+            PL_DITHER_BLUE_NOISE,
+            PL_DITHER_ORDERED_LUT,
+        };
+
+        for (enum pl_dither_method method : methods) {
+            struct pl_render_params render_params = pl_render_default_params;
+            dither_params.method = method;
+            render_params.dither_params = &dither_params;
+            render_params.deband_params = &deband_params;
+
+            if (!pl_render_image(m_renderer, &source, &target, &render_params)) {
+                LOG_WARN("Processing", "Noise texture warmup render failed, "
+                         "textures will bake on first use");
+                break;
+            }
+        }
+    }
+
+    if (src) {
+        pl_tex_destroy(m_gpu, &src);
+    }
+    if (dst) {
+        pl_tex_destroy(m_gpu, &dst);
+    }
+
+    auto elapsed = std::chrono::duration<double, std::milli>(
+        std::chrono::high_resolution_clock::now() - start_time);
+    LOG_INFO("Processing", "Deband/dither warmup took %.1f ms", elapsed.count());
+}
+
 Result PlaceboRenderer::createTextures(uint32_t width, uint32_t height) {
     // Destroy old textures if dimensions changed
     if (m_width != width || m_height != height) {
         if (m_input_tex) {
             pl_tex_destroy(m_gpu, &m_input_tex);
         }
-        if (m_output_tex) {
-            pl_tex_destroy(m_gpu, &m_output_tex);
+        for (int i = 0; i < STAGING_BUFFERS; i++) {
+            if (m_output_tex[i]) {
+                pl_tex_destroy(m_gpu, &m_output_tex[i]);
+            }
         }
+        destroyStagingBuffers();
 
         m_width = width;
         m_height = height;
@@ -176,8 +328,8 @@ Result PlaceboRenderer::createTextures(uint32_t width, uint32_t height) {
         }
     }
 
-    // Create output texture (8-bit RGB)
-    if (!m_output_tex) {
+    // Create output textures (8-bit RGB, one per staging slot)
+    if (!m_output_tex[0]) {
         struct pl_tex_params output_params = {};
         output_params.w = static_cast<int>(width);
         output_params.h = static_cast<int>(height);
@@ -185,37 +337,214 @@ Result PlaceboRenderer::createTextures(uint32_t width, uint32_t height) {
                                   static_cast<pl_fmt_caps>(PL_FMT_CAP_RENDERABLE | PL_FMT_CAP_HOST_READABLE));
         output_params.renderable = true;
         output_params.host_readable = true;
-        m_output_tex = pl_tex_create(m_gpu, &output_params);
+        for (int i = 0; i < STAGING_BUFFERS; i++) {
+            m_output_tex[i] = pl_tex_create(m_gpu, &output_params);
 
-        if (!m_output_tex) {
-            LOG_ERROR("Processing", "Failed to create output texture");
-            return Result::ERROR_GENERIC;
+            if (!m_output_tex[i]) {
+                LOG_ERROR("Processing", "Failed to create output texture");
+                return Result::ERROR_GENERIC;
+            }
+        }
+    }
+
+    // (Re)create the persistent staging buffers for the new dimensions
+    if (!m_upload_staging[0]) {
+        Result result = createStagingBuffers();
+        if (result != Result::SUCCESS) {
+            return result;
         }
     }
 
     return Result::SUCCESS;
 }
 
-Result PlaceboRenderer::uploadFrame(const VideoFrame& frame) {
+Result PlaceboRenderer::createStagingBuffers() {
+    // Persistently-mapped host buffers, sized for the worst-case frame at
+    // the current dimensions. Uploads memcpy into the mapped pointer and
+    // hand the buffer to pl_tex_upload; downloads run the transfer into
+    // the buffer and memcpy out after it completes. No per-frame
+    // allocation, no map/unmap.
+    size_t upload_size = (size_t)m_width * m_height * 6;   // RGB 16f intermediate worst case
+    size_t download_size = (size_t)m_width * m_height * 3; // RGB 8-bit output
+
+    for (int i = 0; i < STAGING_BUFFERS; i++) {
+        struct pl_buf_params upload_params = {};
+        upload_params.size = upload_size;
+        upload_params.host_mapped = true;
+        m_upload_staging[i] = pl_buf_create(m_gpu, &upload_params);
+
+        struct pl_buf_params download_params = {};
+        download_params.size = download_size;
+        download_params.host_mapped = true;
+        m_download_staging[i] = pl_buf_create(m_gpu, &download_params);
+
+        if (!m_upload_staging[i] || !m_download_staging[i]) {
+            LOG_ERROR("Processing", "Failed to create staging buffers");
+            destroyStagingBuffers();
+            return Result::ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    LOG_INFO("Processing", "Created persistent staging buffers (%zu MB up, %zu MB down, x%d)",
+             upload_size / (1024 * 1024), download_size / (1024 * 1024), STAGING_BUFFERS);
+
+    return Result::SUCCESS;
+}
+
+void PlaceboRenderer::destroyStagingBuffers() {
+    for (int i = 0; i < STAGING_BUFFERS; i++) {
+        if (m_upload_staging[i]) {
+            pl_buf_destroy(m_gpu, &m_upload_staging[i]);
+        }
+        if (m_download_staging[i]) {
+            pl_buf_destroy(m_gpu, &m_download_staging[i]);
+        }
+    }
+    m_staging_index = 0;
+}
+
+Result PlaceboRenderer::uploadFrame(const VideoFrame& frame, pl_tex& source_tex) {
     // Create textures if needed
     Result result = createTextures(frame.width, frame.height);
     if (result != Result::SUCCESS) {
         return result;
     }
 
-    // Upload frame data to GPU
+    // GPU-resident input: the previous stage left the frame on the GPU,
+    // render directly from its texture and skip the upload entirely
+    if (frame.gpu_tex) {
+        source_tex = (pl_tex)frame.gpu_tex;
+        return Result::SUCCESS;
+    }
+
     struct pl_tex_transfer_params upload_params = {};
     upload_params.tex = m_input_tex;
-    upload_params.ptr = frame.data;
-    upload_params.row_pitch = frame.width * 3; // Assuming RGB 8-bit format
+    upload_params.row_pitch = frame.width * bytesPerPixel(frame.format);
+
+    // dma-buf capture buffers: the GPU reads straight out of the pages
+    // the capture driver DMA'd into, no CPU copy at all
+    if (frame.dmabuf_fd >= 0) {
+        pl_buf imported = importDmaBuf(frame);
+        if (imported) {
+            upload_params.buf = imported;
+            upload_params.buf_offset = 0;
+            if (!pl_tex_upload(m_gpu, &upload_params)) {
+                LOG_ERROR("Processing", "Failed to upload frame from dma-buf");
+                return Result::ERROR_GENERIC;
+            }
+            source_tex = m_input_tex;
+            return Result::SUCCESS;
+        }
+        // Import unavailable: fall through to the staging copy
+    }
+
+    // Upload through the persistent staging buffer: copy into the mapped
+    // pointer (waiting if the transfer from two frames ago still owns it),
+    // then let the GPU pull from the buffer asynchronously
+    pl_buf staging = m_upload_staging[m_staging_index];
+    size_t upload_bytes = (size_t)frame.width * frame.height * bytesPerPixel(frame.format);
+
+    if (staging && staging->data && upload_bytes <= staging->params.size) {
+        while (pl_buf_poll(m_gpu, staging, UINT64_MAX)) {
+            // Still in flight; UINT64_MAX wait makes this effectively once
+        }
+        std::memcpy(staging->data, frame.data, upload_bytes);
+
+        upload_params.buf = staging;
+        upload_params.buf_offset = 0;
+    } else {
+        // Fallback: direct host pointer upload (staging unavailable)
+        upload_params.ptr = frame.data;
+    }
+
     if (!pl_tex_upload(m_gpu, &upload_params)) {
         LOG_ERROR("Processing", "Failed to upload frame to GPU");
         return Result::ERROR_GENERIC;
     }
 
+    source_tex = m_input_tex;
     return Result::SUCCESS;
 }
 
+pl_buf PlaceboRenderer::importDmaBuf(const VideoFrame& frame) {
+    if (!(m_gpu->import_caps.buf & PL_HANDLE_DMA_BUF)) {
+        return nullptr;
+    }
+
+    auto it = m_dmabuf_imports.find(frame.dmabuf_fd);
+    if (it != m_dmabuf_imports.end()) {
+        return it->second;
+    }
+
+    // udmabuf objects are page-aligned; the exported size may exceed the
+    // frame payload
+    const size_t page = 4096;
+    size_t import_size = (frame.size + page - 1) & ~(page - 1);
+
+    struct pl_buf_params params = {};
+    params.size = import_size;
+    params.import_handle = PL_HANDLE_DMA_BUF;
+    params.shared_mem.handle.fd = dup(frame.dmabuf_fd);
+    params.shared_mem.size = import_size;
+    params.shared_mem.offset = 0;
+
+    pl_buf imported = pl_buf_create(m_gpu, &params);
+    if (!imported) {
+        LOG_WARN("Processing", "Failed to import capture dma-buf %d, staging instead",
+                 frame.dmabuf_fd);
+        close(params.shared_mem.handle.fd);
+        return nullptr;
+    }
+
+    LOG_INFO("Processing", "Imported capture dma-buf %d (%zu bytes) for zero-copy upload",
+             frame.dmabuf_fd, import_size);
+    m_dmabuf_imports[frame.dmabuf_fd] = imported;
+    return imported;
+}
+
+pl_tex PlaceboRenderer::wrapDisplayImage(VkImage image, uint32_t width, uint32_t height) {
+    if (!m_initialized) {
+        LOG_ERROR("Processing", "Renderer not initialized");
+        return nullptr;
+    }
+
+    struct pl_vulkan_wrap_params params = {};
+    params.image = image;
+    params.width = static_cast<int>(width);
+    params.height = static_cast<int>(height);
+    params.format = VK_FORMAT_B8G8R8A8_UNORM;  // Presenter scanout format
+    params.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+                   VK_IMAGE_USAGE_TRANSFER_DST_BIT |
+                   VK_IMAGE_USAGE_SAMPLED_BIT;
+
+    pl_tex tex = pl_vulkan_wrap(m_gpu, &params);
+    if (!tex) {
+        LOG_WARN("Processing", "Failed to wrap display image as render target");
+        return nullptr;
+    }
+
+    // Hand ownership to libplacebo once. The display engine scans the
+    // linear image out through DRM without touching Vulkan, so it never
+    // needs to be handed back
+    struct pl_vulkan_release_params release = {};
+    release.tex = tex;
+    release.layout = VK_IMAGE_LAYOUT_UNDEFINED;
+    release.qf = VK_QUEUE_FAMILY_IGNORED;
+    pl_vulkan_release_ex(m_gpu, &release);
+
+    LOG_DEBUG("Processing", "Wrapped display image as %ux%u render target", width, height);
+    return tex;
+}
+
+void PlaceboRenderer::releaseWrappedImage(pl_tex& tex) {
+    if (tex) {
+        if (m_render_target == tex) {
+            m_render_target = nullptr;
+        }
+        pl_tex_destroy(m_gpu, &tex);
+    }
+}
+
 const pl_tone_map_function* PlaceboRenderer::getToneMappingFunction(ToneMappingAlgorithm algo) {
     switch (algo) {
         case ToneMappingAlgorithm::BT2390:
@@ -233,14 +562,212 @@ const pl_tone_map_function* PlaceboRenderer::getToneMappingFunction(ToneMappingA
     }
 }
 
-Result PlaceboRenderer::render(const ProcessingConfig& config) {
+float PlaceboRenderer::quantizeSourceNits(float source_nits, bool scene_changed) {
+    if (source_nits <= 0.0f) {
+        return source_nits;
+    }
+
+    // Log-spaced buckets ~7.5% apart: well below the visible threshold
+    // for a tone-curve change, but coarse enough that a whole scene's
+    // smoothing jitter lands in a single bucket
+    constexpr float BUCKET_RATIO = 1.075f;
+    // Leave the current bucket only once the raw value has moved past
+    // ~60% of a bucket width, so a peak hovering near a bucket edge
+    // doesn't flip back and forth and re-bake the LUT every few frames.
+    // A scene cut bypasses the hysteresis and snaps immediately
+    constexpr float HYSTERESIS = 1.045f;
+
+    if (m_lut_source_nits > 0.0f && !scene_changed) {
+        float ratio = source_nits / m_lut_source_nits;
+        if (ratio < HYSTERESIS && ratio > 1.0f / HYSTERESIS) {
+            return m_lut_source_nits;
+        }
+    }
+
+    float bucket = std::round(std::log(source_nits / 100.0f) / std::log(BUCKET_RATIO));
+    float quantized = 100.0f * std::pow(BUCKET_RATIO, bucket);
+    if (quantized != m_lut_source_nits) {
+        m_lut_source_nits = quantized;
+        m_stats.lut_rebakes++;
+        LOG_DEBUG("Processing", "Tone-map LUT bucket changed: %.1f nits", quantized);
+    }
+    return m_lut_source_nits;
+}
+
+Result PlaceboRenderer::updateOSD(const uint8_t* argb_data, uint32_t width, uint32_t height,
+                                  int dirty_x, int dirty_y, int dirty_w, int dirty_h) {
+    if (!m_initialized) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+    if (!argb_data || width == 0 || height == 0) {
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
+    bool full_upload = false;
+    if (!m_osd_tex || m_osd_width != width || m_osd_height != height) {
+        if (m_osd_tex) {
+            pl_tex_destroy(m_gpu, &m_osd_tex);
+        }
+
+        // Cairo ARGB32 is premultiplied BGRA in memory on little endian
+        struct pl_tex_params tex_params = {};
+        tex_params.w = (int)width;
+        tex_params.h = (int)height;
+        tex_params.format = pl_find_named_fmt(m_gpu, "bgra8");
+        tex_params.sampleable = true;
+        tex_params.host_writable = true;
+
+        m_osd_tex = pl_tex_create(m_gpu, &tex_params);
+        if (!m_osd_tex) {
+            LOG_ERROR("Processing", "Failed to create OSD overlay texture");
+            return Result::ERROR_GENERIC;
+        }
+
+        m_osd_width = width;
+        m_osd_height = height;
+        full_upload = true;
+    }
+
+    // The texture persists: an empty dirty rect means it is already
+    // current and the upload is skipped
+    if (!full_upload && (dirty_w == 0 || dirty_h == 0)) {
+        return Result::SUCCESS;
+    }
+
+    struct pl_tex_transfer_params upload_params = {};
+    upload_params.tex = m_osd_tex;
+    upload_params.row_pitch = (size_t)width * 4;
+
+    if (!full_upload && dirty_w > 0 && dirty_h > 0 &&
+        ((uint32_t)dirty_w < width || (uint32_t)dirty_h < height)) {
+        upload_params.rc.x0 = dirty_x;
+        upload_params.rc.y0 = dirty_y;
+        upload_params.rc.x1 = dirty_x + dirty_w;
+        upload_params.rc.y1 = dirty_y + dirty_h;
+        upload_params.ptr = (void*)(argb_data +
+            (size_t)dirty_y * width * 4 + (size_t)dirty_x * 4);
+    } else {
+        upload_params.ptr = (void*)argb_data;
+    }
+
+    if (!pl_tex_upload(m_gpu, &upload_params)) {
+        LOG_ERROR("Processing", "Failed to upload OSD overlay");
+        return Result::ERROR_GENERIC;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result PlaceboRenderer::updatePiP(const VideoFrame& frame) {
+    if (!m_initialized) {
+        return Result::ERROR_NOT_INITIALIZED;
+    }
+    if (!frame.data || frame.width == 0 || frame.height == 0) {
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
+    // (Re)create the texture when the secondary source changes mode
+    if (!m_pip_tex || m_pip_width != frame.width || m_pip_height != frame.height ||
+        m_pip_format != frame.format) {
+        if (m_pip_tex) {
+            pl_tex_destroy(m_gpu, &m_pip_tex);
+        }
+
+        pl_fmt fmt = nullptr;
+        switch (frame.format) {
+            case PixelFormat::YUV420P_10BIT:
+                fmt = pl_find_named_fmt(m_gpu, "yuv420p10le");
+                break;
+            case PixelFormat::RGB_8BIT:
+                fmt = pl_find_named_fmt(m_gpu, "rgb8");
+                break;
+            case PixelFormat::RGBA_8BIT:
+                fmt = pl_find_named_fmt(m_gpu, "rgba8");
+                break;
+            default:
+                break;
+        }
+        if (!fmt) {
+            LOG_WARN("Processing", "Unsupported PiP frame format %d",
+                     static_cast<int>(frame.format));
+            return Result::ERROR_INVALID_PARAMETER;
+        }
+
+        struct pl_tex_params tex_params = {};
+        tex_params.w = static_cast<int>(frame.width);
+        tex_params.h = static_cast<int>(frame.height);
+        tex_params.format = fmt;
+        tex_params.sampleable = true;
+        tex_params.host_writable = true;
+
+        m_pip_tex = pl_tex_create(m_gpu, &tex_params);
+        if (!m_pip_tex) {
+            LOG_ERROR("Processing", "Failed to create PiP overlay texture");
+            return Result::ERROR_GENERIC;
+        }
+
+        m_pip_width = frame.width;
+        m_pip_height = frame.height;
+        m_pip_format = frame.format;
+        LOG_INFO("Processing", "PiP overlay texture created: %ux%u",
+                 frame.width, frame.height);
+    }
+
+    // PiP frames arrive decimated (config.pip.frame_divisor), so a plain
+    // synchronous upload is cheap enough — no persistent staging buffer
+    struct pl_tex_transfer_params upload_params = {};
+    upload_params.tex = m_pip_tex;
+    upload_params.ptr = frame.data;
+    if (frame.format != PixelFormat::YUV420P_10BIT) {
+        upload_params.row_pitch = (size_t)frame.width * bytesPerPixel(frame.format);
+    }
+
+    if (!pl_tex_upload(m_gpu, &upload_params)) {
+        LOG_ERROR("Processing", "Failed to upload PiP overlay");
+        return Result::ERROR_GENERIC;
+    }
+
+    return Result::SUCCESS;
+}
+
+// Map ScalingAlgorithm to a libplacebo filter config. Returns null for
+// the trained-kernel choices (NNEDI3/Super-xBR/RAVU) that have no
+// built-in pass; callers substitute EWA Lanczos, the best built-in
+static const struct pl_filter_config* mapScalerFilter(ScalingAlgorithm algo) {
+    switch (algo) {
+        case ScalingAlgorithm::BILINEAR:          return &pl_filter_bilinear;
+        case ScalingAlgorithm::NEAREST:           return &pl_filter_nearest;
+        case ScalingAlgorithm::BICUBIC:           return &pl_filter_bicubic;
+        case ScalingAlgorithm::MITCHELL:          return &pl_filter_mitchell;
+        case ScalingAlgorithm::CATMULL_ROM:       return &pl_filter_catmull_rom;
+        case ScalingAlgorithm::HERMITE:           return &pl_filter_hermite;
+        case ScalingAlgorithm::LANCZOS:           return &pl_filter_lanczos;
+        case ScalingAlgorithm::SPLINE16:          return &pl_filter_spline16;
+        case ScalingAlgorithm::SPLINE36:          return &pl_filter_spline36;
+        case ScalingAlgorithm::SPLINE64:          return &pl_filter_spline64;
+        case ScalingAlgorithm::EWA_LANCZOS:       return &pl_filter_ewa_lanczos;
+        case ScalingAlgorithm::EWA_LANCZOS_SHARP:
+        case ScalingAlgorithm::EWA_LANCZOS_4TAP:  return &pl_filter_ewa_lanczossharp;
+        case ScalingAlgorithm::JINC:              return &pl_filter_ewa_jinc;
+        default:                                  return nullptr;
+    }
+}
+
+Result PlaceboRenderer::render(const ProcessingConfig& config, pl_tex source_tex,
+                               const VideoFrame& input) {
     auto start_time = std::chrono::high_resolution_clock::now();
 
     // Get dynamic tone mapping parameters if enabled
     float source_nits = config.tone_mapping.source_nits;
     float knee_point = config.tone_mapping.params.knee_point;
 
-    if (config.tone_mapping.dynamic.enabled && m_scene_analyzer) {
+    if (config.tone_mapping.use_metadata && input.hdr_metadata.has_dynamic) {
+        // Source-authored per-shot trim (DV L1 / HDR10+ light levels):
+        // strictly better than the histogram estimate, and free — the
+        // analyzer is bypassed entirely for these frames. The values are
+        // step-wise per shot, so quantize without hysteresis
+        source_nits = quantizeSourceNits(input.hdr_metadata.scene_max_nits, true);
+    } else if (config.tone_mapping.dynamic.enabled && m_scene_analyzer) {
         SceneAnalyzer::DynamicParams dynamic_params = m_scene_analyzer->getDynamicParams();
         source_nits = dynamic_params.source_nits;
         knee_point = dynamic_params.knee_point;
@@ -248,26 +775,66 @@ Result PlaceboRenderer::render(const ProcessingConfig& config) {
         LOG_DEBUG("Processing", "Dynamic tone mapping: source=%.1f nits (avg=%.1f, peak=%.1f), knee=%.3f",
                   source_nits, dynamic_params.avg_brightness,
                   dynamic_params.peak_brightness, knee_point);
+
+        // Quantize the smoothed peak before it reaches libplacebo. The
+        // renderer bakes its tone-mapping 3D LUT keyed on the exact
+        // source/target color spaces, so a peak that drifts by a
+        // fraction of a nit per frame forces a full re-bake every
+        // frame. Snapping to log-spaced buckets keeps the colorspace
+        // byte-identical within a scene (LUT reused as-is) and moves it
+        // only on scene transitions; previously-baked buckets come back
+        // warm from m_cache instead of being generated again
+        source_nits = quantizeSourceNits(source_nits, dynamic_params.scene_changed);
     }
 
     // Setup source image
     struct pl_frame source = {0};
     struct pl_swapchain_frame source_swapchain = {};
-    source_swapchain.fbo = m_input_tex;
+    source_swapchain.fbo = source_tex;
     pl_frame_from_swapchain(&source, &source_swapchain);
 
-    // Set source colorspace (BT.2020 for HDR)
-    source.repr.sys = PL_COLOR_SYSTEM_BT_2020_NC;
-    source.repr.levels = PL_COLOR_LEVELS_FULL;
-    source.color.primaries = PL_COLOR_PRIM_BT_2020;
-    source.color.transfer = PL_COLOR_TRC_PQ;  // HDR10 uses PQ
-    source.color.hdr.max_luma = source_nits;  // Use dynamic source_nits
-    source.color.hdr.min_luma = 0.0f;
+    // Apply the crop stage's sub-rectangle through source texture
+    // coordinates (the crop itself is zero-copy frame metadata)
+    if (input.hasCrop()) {
+        source.crop.x0 = (float)input.crop_x;
+        source.crop.y0 = (float)input.crop_y;
+        source.crop.x1 = (float)(input.crop_x + input.croppedWidth());
+        source.crop.y1 = (float)(input.crop_y + input.croppedHeight());
+    }
+
+    // Set source colorspace: BT.2020/PQ for HDR content, BT.709 for SDR
+    // frames routed through the renderer (e.g. for deinterlacing) —
+    // for those the color mapping is an identity and only the requested
+    // processing runs
+    if (input.hdr_metadata.type != HDRType::NONE) {
+        source.repr.sys = PL_COLOR_SYSTEM_BT_2020_NC;
+        source.repr.levels = PL_COLOR_LEVELS_FULL;
+        source.color.primaries = PL_COLOR_PRIM_BT_2020;
+        source.color.transfer = PL_COLOR_TRC_PQ;  // HDR10 uses PQ
+        source.color.hdr.max_luma = source_nits;  // Use dynamic source_nits
+        source.color.hdr.min_luma = 0.0f;
+    } else {
+        source.repr.sys = PL_COLOR_SYSTEM_BT_709;
+        source.repr.levels = PL_COLOR_LEVELS_FULL;
+        source.color.primaries = PL_COLOR_PRIM_BT_709;
+        source.color.transfer = PL_COLOR_TRC_GAMMA22;
+    }
+
+    // Interlaced source: tag the frame's field so the deinterlacer
+    // (configured below, once render_params exists) knows what to do.
+    // The capture path doesn't carry field order; broadcast 1080i is
+    // top-field-first in practice
+    if (config.deinterlace.enabled && input.interlaced) {
+        source.field = PL_FIELD_TOP;
+        source.first_field = PL_FIELD_TOP;
+    }
 
-    // Setup target image
+    // Setup target image: the wrapped scanout buffer when direct scanout
+    // is attached, otherwise the internal double-buffered output texture
     struct pl_frame target = {0};
     struct pl_swapchain_frame target_swapchain = {};
-    target_swapchain.fbo = m_output_tex;
+    target_swapchain.fbo = m_render_target ? m_render_target
+                                           : m_output_tex[m_staging_index];
     pl_frame_from_swapchain(&target, &target_swapchain);
 
     // Set target colorspace (BT.709 for display)
@@ -278,6 +845,81 @@ Result PlaceboRenderer::render(const ProcessingConfig& config) {
     target.color.hdr.max_luma = config.tone_mapping.target_nits;
     target.color.hdr.min_luma = 0.0f;
 
+    // Overlays: blended by the same render pass, after tone mapping, in
+    // the target colorspace — replaces the separate compositing stage.
+    // PiP goes first so the OSD draws on top of it
+    struct pl_overlay_part pip_part = {};
+    struct pl_overlay_part osd_part = {};
+    struct pl_overlay overlays[2] = {};
+    int num_overlays = 0;
+
+    if (m_pip_visible && m_pip_tex && config.pip.enabled) {
+        const float out_w = (float)target_swapchain.fbo->params.w;
+        const float out_h = (float)target_swapchain.fbo->params.h;
+        const float margin = (float)config.pip.margin;
+
+        // Width from the configured fraction; height follows the
+        // secondary source's aspect ratio
+        float pip_w = out_w * config.pip.size;
+        float pip_h = pip_w * (float)m_pip_height / (float)m_pip_width;
+        float x0 = margin;
+        float y0 = margin;
+        if (config.pip.corner == PiPConfig::Corner::TOP_RIGHT ||
+            config.pip.corner == PiPConfig::Corner::BOTTOM_RIGHT) {
+            x0 = out_w - margin - pip_w;
+        }
+        if (config.pip.corner == PiPConfig::Corner::BOTTOM_LEFT ||
+            config.pip.corner == PiPConfig::Corner::BOTTOM_RIGHT) {
+            y0 = out_h - margin - pip_h;
+        }
+
+        pip_part.src.x1 = (float)m_pip_width;
+        pip_part.src.y1 = (float)m_pip_height;
+        pip_part.dst.x0 = x0;
+        pip_part.dst.y0 = y0;
+        pip_part.dst.x1 = x0 + pip_w;
+        pip_part.dst.y1 = y0 + pip_h;
+
+        struct pl_overlay& pip_overlay = overlays[num_overlays++];
+        pip_overlay.tex = m_pip_tex;
+        pip_overlay.mode = PL_OVERLAY_NORMAL;
+        // The secondary input (streaming box UI, typically) is assumed
+        // SDR BT.709; the overlay pass converts it to the target space
+        if (m_pip_format == PixelFormat::YUV420P_10BIT) {
+            pip_overlay.repr.sys = PL_COLOR_SYSTEM_BT_709;
+            pip_overlay.repr.levels = PL_COLOR_LEVELS_LIMITED;
+            pip_overlay.repr.bits.sample_depth = 16;
+            pip_overlay.repr.bits.color_depth = 10;
+        } else {
+            pip_overlay.repr = pl_color_repr_rgb;
+        }
+        pip_overlay.color.primaries = PL_COLOR_PRIM_BT_709;
+        pip_overlay.color.transfer = PL_COLOR_TRC_GAMMA22;
+        pip_overlay.parts = &pip_part;
+        pip_overlay.num_parts = 1;
+    }
+
+    if (m_osd_visible && m_osd_tex) {
+        osd_part.src.x1 = (float)m_osd_width;
+        osd_part.src.y1 = (float)m_osd_height;
+        osd_part.dst.x1 = (float)m_osd_width;
+        osd_part.dst.y1 = (float)m_osd_height;
+
+        struct pl_overlay& osd_overlay = overlays[num_overlays++];
+        osd_overlay.tex = m_osd_tex;
+        osd_overlay.mode = PL_OVERLAY_NORMAL;
+        osd_overlay.repr = pl_color_repr_rgb;
+        osd_overlay.repr.alpha = PL_ALPHA_PREMULTIPLIED;  // Cairo surfaces
+        osd_overlay.color = pl_color_space_srgb;
+        osd_overlay.parts = &osd_part;
+        osd_overlay.num_parts = 1;
+    }
+
+    if (num_overlays > 0) {
+        target.overlays = overlays;
+        target.num_overlays = num_overlays;
+    }
+
     // Setup render parameters
     struct pl_render_params render_params = pl_render_default_params;
 
@@ -291,6 +933,28 @@ Result PlaceboRenderer::render(const ProcessingConfig& config) {
     (void)config.tone_mapping.saturation; // saturation removed
     render_params.color_map_params = &color_map_params;
 
+    // Deinterlacing: runs inside this render pass, ahead of scaling, so
+    // it shares the GPU-resident texture path and adds no extra pass or
+    // readback. YADIF is the motion-adaptive mode — it weaves regions
+    // where the two fields agree and interpolates where they don't
+    static struct pl_deinterlace_params deinterlace_params = {};
+    if (config.deinterlace.enabled && input.interlaced) {
+        switch (config.deinterlace.method) {
+            case DeinterlaceConfig::Method::WEAVE:
+                deinterlace_params.algo = PL_DEINTERLACE_WEAVE;
+                break;
+            case DeinterlaceConfig::Method::BOB:
+                deinterlace_params.algo = PL_DEINTERLACE_BOB;
+                break;
+            case DeinterlaceConfig::Method::YADIF:
+            case DeinterlaceConfig::Method::NNEDI3:  // no NNEDI3 pass; best available
+            default:
+                deinterlace_params.algo = PL_DEINTERLACE_YADIF;
+                break;
+        }
+        render_params.deinterlace_params = &deinterlace_params;
+    }
+
     // Configure quality
     switch (config.quality) {
         case ProcessingConfig::Quality::FAST:
@@ -298,14 +962,45 @@ Result PlaceboRenderer::render(const ProcessingConfig& config) {
             render_params.disable_linear_scaling = true;
             break;
         case ProcessingConfig::Quality::BALANCED:
-            // Use defaults
-            break;
         case ProcessingConfig::Quality::HIGH_QUALITY:
-            render_params.upscaler = &pl_filter_lanczos;
-            render_params.downscaler = &pl_filter_lanczos;
+            // Scaler selection below decides the cost/quality tradeoff
             break;
     }
 
+    // Image (luma) scaling: always an explicit filter, never whatever
+    // the final blit happens to do. libplacebo bakes each filter's
+    // kernel weights into a LUT texture the first time the filter is
+    // used and reuses it from the renderer (and pl_cache) until the
+    // selection changes, so steady-state frames only pay for sampling.
+    // Trained-kernel choices fall back to EWA Lanczos (one-time warning)
+    const struct pl_filter_config* upscaler =
+        mapScalerFilter(config.image_upscaling.luma_algorithm);
+    if (!upscaler) {
+        static bool warned_trained = false;
+        if (!warned_trained) {
+            LOG_WARN("Processing", "Trained upscaling kernels (NNEDI3/Super-xBR/RAVU) "
+                     "need shader hooks; using EWA Lanczos");
+            warned_trained = true;
+        }
+        upscaler = &pl_filter_ewa_lanczos;
+    }
+    const struct pl_filter_config* downscaler =
+        mapScalerFilter(config.image_upscaling.downscaling_algorithm);
+    render_params.upscaler = upscaler;
+    render_params.downscaler = downscaler ? downscaler : &pl_filter_hermite;
+    if (config.image_upscaling.use_ar_filter) {
+        render_params.antiringing_strength = config.image_upscaling.antiring;
+    }
+
+    // Sigmoidal light transform while upscaling (reduces ringing on
+    // sharp edges); parameters map straight from the config
+    static struct pl_sigmoid_params sigmoid_params = {};
+    if (config.image_upscaling.sigmoid) {
+        sigmoid_params.center = config.image_upscaling.sigmoid_center;
+        sigmoid_params.slope = config.image_upscaling.sigmoid_slope;
+        render_params.sigmoid_params = &sigmoid_params;
+    }
+
     // Configure dithering
     static struct pl_dither_params dither_params = {};
     if (config.dithering.enabled) {
@@ -331,13 +1026,27 @@ Result PlaceboRenderer::render(const ProcessingConfig& config) {
         render_params.dither_params = &dither_params;
     }
 
-    // Configure debanding
+    // Configure debanding. Deband, dither and the output-depth
+    // conversion all execute inside this one pl_render_image pass chain;
+    // what can still be duplicated is the noise: deband grain injects
+    // dynamic noise and a noise-based dither injects noise again at
+    // output depth. When both are active, drop the deband grain and let
+    // the dither stage be the single (fused) noise injection — same
+    // banding mask, one noise lookup per pixel instead of two
     static struct pl_deband_params deband_params = {};
     if (config.debanding.enabled) {
         deband_params.iterations = config.debanding.iterations;
         deband_params.threshold = config.debanding.threshold;
         deband_params.radius = (float)config.debanding.radius;
         deband_params.grain = config.debanding.grain;
+
+        bool dither_injects_noise = config.dithering.enabled &&
+            (config.dithering.method == DitheringConfig::Method::BLUE_NOISE ||
+             config.dithering.method == DitheringConfig::Method::WHITE_NOISE);
+        if (dither_injects_noise) {
+            deband_params.grain = 0.0f;
+        }
+
         render_params.deband_params = &deband_params;
     }
 
@@ -403,12 +1112,33 @@ Result PlaceboRenderer::render(const ProcessingConfig& config) {
         render_params.upscaler = luma_filter;
     }
 
-    // Render
+    // Render, bracketed by GPU timestamps on the graphics queue. The
+    // flush pushes libplacebo's recorded passes to the queue before the
+    // closing timestamp, so the pair spans actual GPU execution of this
+    // render — not just the CPU-side recording measured below
+    if (m_gpu_render_timer >= 0) {
+        m_vk_context->submitGpuTimerBegin(m_gpu_render_timer,
+                                          m_vk_context->getGraphicsQueue());
+    }
+
     if (!pl_render_image(m_renderer, &source, &target, &render_params)) {
         LOG_ERROR("Processing", "Failed to render frame");
         return Result::ERROR_GENERIC;
     }
 
+    if (m_gpu_render_timer >= 0) {
+        pl_gpu_flush(m_gpu);
+        m_vk_context->submitGpuTimerEnd(m_gpu_render_timer,
+                                        m_vk_context->getGraphicsQueue());
+        m_stats.gpu_render_ms = m_vk_context->getGpuTimerMs(m_gpu_render_timer);
+    }
+
+    // Preview tap: one GPU blit into the tap's downscaled slot; the
+    // download/encode/serve all happen on the tap's own threads
+    if (m_preview_tap) {
+        m_preview_tap->capture(target_swapchain.fbo);
+    }
+
     // Update statistics
     auto end_time = std::chrono::high_resolution_clock::now();
     auto elapsed = std::chrono::duration<double, std::milli>(end_time - start_time);
@@ -430,24 +1160,41 @@ Result PlaceboRenderer::render(const ProcessingConfig& config) {
 Result PlaceboRenderer::downloadFrame(VideoFrame& output) {
     // Allocate output buffer
     size_t output_size = m_width * m_height * 3; // RGB 8-bit
-    output.data = new uint8_t[output_size];
+    output.data = core::FramePool::getInstance().acquire(output_size);
     output.size = output_size;
     output.width = m_width;
     output.height = m_height;
     output.format = PixelFormat::RGB_8BIT;
 
-    // Download from GPU
+    // Download through the persistent staging buffer when available
+    pl_buf staging = m_download_staging[m_staging_index];
+
     struct pl_tex_transfer_params download_params = {};
-    download_params.tex = m_output_tex;
-    download_params.ptr = output.data;
+    download_params.tex = m_output_tex[m_staging_index];
     download_params.row_pitch = m_width * 3;
+
+    bool use_staging = staging && staging->data && output_size <= staging->params.size;
+    if (use_staging) {
+        download_params.buf = staging;
+        download_params.buf_offset = 0;
+    } else {
+        download_params.ptr = output.data;
+    }
+
     if (!pl_tex_download(m_gpu, &download_params)) {
         LOG_ERROR("Processing", "Failed to download frame from GPU");
-        delete[] output.data;
+        core::FramePool::getInstance().release(output.data);
         output.data = nullptr;
         return Result::ERROR_GENERIC;
     }
 
+    if (use_staging) {
+        // Wait for the transfer, then copy out of the mapped pointer
+        while (pl_buf_poll(m_gpu, staging, UINT64_MAX)) {
+        }
+        std::memcpy(output.data, staging->data, output_size);
+    }
+
     return Result::SUCCESS;
 }
 
@@ -466,33 +1213,61 @@ Result PlaceboRenderer::processFrame(const VideoFrame& input, VideoFrame& output
             analyzer_initialized = true;
             LOG_INFO("Processing", "Dynamic tone mapping enabled");
         }
-
-        // Analyze frame for brightness statistics
-        m_scene_analyzer->analyzeFrame(input, input.hdr_metadata);
     }
 
-    // Upload frame
-    Result result = uploadFrame(input);
+    // Upload frame (or adopt the previous stage's texture)
+    pl_tex source_tex = nullptr;
+    Result result = uploadFrame(input, source_tex);
     if (result != Result::SUCCESS) {
         return result;
     }
+    m_last_source_tex = source_tex;
+
+    // Analyze frame for brightness statistics: GPU reduction over the
+    // uploaded texture, CPU pixel scan only as fallback. Skipped when
+    // the source carries its own per-shot trim (render() uses that
+    // directly), saving the blit, readback and worker entirely
+    if (config.tone_mapping.dynamic.enabled && m_scene_analyzer &&
+        !(config.tone_mapping.use_metadata && input.hdr_metadata.has_dynamic)) {
+        if (!m_scene_analyzer->analyzeFrameGPU(m_gpu, source_tex, input.hdr_metadata) &&
+            input.data) {
+            m_scene_analyzer->analyzeFrame(input, input.hdr_metadata);
+        }
+    }
 
     // Render with tone mapping (uses dynamic parameters if enabled)
-    result = render(config);
+    result = render(config, source_tex, input);
     if (result != Result::SUCCESS) {
         return result;
     }
 
-    // Download result
-    result = downloadFrame(output);
-    if (result != Result::SUCCESS) {
-        return result;
+    if (m_render_target || (config.gpu_resident && !config.force_cpu_readback)) {
+        // GPU-resident output: hand the texture to the next stage, no
+        // PCIe readback. With a direct scanout target this is the only
+        // option (the frame already lives in the framebuffer)
+        output.data = nullptr;
+        output.size = 0;
+        output.width = m_width;
+        output.height = m_height;
+        output.format = PixelFormat::RGB_8BIT;
+        output.gpu_tex = (void*)(m_render_target ? m_render_target
+                                                 : m_output_tex[m_staging_index]);
+    } else {
+        // Debug fallback: read the result back to system RAM
+        result = downloadFrame(output);
+        if (result != Result::SUCCESS) {
+            return result;
+        }
     }
 
     // Copy metadata
     output.pts = input.pts;
     output.hdr_metadata = input.hdr_metadata;
 
+    // Alternate staging buffers so next frame's copies overlap this
+    // frame's in-flight transfers
+    m_staging_index = (m_staging_index + 1) % STAGING_BUFFERS;
+
     return Result::SUCCESS;
 }
 
@@ -5,14 +5,18 @@
 #include "vulkan_context.h"
 #include "scene_analyzer.h"
 
+#include <libplacebo/cache.h>
 #include <libplacebo/vulkan.h>
 #include <libplacebo/renderer.h>
 #include <libplacebo/shaders/colorspace.h>
 #include <memory>
+#include <map>
 
 namespace ares {
 namespace processing {
 
+class PreviewTap;
+
 class PlaceboRenderer {
 public:
     PlaceboRenderer();
@@ -35,25 +39,76 @@ public:
         uint64_t frames_processed;
         bool using_10bit;
         std::string tone_mapping_algorithm;
+        uint64_t lut_rebakes;   // dynamic tone-map LUT bucket changes
+        double gpu_render_ms;   // GPU execution time of the render pass
+                                // (timestamp queries, a few frames behind)
     };
     Stats getStats() const;
 
     // Get libplacebo GPU (for use by other processors)
     pl_gpu getGPU() const { return m_gpu; }
 
+    // Texture the last frame was rendered from (for one-frame-behind GPU
+    // analysis passes like black bar detection); may be null
+    pl_tex getLastSourceTex() const { return m_last_source_tex; }
+
+    // Direct scanout support: wrap an externally-created VkImage (the
+    // presenter's DRM scanout buffers) as a renderable texture. Returns
+    // null when wrapping fails; the caller keeps the VkImage alive for
+    // the lifetime of the returned texture
+    pl_tex wrapDisplayImage(VkImage image, uint32_t width, uint32_t height);
+    void releaseWrappedImage(pl_tex& tex);
+
+    // When set, the final render pass targets `target` instead of the
+    // internal output texture and the output frame is always GPU-resident
+    // (scanout memory cannot be read back). Pass null to restore the
+    // internal double-buffered path
+    void setRenderTarget(pl_tex target) { m_render_target = target; }
+
+    // OSD overlay: upload the OSD surface (Cairo premultiplied ARGB)
+    // and alpha-blend it as part of the final render pass — no separate
+    // compositing stage, no full-frame readback. A zero-sized dirty rect
+    // with an existing texture skips the upload entirely; negative width
+    // means "full surface"
+    Result updateOSD(const uint8_t* argb_data, uint32_t width, uint32_t height,
+                     int dirty_x, int dirty_y, int dirty_w, int dirty_h);
+    void setOSDVisible(bool visible) { m_osd_visible = visible; }
+
+    // Picture-in-picture overlay: upload a frame from the secondary
+    // capture input and composite it into a corner of the output by the
+    // same render pass (under the OSD) — no second pipeline invocation.
+    // The secondary source is assumed SDR BT.709; PiP placement comes
+    // from config.pip at render time
+    Result updatePiP(const VideoFrame& frame);
+    void setPiPVisible(bool visible) { m_pip_visible = visible; }
+
+    // Preview tap (not owned): when set, each rendered frame is blitted
+    // into the tap's downscaled slot after the render pass — one GPU
+    // blit, no synchronous readback. Pass null to detach
+    void setPreviewTap(PreviewTap* tap) { m_preview_tap = tap; }
+
 private:
     // Initialize libplacebo
     Result initializePlacebo(VulkanContext* vk_context);
 
     // Create rendering objects
     Result createRenderer();
+    void warmupNoiseTextures();
     Result createTextures(uint32_t width, uint32_t height);
+    Result createStagingBuffers();
+    void destroyStagingBuffers();
 
-    // Upload frame to GPU
-    Result uploadFrame(const VideoFrame& frame);
+    // Upload frame to GPU (or adopt its existing texture when GPU-resident)
+    // On success `source_tex` is the texture to render from
+    Result uploadFrame(const VideoFrame& frame, pl_tex& source_tex);
+
+    // Get (or create) the pl_buf wrapping a capture dma-buf; returns null
+    // when import is unsupported or fails
+    pl_buf importDmaBuf(const VideoFrame& frame);
 
     // Render with tone mapping
-    Result render(const ProcessingConfig& config);
+    Result render(const ProcessingConfig& config, pl_tex source_tex,
+                  const VideoFrame& input);
 
     // Download result from GPU
     Result downloadFrame(VideoFrame& output);
@@ -61,6 +116,11 @@ private:
     // Helper to convert tone mapping algorithm
     const pl_tone_map_function* getToneMappingFunction(ToneMappingAlgorithm algo);
 
+    // Snap the dynamically-smoothed source peak to log-spaced buckets
+    // (with hysteresis) so libplacebo's baked tone-map LUT is reused
+    // within a scene instead of re-baked every frame; see render()
+    float quantizeSourceNits(float source_nits, bool scene_changed);
+
     // Vulkan context (not owned)
     VulkanContext* m_vk_context = nullptr;
 
@@ -69,10 +129,45 @@ private:
     pl_vulkan m_vk = nullptr;
     pl_gpu m_gpu = nullptr;
     pl_renderer m_renderer = nullptr;
+    pl_cache m_cache = nullptr;   // persistent shader cache (saved to disk)
 
     // Textures
+    // Output is double-buffered (indexed by m_staging_index, which flips
+    // once per frame): in pipelined mode the texture delivered for frame N
+    // is still on its way to the display while frame N+1 renders
+    static constexpr int STAGING_BUFFERS = 2;
     pl_tex m_input_tex = nullptr;
-    pl_tex m_output_tex = nullptr;
+    pl_tex m_output_tex[STAGING_BUFFERS] = {};
+    pl_tex m_last_source_tex = nullptr;
+
+    // External render target (wrapped scanout image, not owned); null
+    // unless the presenter attached direct scanout
+    pl_tex m_render_target = nullptr;
+
+    // OSD overlay texture, blended into the render pass when visible
+    pl_tex m_osd_tex = nullptr;
+    uint32_t m_osd_width = 0;
+    uint32_t m_osd_height = 0;
+    bool m_osd_visible = false;
+
+    // Picture-in-picture overlay texture (secondary capture input)
+    pl_tex m_pip_tex = nullptr;
+    uint32_t m_pip_width = 0;
+    uint32_t m_pip_height = 0;
+    PixelFormat m_pip_format = PixelFormat::UNKNOWN;
+    bool m_pip_visible = false;
+
+    // Persistently-mapped staging buffers, double-buffered so the copy
+    // into slot N can overlap the GPU transfer still reading slot N-1.
+    // Created alongside the textures, reused for every frame.
+    pl_buf m_upload_staging[STAGING_BUFFERS] = {};
+    pl_buf m_download_staging[STAGING_BUFFERS] = {};
+    int m_staging_index = 0;
+
+    // Imported capture dma-bufs, keyed by fd. Capture buffers cycle
+    // through a small fixed pool, so each fd is imported once and reused
+    // for every frame that arrives in that buffer.
+    std::map<int, pl_buf> m_dmabuf_imports;
 
     // Frame dimensions
     uint32_t m_width = 0;
@@ -85,6 +180,16 @@ private:
     // Scene analyzer for dynamic tone mapping
     std::unique_ptr<SceneAnalyzer> m_scene_analyzer;
 
+    // Current tone-map LUT bucket (quantized dynamic source peak);
+    // 0 until the first dynamic frame
+    float m_lut_source_nits = 0.0f;
+
+    // GPU timestamp timer bracketing the render pass (-1 = unsupported)
+    int m_gpu_render_timer = -1;
+
+    // Asynchronous preview tap (not owned; see setPreviewTap)
+    PreviewTap* m_preview_tap = nullptr;
+
     // State
     bool m_initialized = false;
 };
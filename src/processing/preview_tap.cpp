@@ -0,0 +1,403 @@
+#include "preview_tap.h"
+#include "core/logger.h"
+
+#include <cairo/cairo.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <chrono>
+
+namespace ares {
+namespace processing {
+
+namespace {
+
+// cairo PNG stream sink appending into a std::vector
+cairo_status_t appendPng(void* closure, const unsigned char* data,
+                         unsigned int length) {
+    auto* out = static_cast<std::vector<uint8_t>*>(closure);
+    out->insert(out->end(), data, data + length);
+    return CAIRO_STATUS_SUCCESS;
+}
+
+// Best-effort full send; returns false when the client went away
+bool sendAll(int fd, const void* data, size_t size) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        ssize_t n = send(fd, p, size, MSG_NOSIGNAL);
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+} // namespace
+
+PreviewTap::PreviewTap() = default;
+
+PreviewTap::~PreviewTap() {
+    shutdown();
+}
+
+Result PreviewTap::initialize(pl_gpu gpu, uint16_t port, uint32_t width) {
+    if (m_initialized) {
+        LOG_WARN("Preview", "Preview tap already initialized");
+        return Result::SUCCESS;
+    }
+    if (!gpu || width < 16) {
+        return Result::ERROR_INVALID_PARAMETER;
+    }
+
+    m_gpu = gpu;
+    m_port = port;
+    m_width = width & ~1u;
+
+    // Listening socket on loopback only
+    m_listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (m_listen_fd < 0) {
+        LOG_ERROR("Preview", "Failed to create socket: %s", strerror(errno));
+        return Result::ERROR_GENERIC;
+    }
+
+    int reuse = 1;
+    setsockopt(m_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+
+    if (bind(m_listen_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+        listen(m_listen_fd, 2) < 0) {
+        LOG_ERROR("Preview", "Failed to bind 127.0.0.1:%u: %s", port,
+                  strerror(errno));
+        close(m_listen_fd);
+        m_listen_fd = -1;
+        return Result::ERROR_GENERIC;
+    }
+
+    m_stop = false;
+    m_encode_thread = std::thread(&PreviewTap::encodeLoop, this);
+    m_serve_thread = std::thread(&PreviewTap::serveLoop, this);
+
+    m_initialized = true;
+    LOG_INFO("Preview", "Preview tap listening on 127.0.0.1:%u (width %u)",
+             port, m_width);
+    return Result::SUCCESS;
+}
+
+void PreviewTap::shutdown() {
+    if (!m_initialized) {
+        return;
+    }
+
+    m_stop = true;
+    m_encode_cv.notify_all();
+    m_png_cv.notify_all();
+
+    // Closing the listening socket unblocks accept()
+    if (m_listen_fd >= 0) {
+        ::shutdown(m_listen_fd, SHUT_RDWR);
+        close(m_listen_fd);
+        m_listen_fd = -1;
+    }
+
+    if (m_encode_thread.joinable()) {
+        m_encode_thread.join();
+    }
+    if (m_serve_thread.joinable()) {
+        m_serve_thread.join();
+    }
+
+    destroySlotTextures();
+    m_initialized = false;
+
+    LOG_INFO("Preview", "Preview tap shut down (%lu captured, %lu encoded, %lu skipped)",
+             (unsigned long)m_frames_captured.load(),
+             (unsigned long)m_frames_encoded.load(),
+             (unsigned long)m_frames_skipped.load());
+}
+
+Result PreviewTap::createSlotTextures(uint32_t width, uint32_t height) {
+    struct pl_tex_params tex_params = {};
+    tex_params.w = static_cast<int>(width);
+    tex_params.h = static_cast<int>(height);
+    tex_params.format = pl_find_named_fmt(m_gpu, "rgba8");
+    tex_params.blit_dst = true;
+    tex_params.host_readable = true;
+
+    for (int i = 0; i < SLOTS; i++) {
+        m_slot_tex[i] = pl_tex_create(m_gpu, &tex_params);
+        if (!m_slot_tex[i]) {
+            LOG_ERROR("Preview", "Failed to create preview texture");
+            destroySlotTextures();
+            return Result::ERROR_GENERIC;
+        }
+    }
+    return Result::SUCCESS;
+}
+
+void PreviewTap::destroySlotTextures() {
+    for (int i = 0; i < SLOTS; i++) {
+        if (m_slot_tex[i]) {
+            pl_tex_destroy(m_gpu, &m_slot_tex[i]);
+        }
+    }
+}
+
+void PreviewTap::capture(pl_tex source) {
+    if (!m_initialized || !source) {
+        return;
+    }
+
+    // Derive the preview height from the source aspect; (re)create the
+    // slots on the first frame or a mode change. Skip the frame when a
+    // slot is mid-download — textures can't be destroyed under it
+    uint32_t height = (uint32_t)((uint64_t)m_width * source->params.h /
+                                 source->params.w) & ~1u;
+    if (height < 2) {
+        return;
+    }
+    if (!m_slot_tex[0] || m_height != height) {
+        if (m_slot_busy[0].load(std::memory_order_acquire) ||
+            m_slot_busy[1].load(std::memory_order_acquire)) {
+            m_frames_skipped++;
+            return;
+        }
+        destroySlotTextures();
+        if (createSlotTextures(m_width, height) != Result::SUCCESS) {
+            return;
+        }
+        m_height = height;
+    }
+
+    int slot = m_write_slot;
+    if (m_slot_busy[slot].load(std::memory_order_acquire)) {
+        // Encoder still reading both slots' worth of backlog: skip
+        m_frames_skipped++;
+        return;
+    }
+
+    struct pl_tex_blit_params blit = {};
+    blit.src = source;
+    blit.dst = m_slot_tex[slot];
+    blit.sample_mode = PL_TEX_SAMPLE_LINEAR;
+    pl_tex_blit(m_gpu, &blit);
+
+    m_frames_captured++;
+    m_ready_slot.store(slot, std::memory_order_release);
+    m_write_slot = slot ^ 1;
+    m_encode_cv.notify_one();
+}
+
+void PreviewTap::encodeLoop() {
+    LOG_DEBUG("Preview", "Encoder thread started");
+
+    while (!m_stop) {
+        int slot;
+        {
+            std::unique_lock<std::mutex> lock(m_encode_mutex);
+            m_encode_cv.wait(lock, [this] {
+                return m_stop.load() || m_ready_slot.load() >= 0;
+            });
+            if (m_stop) {
+                break;
+            }
+            slot = m_ready_slot.exchange(-1);
+        }
+        if (slot < 0) {
+            continue;
+        }
+
+        m_slot_busy[slot].store(true, std::memory_order_release);
+        if (encodeSlot(slot)) {
+            m_frames_encoded++;
+        }
+        m_slot_busy[slot].store(false, std::memory_order_release);
+    }
+
+    LOG_DEBUG("Preview", "Encoder thread exiting");
+}
+
+bool PreviewTap::encodeSlot(int slot) {
+    const uint32_t width = m_width;
+    const uint32_t height = m_height;
+
+    std::vector<uint8_t> rgba((size_t)width * height * 4);
+
+    struct pl_tex_transfer_params download = {};
+    download.tex = m_slot_tex[slot];
+    download.ptr = rgba.data();
+    download.row_pitch = (size_t)width * 4;
+
+    if (!pl_tex_download(m_gpu, &download)) {
+        LOG_WARN("Preview", "Preview download failed");
+        return false;
+    }
+
+    cairo_surface_t* surface =
+        cairo_image_surface_create(CAIRO_FORMAT_RGB24, width, height);
+    if (cairo_surface_status(surface) != CAIRO_STATUS_SUCCESS) {
+        cairo_surface_destroy(surface);
+        return false;
+    }
+
+    cairo_surface_flush(surface);
+    uint8_t* dst = cairo_image_surface_get_data(surface);
+    const int stride = cairo_image_surface_get_stride(surface);
+    for (uint32_t y = 0; y < height; y++) {
+        const uint8_t* src = rgba.data() + (size_t)y * width * 4;
+        uint32_t* row = reinterpret_cast<uint32_t*>(dst + (size_t)y * stride);
+        for (uint32_t x = 0; x < width; x++) {
+            // RGBA bytes -> native-endian xRGB
+            row[x] = ((uint32_t)src[x * 4 + 0] << 16) |
+                     ((uint32_t)src[x * 4 + 1] << 8) |
+                     ((uint32_t)src[x * 4 + 2]);
+        }
+    }
+    cairo_surface_mark_dirty(surface);
+
+    std::vector<uint8_t> png;
+    png.reserve(64 * 1024);
+    cairo_status_t status =
+        cairo_surface_write_to_png_stream(surface, appendPng, &png);
+    cairo_surface_destroy(surface);
+
+    if (status != CAIRO_STATUS_SUCCESS) {
+        LOG_WARN("Preview", "PNG encode failed: %s",
+                 cairo_status_to_string(status));
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_png_mutex);
+        m_png.swap(png);
+        m_png_seq++;
+    }
+    m_png_cv.notify_all();
+    return true;
+}
+
+void PreviewTap::serveLoop() {
+    LOG_DEBUG("Preview", "Server thread started");
+
+    while (!m_stop) {
+        int client_fd = accept(m_listen_fd, nullptr, nullptr);
+        if (client_fd < 0) {
+            if (m_stop) {
+                break;
+            }
+            continue;
+        }
+
+        // Serial clients: fleet monitoring is a single consumer, and a
+        // stalled stream must never pile up threads on the appliance
+        struct timeval tv = {};
+        tv.tv_sec = 5;
+        setsockopt(client_fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+        setsockopt(client_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+        serveClient(client_fd);
+        close(client_fd);
+    }
+
+    LOG_DEBUG("Preview", "Server thread exiting");
+}
+
+void PreviewTap::serveClient(int client_fd) {
+    char request[1024] = {};
+    ssize_t n = recv(client_fd, request, sizeof(request) - 1, 0);
+    if (n <= 0) {
+        return;
+    }
+    m_requests_served++;
+
+    const bool stream = strstr(request, "GET /stream") != nullptr;
+
+    if (!stream) {
+        // Single snapshot of the latest encoded frame
+        std::vector<uint8_t> png;
+        {
+            std::lock_guard<std::mutex> lock(m_png_mutex);
+            png = m_png;
+        }
+        if (png.empty()) {
+            const char* resp = "HTTP/1.1 503 Service Unavailable\r\n"
+                               "Content-Length: 0\r\n\r\n";
+            sendAll(client_fd, resp, strlen(resp));
+            return;
+        }
+
+        char header[160];
+        int len = snprintf(header, sizeof(header),
+                           "HTTP/1.1 200 OK\r\n"
+                           "Content-Type: image/png\r\n"
+                           "Content-Length: %zu\r\n"
+                           "Cache-Control: no-store\r\n\r\n",
+                           png.size());
+        if (sendAll(client_fd, header, len)) {
+            sendAll(client_fd, png.data(), png.size());
+        }
+        return;
+    }
+
+    // Multipart stream: push each newly encoded frame until the client
+    // disconnects. The stream carries PNG parts — same framing as MJPEG,
+    // just a different image type (no JPEG encoder in the dependency set)
+    const char* head = "HTTP/1.1 200 OK\r\n"
+                       "Content-Type: multipart/x-mixed-replace; boundary=frame\r\n"
+                       "Cache-Control: no-store\r\n\r\n";
+    if (!sendAll(client_fd, head, strlen(head))) {
+        return;
+    }
+
+    uint64_t last_seq = 0;
+    while (!m_stop) {
+        std::vector<uint8_t> png;
+        {
+            std::unique_lock<std::mutex> lock(m_png_mutex);
+            if (!m_png_cv.wait_for(lock, std::chrono::seconds(1), [&] {
+                    return m_stop.load() || m_png_seq != last_seq;
+                })) {
+                continue;  // no new frame yet; keep the connection alive
+            }
+            if (m_stop) {
+                break;
+            }
+            png = m_png;       // always the newest — slow clients skip frames
+            last_seq = m_png_seq;
+        }
+
+        char part[128];
+        int len = snprintf(part, sizeof(part),
+                           "--frame\r\n"
+                           "Content-Type: image/png\r\n"
+                           "Content-Length: %zu\r\n\r\n",
+                           png.size());
+        if (!sendAll(client_fd, part, len) ||
+            !sendAll(client_fd, png.data(), png.size()) ||
+            !sendAll(client_fd, "\r\n", 2)) {
+            break;
+        }
+    }
+}
+
+PreviewTap::Stats PreviewTap::getStats() const {
+    Stats stats;
+    stats.frames_captured = m_frames_captured.load();
+    stats.frames_skipped = m_frames_skipped.load();
+    stats.frames_encoded = m_frames_encoded.load();
+    stats.requests_served = m_requests_served.load();
+    return stats;
+}
+
+} // namespace processing
+} // namespace ares
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <ares/types.h>
+#include <libplacebo/gpu.h>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <cstdint>
+
+namespace ares {
+namespace processing {
+
+// Asynchronous downsampled preview of the rendered output, served to
+// monitoring consumers over a local HTTP socket.
+//
+// Unlike the synchronous setFrameCallback tap, which hands the
+// full-resolution frame to its consumer inside processFrame, this never
+// touches the hot path: capture() contributes exactly one GPU blit that
+// scales the rendered texture into a small preview slot. A background
+// thread downloads the slot, encodes it as PNG (cairo, already a
+// dependency) and publishes the result; an HTTP thread serves the
+// latest image as a single snapshot (GET /) or a multipart stream
+// (GET /stream). When the encoder or consumer falls behind, capture()
+// skips frames instead of waiting.
+class PreviewTap {
+public:
+    PreviewTap();
+    ~PreviewTap();
+
+    // gpu must outlive the tap. The listening socket binds to
+    // 127.0.0.1:port — fleet access goes through whatever tunnel or
+    // proxy already fronts the appliance. width selects the preview
+    // width; height follows the source aspect ratio
+    Result initialize(pl_gpu gpu, uint16_t port, uint32_t width);
+    void shutdown();
+
+    bool isInitialized() const { return m_initialized; }
+
+    // Frame-path entry point (called by PlaceboRenderer after the render
+    // pass): blit the rendered texture into a free preview slot. Never
+    // blocks — when both slots are still being encoded the frame is
+    // skipped and counted
+    void capture(pl_tex source);
+
+    struct Stats {
+        uint64_t frames_captured = 0;
+        uint64_t frames_skipped = 0;   // encoder/consumer too slow
+        uint64_t frames_encoded = 0;
+        uint64_t requests_served = 0;
+    };
+    Stats getStats() const;
+
+private:
+    Result createSlotTextures(uint32_t width, uint32_t height);
+    void destroySlotTextures();
+
+    void encodeLoop();
+    bool encodeSlot(int slot);
+
+    void serveLoop();
+    void serveClient(int client_fd);
+
+    pl_gpu m_gpu = nullptr;
+    uint16_t m_port = 0;
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;   // derived from the captured source's aspect
+
+    // Preview slots: the frame path blits into the slot the encoder is
+    // not reading. pl_tex operations are internally synchronized, so the
+    // narrow publish race degrades to a torn preview frame at worst
+    static constexpr int SLOTS = 2;
+    pl_tex m_slot_tex[SLOTS] = {};
+    std::atomic<bool> m_slot_busy[SLOTS] = {};
+    std::atomic<int> m_ready_slot{-1};
+    int m_write_slot = 0;    // only touched on the frame path
+
+    // Latest encoded PNG, swapped in whole by the encoder thread
+    std::vector<uint8_t> m_png;
+    uint64_t m_png_seq = 0;
+    mutable std::mutex m_png_mutex;
+    std::condition_variable m_png_cv;
+
+    std::mutex m_encode_mutex;
+    std::condition_variable m_encode_cv;
+    std::thread m_encode_thread;
+    std::thread m_serve_thread;
+    std::atomic<bool> m_stop{false};
+    int m_listen_fd = -1;
+
+    // Counters (hot path bumps captured/skipped, so atomics)
+    std::atomic<uint64_t> m_frames_captured{0};
+    std::atomic<uint64_t> m_frames_skipped{0};
+    std::atomic<uint64_t> m_frames_encoded{0};
+    std::atomic<uint64_t> m_requests_served{0};
+
+    bool m_initialized = false;
+};
+
+} // namespace processing
+} // namespace ares
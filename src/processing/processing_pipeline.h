@@ -6,11 +6,16 @@
 #include "placebo_renderer.h"
 #include "black_bar_detector.h"
 #include "nls_shader.h"
+#include "preview_tap.h"
 #include "../osd/osd_renderer.h"
 #include "../osd/menu_system.h"
 #include "../input/ir_remote.h"
 #include <memory>
 #include <functional>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 namespace ares {
 namespace display {
@@ -39,12 +44,20 @@ public:
     // 5. OSD compositing (optional)
     Result processFrame(const VideoFrame& input, VideoFrame& output);
 
+    // Feed a frame from the secondary capture input. When PiP is enabled
+    // it is uploaded once and composited into the corner by the final
+    // render pass of every subsequent primary frame; when PiP is disabled
+    // the frame is ignored. Callers decimate uploads (config.pip
+    // .frame_divisor) — the inactive source does not need full rate
+    Result submitSecondaryFrame(const VideoFrame& frame);
+
     // OSD system access
     osd::MenuSystem* getMenuSystem() { return m_menu_system.get(); }
     osd::OSDRenderer* getOSDRenderer() { return m_osd_renderer.get(); }
     input::IRRemote* getIRRemote() { return m_ir_remote.get(); }
 
-    // Update configuration
+    // Update configuration. Publishes a new immutable snapshot; the
+    // frame path picks it up atomically at the start of the next frame
     void updateConfig(const ProcessingConfig& config);
 
     // Get current configuration
@@ -85,29 +98,92 @@ public:
 
     Stats getStats() const;
 
+    // Vulkan context (shared with the presenter; valid after initialize)
+    VulkanContext* getVulkanContext() const { return m_vulkan_context.get(); }
+
     // Frame callback for monitoring
+    // NOTE: invoked synchronously inside processFrame with the
+    // full-resolution frame — any work in the callback adds directly to
+    // frame latency. Remote/fleet monitoring should use the preview tap
     using FrameCallback = std::function<void(const VideoFrame& frame, const char* stage)>;
     void setFrameCallback(FrameCallback callback) { m_frame_callback = callback; }
 
+    // Asynchronous preview tap: GPU-downscales each rendered frame and
+    // serves it over 127.0.0.1:port from background threads, skipping
+    // frames when the consumer is slow — never touches the hot path
+    // (see PreviewTap). Valid after initialize
+    Result enablePreviewTap(uint16_t port, uint32_t width);
+    PreviewTap* getPreviewTap() const { return m_preview_tap.get(); }
+
 private:
     // Initialization helpers
     Result initializeVulkan();
     Result initializeProcessors();
 
-    // Processing stages
-    Result detectBlackBars(const VideoFrame& frame);
+    // One frame in flight through the split pipeline (see m_slots)
+    struct PipelineSlot {
+        // Config snapshot this frame runs under: captured once in the
+        // front half, so the back half (possibly on the pipeline thread)
+        // sees the same values even if a menu change lands in between
+        std::shared_ptr<const ProcessingConfig> config;
+        VideoFrame stage_frame;       // front-half result (crop view / NLS output)
+        VideoFrame output;            // back-half result
+        uint8_t* copy_buf = nullptr;  // slot-owned copy for CPU passthrough frames
+        size_t copy_buf_size = 0;
+        bool is_hdr = false;
+        bool deinterlace = false;     // interlaced frame needs the render pass
+        bool osd_visible = false;
+        bool back_done = true;
+        Result back_result = Result::SUCCESS;
+    };
+
+    // Execution modes
+    Result processFrameSerial(const VideoFrame& input, VideoFrame& output);
+    Result processFramePipelined(const VideoFrame& input, VideoFrame& output);
+
+    // Pipeline halves: the front half (stages 0-3 + OSD surface update)
+    // runs on the caller's thread, the back half (tone mapping + OSD
+    // compositing) either inline (serial mode) or on the pipeline thread
+    Result runFrontHalf(const VideoFrame& input, PipelineSlot& slot);
+    Result runBackHalf(PipelineSlot& slot, bool detach_output);
+
+    // Pipeline thread management
+    void startPipelineWorker();
+    void stopPipelineWorker();
+    void pipelineWorkerLoop();
+    void waitForSlot(int index);
+
+    // Processing stages (config comes from the frame's snapshot, never
+    // from the mutable master copy)
+    Result detectBlackBars(const VideoFrame& frame, const ProcessingConfig& config);
     Result applyCrop(const VideoFrame& input, VideoFrame& output);
-    Result applyNLS(const VideoFrame& input, VideoFrame& output);
-    Result applyToneMapping(const VideoFrame& input, VideoFrame& output);
+    Result resolveCropCPU(const VideoFrame& input, VideoFrame& output);
+    Result applyNLS(const VideoFrame& input, VideoFrame& output,
+                    const ProcessingConfig& config);
+    Result applyToneMapping(const VideoFrame& input, VideoFrame& output,
+                            const ProcessingConfig& config);
     Result compositeOSD(const VideoFrame& input, VideoFrame& output);
 
-    // Helper to allocate intermediate frames
+    // Copy the master config into a fresh immutable snapshot and publish
+    // it for the frame path
+    void publishConfig();
+
+    // Helper to allocate intermediate frames. Intermediates default to
+    // 16f working precision; quantization to output depth (plus
+    // dithering) happens exactly once, in the final render pass
     VideoFrame createIntermediateFrame(uint32_t width, uint32_t height,
-                                      PixelFormat format = PixelFormat::RGB_8BIT);
+                                      PixelFormat format = PixelFormat::RGB_16BIT_FLOAT);
     void freeIntermediateFrame(VideoFrame& frame);
 
-    // Configuration
+    // Configuration. m_config is the mutable master copy, touched only
+    // on the control thread (updateConfig, the menu callbacks wired by
+    // wireMenuToConfig — both run on the thread that calls
+    // processFrame). The frame path never reads it: every change is
+    // published as an immutable snapshot that the front half loads once
+    // per frame, so mid-playback menu edits swap in atomically between
+    // two frames with no locking anywhere on the per-frame path
     ProcessingConfig m_config;
+    std::atomic<std::shared_ptr<const ProcessingConfig>> m_config_snapshot;
 
     // Vulkan context (shared by all processors)
     std::unique_ptr<VulkanContext> m_vulkan_context;
@@ -116,6 +192,7 @@ private:
     std::unique_ptr<BlackBarDetector> m_black_bar_detector;
     std::unique_ptr<NLSShader> m_nls_shader;
     std::unique_ptr<PlaceboRenderer> m_tone_mapper;
+    std::unique_ptr<PreviewTap> m_preview_tap;
 
     // OSD system
     std::unique_ptr<osd::OSDRenderer> m_osd_renderer;
@@ -128,7 +205,24 @@ private:
     VideoFrame m_warped_frame;
     VideoFrame m_tone_mapped_frame;
 
-    // Statistics
+    // Pipelined execution (config.pipelined): the back half of frame N
+    // overlaps the front half of frame N+1, so output is delivered one
+    // frame behind. Two slots alternate strictly; the intermediate
+    // textures in NLSShader and PlaceboRenderer are double-buffered so
+    // the two frames in flight never share a render target.
+    static constexpr int PIPELINE_SLOTS = 2;
+    PipelineSlot m_slots[PIPELINE_SLOTS];
+    std::thread m_pipeline_thread;
+    std::mutex m_pipe_mutex;
+    std::condition_variable m_pipe_cv;
+    int m_work_pending = 0;       // back halves submitted, not yet started
+    bool m_pipe_stop = false;
+    int m_submit_slot = 0;        // slot the next front half writes
+    int m_prev_slot = -1;         // slot delivered on the next call
+
+    // Statistics. Written on the frame thread, read via getStats() from
+    // the event loop's UI tick, so every access goes through the mutex.
+    mutable std::mutex m_stats_mutex;
     Stats m_stats;
 
     // Frame monitoring callback
@@ -12,9 +12,48 @@ SceneAnalyzer::SceneAnalyzer() {
 }
 
 SceneAnalyzer::~SceneAnalyzer() {
+    stopWorker();
+    if (m_analysis_tex) {
+        pl_tex_destroy(m_gpu, &m_analysis_tex);
+    }
     LOG_INFO("Processing", "SceneAnalyzer destroyed");
 }
 
+void SceneAnalyzer::stopWorker() {
+    {
+        std::lock_guard<std::mutex> lock(m_job_mutex);
+        m_worker_stop = true;
+    }
+    m_job_cv.notify_all();
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+}
+
+void SceneAnalyzer::workerLoop() {
+    std::vector<uint8_t> buf;
+    HDRMetadata hdr;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_job_mutex);
+            m_job_cv.wait(lock, [this] { return m_job_pending || m_worker_stop; });
+
+            if (m_worker_stop) {
+                return;
+            }
+
+            buf.swap(m_job_buf);
+            hdr = m_job_hdr;
+            m_job_pending = false;
+        }
+
+        float histogram_luma = 0.0f;
+        BrightnessStats stats = reduceAnalysisBuffer(buf, histogram_luma);
+        processStats(stats, histogram_luma, hdr);
+    }
+}
+
 void SceneAnalyzer::initialize(const ToneMappingConfig::DynamicToneMappingConfig& config) {
     m_config = config;
     m_initialized = true;
@@ -36,6 +75,7 @@ void SceneAnalyzer::initialize(const ToneMappingConfig::DynamicToneMappingConfig
 }
 
 void SceneAnalyzer::reset() {
+    std::lock_guard<std::mutex> lock(m_params_mutex);
     m_window.clear();
     m_frame_count = 0;
     memset(&m_previous_stats, 0, sizeof(m_previous_stats));
@@ -228,11 +268,148 @@ bool SceneAnalyzer::analyzeFrame(const VideoFrame& frame, const HDRMetadata& hdr
         return false;
     }
 
+    // Calculate brightness statistics on the CPU
+    BrightnessStats stats = calculateBrightness(frame);
+    float histogram_luma = calculateHistogramBrightness(frame, m_config.peak_percentile);
+
+    return processStats(stats, histogram_luma, hdr_metadata);
+}
+
+bool SceneAnalyzer::analyzeFrameGPU(pl_gpu gpu, pl_tex source, const HDRMetadata& hdr_metadata) {
+    if (!m_initialized) {
+        LOG_WARN("Processing", "SceneAnalyzer not initialized");
+        return false;
+    }
+
+    if (!gpu || !source) {
+        return false;
+    }
+
+    m_gpu = gpu;
+
+    // Lazily create the tiny analysis target (host-readable blit dst)
+    if (!m_analysis_tex) {
+        struct pl_tex_params tex_params = {};
+        tex_params.w = ANALYSIS_WIDTH;
+        tex_params.h = ANALYSIS_HEIGHT;
+        tex_params.format = pl_find_fmt(gpu, PL_FMT_UNORM, 4, 0, 8,
+                                        static_cast<pl_fmt_caps>(PL_FMT_CAP_BLITTABLE | PL_FMT_CAP_HOST_READABLE));
+        tex_params.blit_dst = true;
+        tex_params.host_readable = true;
+        m_analysis_tex = pl_tex_create(gpu, &tex_params);
+
+        if (!m_analysis_tex) {
+            LOG_WARN("Processing", "Failed to create analysis texture, falling back to CPU analysis");
+            return false;
+        }
+
+        m_analysis_buf.resize((size_t)ANALYSIS_WIDTH * ANALYSIS_HEIGHT * 4);
+        LOG_INFO("Processing", "GPU scene analysis enabled (%dx%d reduction target)",
+                 ANALYSIS_WIDTH, ANALYSIS_HEIGHT);
+    }
+
+    // GPU reduction: linear-filtered blit collapses the 4K frame to the
+    // analysis target, so only ~36 KB cross the PCIe bus per frame
+    struct pl_tex_blit_params blit_params = {};
+    blit_params.src = source;
+    blit_params.dst = m_analysis_tex;
+    blit_params.sample_mode = PL_TEX_SAMPLE_LINEAR;
+    pl_tex_blit(gpu, &blit_params);
+
+    struct pl_tex_transfer_params download_params = {};
+    download_params.tex = m_analysis_tex;
+    download_params.ptr = m_analysis_buf.data();
+    if (!pl_tex_download(gpu, &download_params)) {
+        LOG_WARN("Processing", "Analysis readback failed");
+        return false;
+    }
+
+    // Hand the readback to the analysis worker and return immediately;
+    // this frame renders with the parameters derived from the previous
+    // one. If the worker is still chewing on the last buffer, skip this
+    // frame's analysis rather than stall.
+    if (!m_worker.joinable()) {
+        m_worker_stop = false;
+        m_worker = std::thread(&SceneAnalyzer::workerLoop, this);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_job_mutex);
+        if (!m_job_pending) {
+            m_job_buf = m_analysis_buf;
+            m_job_hdr = hdr_metadata;
+            m_job_pending = true;
+        }
+    }
+    m_job_cv.notify_one();
+
+    {
+        std::lock_guard<std::mutex> lock(m_params_mutex);
+        return m_current_params.scene_changed;
+    }
+}
+
+SceneAnalyzer::BrightnessStats SceneAnalyzer::reduceAnalysisBuffer(const std::vector<uint8_t>& buf,
+                                                                   float& histogram_luma) {
+    BrightnessStats stats = {};
+    stats.frame_number = m_frame_count;
+
+    const int histogram_bins = 256;
+    std::vector<uint32_t> histogram(histogram_bins, 0);
+
+    uint64_t sum_luma = 0;
+    uint64_t sample_count = 0;
+    float max_luma = 0.0f;
+
+    // The buffer is tiny (128x72 RGBA), walk every pixel
+    for (size_t idx = 0; idx + 3 < buf.size(); idx += 4) {
+        uint8_t r = buf[idx + 0];
+        uint8_t g = buf[idx + 1];
+        uint8_t b = buf[idx + 2];
+
+        // BT.709 luma coefficients
+        float luma = (0.2126f * r + 0.7152f * g + 0.0722f * b) / 255.0f;
+
+        sum_luma += (uint64_t)(luma * 1000.0f);
+        max_luma = std::max(max_luma, luma);
+        sample_count++;
+
+        int bin = std::min((int)(luma * (histogram_bins - 1)), histogram_bins - 1);
+        histogram[bin]++;
+    }
+
+    if (sample_count > 0) {
+        stats.avg_luma = (sum_luma / (float)sample_count) / 1000.0f;
+        stats.peak_luma = max_luma;
+    }
+
+    // Percentile from histogram
+    uint64_t target_count = (uint64_t)(sample_count * (m_config.peak_percentile / 100.0f));
+    uint64_t cumulative = 0;
+    int percentile_bin = histogram_bins - 1;
+
+    for (int i = 0; i < histogram_bins; i++) {
+        cumulative += histogram[i];
+        if (cumulative >= target_count) {
+            percentile_bin = i;
+            break;
+        }
+    }
+
+    histogram_luma = percentile_bin / (float)(histogram_bins - 1);
+
+    return stats;
+}
+
+bool SceneAnalyzer::processStats(BrightnessStats stats, float histogram_luma,
+                                 const HDRMetadata& hdr_metadata) {
+    // Runs on the analysis worker for the GPU path and inline for the CPU
+    // fallback; all parameter/stat writes stay behind m_params_mutex
+    std::lock_guard<std::mutex> lock(m_params_mutex);
+
     m_frame_count++;
     m_current_params.frame_count = m_frame_count;
-
-    // Calculate brightness statistics
-    BrightnessStats stats = calculateBrightness(frame);
+    stats.frame_number = m_frame_count;
 
     // Detect scene change
     bool scene_changed = detectSceneChange(stats);
@@ -279,9 +456,6 @@ bool SceneAnalyzer::analyzeFrame(const VideoFrame& frame, const HDRMetadata& hdr
         m_stats.smoothed_peak_luma = window_peak_luma;
         m_stats.frames_analyzed = m_frame_count;
 
-        // Calculate histogram-based brightness
-        float histogram_luma = calculateHistogramBrightness(frame, m_config.peak_percentile);
-
         // Convert to nits
         float avg_nits = lumaNitsToFloat(window_avg_luma, hdr_metadata);
         float peak_nits = lumaNitsToFloat(window_peak_luma, hdr_metadata);
@@ -354,6 +528,7 @@ bool SceneAnalyzer::analyzeFrame(const VideoFrame& frame, const HDRMetadata& hdr
 }
 
 SceneAnalyzer::DynamicParams SceneAnalyzer::getDynamicParams() const {
+    std::lock_guard<std::mutex> lock(m_params_mutex);
     return m_current_params;
 }
 
@@ -2,8 +2,12 @@
 
 #include <ares/types.h>
 #include <ares/processing_config.h>
+#include <libplacebo/gpu.h>
 #include <vector>
 #include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 namespace ares {
 namespace processing {
@@ -32,6 +36,17 @@ public:
     // Returns true if scene changed
     bool analyzeFrame(const VideoFrame& frame, const HDRMetadata& hdr_metadata);
 
+    // GPU analysis path: reduce the already-uploaded source texture on the
+    // GPU (linear blit down to a tiny analysis target), read back a few KB
+    // and hand the reduction to the analysis worker. The stats/histogram
+    // math and parameter smoothing run asynchronously, so the render path
+    // only pays for the blit and the small readback; frame N renders with
+    // parameters derived from frame N-1 (invisible, since dynamic
+    // parameters only move meaningfully on scene cuts).
+    // TODO: Replace the blit reduction with a proper compute-shader
+    // histogram once shaderc integration lands (same blocker as NLS).
+    bool analyzeFrameGPU(pl_gpu gpu, pl_tex source, const HDRMetadata& hdr_metadata);
+
     // Get dynamic tone mapping parameters based on current scene
     struct DynamicParams {
         float source_nits;              // Dynamically adjusted source peak
@@ -57,7 +72,10 @@ public:
         uint64_t scene_changes;         // Number of scene changes detected
         float last_scene_delta;         // Last scene change delta
     };
-    Stats getStats() const { return m_stats; }
+    Stats getStats() const {
+        std::lock_guard<std::mutex> lock(m_params_mutex);
+        return m_stats;
+    }
 
 private:
     // Brightness analysis
@@ -74,6 +92,19 @@ private:
     // Calculate histogram-based brightness
     float calculateHistogramBrightness(const VideoFrame& frame, float percentile);
 
+    // Shared back half of analysis: scene detection, windowing and
+    // dynamic parameter smoothing (used by both CPU and GPU paths)
+    bool processStats(BrightnessStats stats, float histogram_luma,
+                      const HDRMetadata& hdr_metadata);
+
+    // Reduce a downsampled RGBA readback buffer to brightness stats
+    BrightnessStats reduceAnalysisBuffer(const std::vector<uint8_t>& buf,
+                                         float& histogram_luma);
+
+    // Analysis worker (one-frame-behind async processing)
+    void workerLoop();
+    void stopWorker();
+
     // Detect scene change
     bool detectSceneChange(const BrightnessStats& current);
 
@@ -98,6 +129,25 @@ private:
     // Statistics
     Stats m_stats;
 
+    // GPU analysis resources (lazily created on first GPU analysis)
+    static constexpr int ANALYSIS_WIDTH = 128;
+    static constexpr int ANALYSIS_HEIGHT = 72;
+    pl_gpu m_gpu = nullptr;
+    pl_tex m_analysis_tex = nullptr;
+    std::vector<uint8_t> m_analysis_buf;
+
+    // Async analysis worker: the render thread drops the readback buffer
+    // into a one-deep mailbox and moves on; the worker reduces it and
+    // updates the dynamic parameters behind m_params_mutex
+    std::thread m_worker;
+    std::mutex m_job_mutex;
+    std::condition_variable m_job_cv;
+    std::vector<uint8_t> m_job_buf;
+    HDRMetadata m_job_hdr;
+    bool m_job_pending = false;
+    bool m_worker_stop = false;
+    mutable std::mutex m_params_mutex;
+
     // State
     bool m_initialized = false;
     uint64_t m_frame_count = 0;
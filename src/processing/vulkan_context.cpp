@@ -1,9 +1,14 @@
 #include "vulkan_context.h"
 #include "core/logger.h"
 
+#include <algorithm>
 #include <cstring>
+#include <fstream>
 #include <vector>
 #include <set>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <unistd.h>
 
 namespace ares {
 namespace processing {
@@ -13,6 +18,10 @@ static const std::vector<const char*> validation_layers = {
     "VK_LAYER_KHRONOS_validation"
 };
 
+// On-disk location of the serialized pipeline cache (config directory,
+// same place as ares.ini)
+static const char* PIPELINE_CACHE_PATH = "/etc/ares/pipeline.cache";
+
 VulkanContext::VulkanContext() {
     LOG_INFO("Processing", "VulkanContext created");
 }
@@ -21,13 +30,16 @@ VulkanContext::~VulkanContext() {
     cleanup();
 }
 
-Result VulkanContext::initialize(bool enable_validation) {
+Result VulkanContext::initialize(bool enable_validation, int device_index,
+                                 const std::string& device_name) {
     if (m_initialized) {
         LOG_WARN("Processing", "VulkanContext already initialized");
         return Result::SUCCESS;
     }
 
     m_validation_enabled = enable_validation;
+    m_requested_device_index = device_index;
+    m_requested_device_name = device_name;
 
     LOG_INFO("Processing", "Initializing Vulkan context (validation: %s)",
              enable_validation ? "enabled" : "disabled");
@@ -63,6 +75,25 @@ Result VulkanContext::initialize(bool enable_validation) {
         return result;
     }
 
+    // Create the reusable submission ring
+    result = createSubmitRing();
+    if (result != Result::SUCCESS) {
+        LOG_ERROR("Processing", "Failed to create submission ring");
+        cleanup();
+        return result;
+    }
+
+    // Restore the persistent pipeline cache (non-fatal if missing)
+    createPipelineCache();
+
+    // GPU timestamp support (for per-pass timing; see createGpuTimer)
+    if (m_device_properties.limits.timestampComputeAndGraphics &&
+        m_device_properties.limits.timestampPeriod > 0.0f) {
+        m_timestamp_period = m_device_properties.limits.timestampPeriod;
+    } else {
+        LOG_WARN("Processing", "Device has no GPU timestamp support; per-pass GPU timing disabled");
+    }
+
     m_initialized = true;
 
     // Print device info
@@ -88,6 +119,26 @@ void VulkanContext::cleanup() {
         vkDeviceWaitIdle(m_device);
     }
 
+    // Persist and destroy the pipeline cache
+    savePipelineCache();
+
+    // Destroy the GPU timer query pools
+    for (auto& timer : m_gpu_timers) {
+        if (timer.pool != VK_NULL_HANDLE) {
+            vkDestroyQueryPool(m_device, timer.pool, nullptr);
+        }
+    }
+    m_gpu_timers.clear();
+
+    // Destroy the submission ring
+    destroySubmitRing();
+
+    // Destroy the sync-fd export semaphore
+    if (m_export_semaphore != VK_NULL_HANDLE) {
+        vkDestroySemaphore(m_device, m_export_semaphore, nullptr);
+        m_export_semaphore = VK_NULL_HANDLE;
+    }
+
     // Destroy logical device
     if (m_device != VK_NULL_HANDLE) {
         vkDestroyDevice(m_device, nullptr);
@@ -193,11 +244,50 @@ Result VulkanContext::selectPhysicalDevice() {
     std::vector<VkPhysicalDevice> devices(device_count);
     vkEnumeratePhysicalDevices(m_instance, &device_count, devices.data());
 
-    // Score devices and pick the best one
-    int best_score = -1;
     VkPhysicalDevice best_device = VK_NULL_HANDLE;
 
+    // Explicit index from config wins outright
+    if (m_requested_device_index >= 0) {
+        if (m_requested_device_index < (int)device_count) {
+            best_device = devices[m_requested_device_index];
+        } else {
+            LOG_WARN("Processing", "gpu.device_index %d out of range (%u devices), "
+                     "falling back to automatic selection",
+                     m_requested_device_index, device_count);
+        }
+    }
+
+    // Then a case-insensitive substring match on the device name
+    if (best_device == VK_NULL_HANDLE && !m_requested_device_name.empty()) {
+        std::string wanted = m_requested_device_name;
+        std::transform(wanted.begin(), wanted.end(), wanted.begin(), ::tolower);
+
+        for (const auto& device : devices) {
+            VkPhysicalDeviceProperties properties;
+            vkGetPhysicalDeviceProperties(device, &properties);
+
+            std::string name = properties.deviceName;
+            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+            if (name.find(wanted) != std::string::npos) {
+                best_device = device;
+                break;
+            }
+        }
+
+        if (best_device == VK_NULL_HANDLE) {
+            LOG_WARN("Processing", "No GPU matching '%s', falling back to "
+                     "automatic selection", m_requested_device_name.c_str());
+        }
+    }
+
+    // Otherwise score devices and pick the best one
+    int best_score = -1;
+
     for (const auto& device : devices) {
+        if (best_device != VK_NULL_HANDLE && best_score < 0) {
+            break;  // explicit selection above, skip scoring
+        }
+
         VkPhysicalDeviceProperties properties;
         VkPhysicalDeviceFeatures features;
         vkGetPhysicalDeviceProperties(device, &properties);
@@ -233,9 +323,56 @@ Result VulkanContext::selectPhysicalDevice() {
     vkGetPhysicalDeviceMemoryProperties(m_physical_device, &m_memory_properties);
     vkGetPhysicalDeviceFeatures(m_physical_device, &m_device_features);
 
+    // Record which DRM node backs this device (VK_EXT_physical_device_drm)
+    // so drivesDisplayDevice() can detect a render/scanout split
+    uint32_t ext_count = 0;
+    vkEnumerateDeviceExtensionProperties(m_physical_device, nullptr, &ext_count, nullptr);
+    std::vector<VkExtensionProperties> extensions(ext_count);
+    vkEnumerateDeviceExtensionProperties(m_physical_device, nullptr, &ext_count,
+                                         extensions.data());
+
+    bool has_drm_props = false;
+    for (const auto& ext : extensions) {
+        if (std::strcmp(ext.extensionName, VK_EXT_PHYSICAL_DEVICE_DRM_EXTENSION_NAME) == 0) {
+            has_drm_props = true;
+            break;
+        }
+    }
+
+    if (has_drm_props) {
+        VkPhysicalDeviceDrmPropertiesEXT drm_props = {};
+        drm_props.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT;
+
+        VkPhysicalDeviceProperties2 props2 = {};
+        props2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        props2.pNext = &drm_props;
+        vkGetPhysicalDeviceProperties2(m_physical_device, &props2);
+
+        if (drm_props.hasPrimary) {
+            m_drm_primary_major = drm_props.primaryMajor;
+            m_drm_primary_minor = drm_props.primaryMinor;
+            m_drm_props_valid = true;
+        }
+    }
+
     return Result::SUCCESS;
 }
 
+bool VulkanContext::drivesDisplayDevice(const std::string& card_path) const {
+    if (!m_drm_props_valid) {
+        // Can't tell — assume single-GPU so nothing changes behavior
+        return true;
+    }
+
+    struct stat st;
+    if (stat(card_path.c_str(), &st) != 0) {
+        return true;
+    }
+
+    return (int64_t)major(st.st_rdev) == m_drm_primary_major &&
+           (int64_t)minor(st.st_rdev) == m_drm_primary_minor;
+}
+
 Result VulkanContext::findQueueFamilies() {
     uint32_t queue_family_count = 0;
     vkGetPhysicalDeviceQueueFamilyProperties(m_physical_device, &queue_family_count, nullptr);
@@ -284,6 +421,10 @@ Result VulkanContext::findQueueFamilies() {
         return Result::ERROR_NOT_FOUND;
     }
 
+    // Remember how many queues the graphics family exposes so the logical
+    // device can pull a second one for async compute if needed
+    m_graphics_family_queue_count = queue_families[m_graphics_queue_family].queueCount;
+
     // Use graphics queue for compute/transfer if dedicated queues not found
     if (!found_compute) {
         m_compute_queue_family = m_graphics_queue_family;
@@ -304,14 +445,24 @@ Result VulkanContext::createLogicalDevice() {
     };
 
     std::vector<VkDeviceQueueCreateInfo> queue_create_infos;
-    float queue_priority = 1.0f;
+    float queue_priorities[2] = {1.0f, 1.0f};
+
+    // When compute falls back to the graphics family, pull a second queue
+    // from it (if the hardware exposes one) so compute dispatches run
+    // asynchronously instead of serializing behind render submissions
+    m_compute_queue_index = 0;
+    if (m_compute_queue_family == m_graphics_queue_family &&
+        m_graphics_family_queue_count >= 2) {
+        m_compute_queue_index = 1;
+    }
 
     for (uint32_t queue_family : unique_queue_families) {
         VkDeviceQueueCreateInfo queue_create_info = {};
         queue_create_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
         queue_create_info.queueFamilyIndex = queue_family;
-        queue_create_info.queueCount = 1;
-        queue_create_info.pQueuePriorities = &queue_priority;
+        queue_create_info.queueCount =
+            (queue_family == m_graphics_queue_family && m_compute_queue_index == 1) ? 2 : 1;
+        queue_create_info.pQueuePriorities = queue_priorities;
         queue_create_infos.push_back(queue_create_info);
     }
 
@@ -320,13 +471,67 @@ Result VulkanContext::createLogicalDevice() {
     device_features.samplerAnisotropy = VK_TRUE;
     device_features.shaderInt64 = VK_TRUE;
 
+    // Timeline semaphores (core in Vulkan 1.2) back the submission ring;
+    // without them endSingleTimeCommands falls back to vkQueueWaitIdle
+    VkPhysicalDeviceVulkan12Features supported12 = {};
+    supported12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    VkPhysicalDeviceFeatures2 supported2 = {};
+    supported2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    supported2.pNext = &supported12;
+    vkGetPhysicalDeviceFeatures2(m_physical_device, &supported2);
+    m_timeline_supported = (supported12.timelineSemaphore == VK_TRUE);
+
+    VkPhysicalDeviceVulkan12Features enabled12 = {};
+    enabled12.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+    enabled12.timelineSemaphore = VK_TRUE;
+
+    // External memory extensions let capture dma-bufs be imported as GPU
+    // memory (zero-copy upload); enable them when the device offers them
+    uint32_t ext_count = 0;
+    vkEnumerateDeviceExtensionProperties(m_physical_device, nullptr, &ext_count, nullptr);
+    std::vector<VkExtensionProperties> available_exts(ext_count);
+    vkEnumerateDeviceExtensionProperties(m_physical_device, nullptr, &ext_count,
+                                         available_exts.data());
+
+    const char* wanted_exts[] = {
+        VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME,
+        VK_EXT_EXTERNAL_MEMORY_DMA_BUF_EXTENSION_NAME,
+        VK_KHR_EXTERNAL_SEMAPHORE_FD_EXTENSION_NAME,
+    };
+    std::vector<const char*> enabled_exts;
+    for (const char* wanted : wanted_exts) {
+        for (const VkExtensionProperties& ext : available_exts) {
+            if (strcmp(ext.extensionName, wanted) == 0) {
+                enabled_exts.push_back(wanted);
+                m_enabled_extensions.push_back(wanted);
+                break;
+            }
+        }
+    }
+    m_dmabuf_import_supported =
+        hasExtension(VK_EXT_EXTERNAL_MEMORY_DMA_BUF_EXTENSION_NAME);
+    if (!m_dmabuf_import_supported) {
+        LOG_WARN("Processing", "dma-buf import not supported, capture uploads will stage through CPU");
+    }
+    m_syncfd_export_supported =
+        hasExtension(VK_KHR_EXTERNAL_SEMAPHORE_FD_EXTENSION_NAME);
+    if (!m_syncfd_export_supported) {
+        LOG_WARN("Processing", "Sync-fd export not supported, atomic commits won't carry GPU fences");
+    }
+
     // Device create info
     VkDeviceCreateInfo create_info = {};
     create_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
     create_info.queueCreateInfoCount = static_cast<uint32_t>(queue_create_infos.size());
     create_info.pQueueCreateInfos = queue_create_infos.data();
     create_info.pEnabledFeatures = &device_features;
-    create_info.enabledExtensionCount = 0;
+    create_info.enabledExtensionCount = static_cast<uint32_t>(enabled_exts.size());
+    create_info.ppEnabledExtensionNames = enabled_exts.data();
+    if (m_timeline_supported) {
+        create_info.pNext = &enabled12;
+    } else {
+        LOG_WARN("Processing", "Timeline semaphores not supported, submissions will drain the queue");
+    }
 
     // Enable validation layers for device (deprecated but still supported)
     if (m_validation_enabled) {
@@ -345,9 +550,16 @@ Result VulkanContext::createLogicalDevice() {
 
     // Get queue handles
     vkGetDeviceQueue(m_device, m_graphics_queue_family, 0, &m_graphics_queue);
-    vkGetDeviceQueue(m_device, m_compute_queue_family, 0, &m_compute_queue);
+    vkGetDeviceQueue(m_device, m_compute_queue_family, m_compute_queue_index, &m_compute_queue);
     vkGetDeviceQueue(m_device, m_transfer_queue_family, 0, &m_transfer_queue);
 
+    if (hasAsyncComputeQueue()) {
+        LOG_INFO("Processing", "Async compute queue: family %u, index %u",
+                 m_compute_queue_family, m_compute_queue_index);
+    } else {
+        LOG_WARN("Processing", "No async compute queue available, compute shares the graphics queue");
+    }
+
     return Result::SUCCESS;
 }
 
@@ -413,6 +625,155 @@ uint32_t VulkanContext::findMemoryType(uint32_t type_filter,
     return UINT32_MAX;
 }
 
+Result VulkanContext::importDmaBuf(int fd, size_t size,
+                                   VkBuffer& buffer, VkDeviceMemory& memory) {
+    if (!m_dmabuf_import_supported) {
+        return Result::ERROR_NOT_FOUND;
+    }
+
+    // Buffer flagged as externally backed
+    VkExternalMemoryBufferCreateInfo external_info = {};
+    external_info.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+    external_info.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.pNext = &external_info;
+    buffer_info.size = size;
+    buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    if (vkCreateBuffer(m_device, &buffer_info, nullptr, &buffer) != VK_SUCCESS) {
+        LOG_ERROR("Processing", "Failed to create dma-buf import buffer");
+        return Result::ERROR_GENERIC;
+    }
+
+    // Which memory types can back this dma-buf
+    auto pfnGetMemoryFdProperties = (PFN_vkGetMemoryFdPropertiesKHR)
+        vkGetDeviceProcAddr(m_device, "vkGetMemoryFdPropertiesKHR");
+    VkMemoryFdPropertiesKHR fd_props = {};
+    fd_props.sType = VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR;
+    if (!pfnGetMemoryFdProperties ||
+        pfnGetMemoryFdProperties(m_device,
+                                 VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT,
+                                 fd, &fd_props) != VK_SUCCESS) {
+        LOG_ERROR("Processing", "Failed to query dma-buf memory properties");
+        vkDestroyBuffer(m_device, buffer, nullptr);
+        buffer = VK_NULL_HANDLE;
+        return Result::ERROR_GENERIC;
+    }
+
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(m_device, buffer, &requirements);
+
+    uint32_t memory_type = findMemoryType(
+        requirements.memoryTypeBits & fd_props.memoryTypeBits, 0);
+    if (memory_type == UINT32_MAX) {
+        vkDestroyBuffer(m_device, buffer, nullptr);
+        buffer = VK_NULL_HANDLE;
+        return Result::ERROR_GENERIC;
+    }
+
+    // vkAllocateMemory consumes the fd on success, so import a duplicate
+    // and leave the caller's fd alone
+    VkImportMemoryFdInfoKHR import_info = {};
+    import_info.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR;
+    import_info.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT;
+    import_info.fd = dup(fd);
+
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.pNext = &import_info;
+    alloc_info.allocationSize = requirements.size;
+    alloc_info.memoryTypeIndex = memory_type;
+
+    if (vkAllocateMemory(m_device, &alloc_info, nullptr, &memory) != VK_SUCCESS) {
+        LOG_ERROR("Processing", "Failed to import dma-buf memory");
+        close(import_info.fd);
+        vkDestroyBuffer(m_device, buffer, nullptr);
+        buffer = VK_NULL_HANDLE;
+        return Result::ERROR_GENERIC;
+    }
+
+    if (vkBindBufferMemory(m_device, buffer, memory, 0) != VK_SUCCESS) {
+        LOG_ERROR("Processing", "Failed to bind imported dma-buf memory");
+        vkFreeMemory(m_device, memory, nullptr);
+        vkDestroyBuffer(m_device, buffer, nullptr);
+        memory = VK_NULL_HANDLE;
+        buffer = VK_NULL_HANDLE;
+        return Result::ERROR_GENERIC;
+    }
+
+    return Result::SUCCESS;
+}
+
+int VulkanContext::exportSyncFd() {
+    if (!m_syncfd_export_supported) {
+        return -1;
+    }
+
+    // Lazily create the exportable semaphore
+    if (m_export_semaphore == VK_NULL_HANDLE) {
+        VkExportSemaphoreCreateInfo export_info = {};
+        export_info.sType = VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO;
+        export_info.handleTypes = VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT;
+
+        VkSemaphoreCreateInfo sem_info = {};
+        sem_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        sem_info.pNext = &export_info;
+
+        if (vkCreateSemaphore(m_device, &sem_info, nullptr, &m_export_semaphore) != VK_SUCCESS) {
+            LOG_WARN("Processing", "Failed to create exportable semaphore");
+            m_syncfd_export_supported = false;
+            return -1;
+        }
+    }
+
+    // Empty submission: by queue submission order the signal fires once
+    // everything submitted to the graphics queue so far has completed.
+    // Waiting on the previous signal first resets the binary semaphore
+    // so it can be reused every frame.
+    VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    if (m_export_sem_pending) {
+        submit_info.waitSemaphoreCount = 1;
+        submit_info.pWaitSemaphores = &m_export_semaphore;
+        submit_info.pWaitDstStageMask = &wait_stage;
+    }
+    submit_info.signalSemaphoreCount = 1;
+    submit_info.pSignalSemaphores = &m_export_semaphore;
+
+    if (vkQueueSubmit(m_graphics_queue, 1, &submit_info, VK_NULL_HANDLE) != VK_SUCCESS) {
+        LOG_WARN("Processing", "Sync-fd export submit failed");
+        return -1;
+    }
+    m_export_sem_pending = true;
+
+    auto pfnGetSemaphoreFd = (PFN_vkGetSemaphoreFdKHR)
+        vkGetDeviceProcAddr(m_device, "vkGetSemaphoreFdKHR");
+    if (!pfnGetSemaphoreFd) {
+        return -1;
+    }
+
+    VkSemaphoreGetFdInfoKHR fd_info = {};
+    fd_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR;
+    fd_info.semaphore = m_export_semaphore;
+    fd_info.handleType = VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT;
+
+    int fd = -1;
+    if (pfnGetSemaphoreFd(m_device, &fd_info, &fd) != VK_SUCCESS) {
+        LOG_WARN("Processing", "vkGetSemaphoreFdKHR failed");
+        return -1;
+    }
+
+    // SYNC_FD export has copy transference: it behaves like a wait and
+    // resets the semaphore, so the next export must not wait on it
+    m_export_sem_pending = false;
+
+    return fd;
+}
+
 VkCommandPool VulkanContext::createCommandPool(uint32_t queue_family,
                                                VkCommandPoolCreateFlags flags) {
     VkCommandPoolCreateInfo pool_info = {};
@@ -457,17 +818,370 @@ VkCommandBuffer VulkanContext::beginSingleTimeCommands(VkCommandPool pool) {
 void VulkanContext::endSingleTimeCommands(VkCommandBuffer command_buffer,
                                          VkCommandPool pool,
                                          VkQueue queue) {
+    uint64_t value = submitCommands(command_buffer, queue);
+
+    if (value != 0) {
+        // Wait for this submission only; other work queued behind it
+        // (e.g. the next frame's uploads) keeps running
+        waitSubmit(value);
+    } else {
+        // No timeline semaphore: fall back to draining the queue
+        vkQueueWaitIdle(queue);
+    }
+
+    vkFreeCommandBuffers(m_device, pool, 1, &command_buffer);
+}
+
+Result VulkanContext::createSubmitRing() {
+    if (!m_timeline_supported) {
+        return Result::SUCCESS;
+    }
+
+    // Timeline semaphore shared by every submission through this context
+    VkSemaphoreTypeCreateInfo type_info = {};
+    type_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    type_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    type_info.initialValue = 0;
+
+    VkSemaphoreCreateInfo sem_info = {};
+    sem_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    sem_info.pNext = &type_info;
+
+    if (vkCreateSemaphore(m_device, &sem_info, nullptr, &m_timeline_semaphore) != VK_SUCCESS) {
+        LOG_ERROR("Processing", "Failed to create timeline semaphore");
+        return Result::ERROR_GENERIC;
+    }
+
+    // Pre-allocate the reusable command buffers
+    m_submit_pool = createCommandPool(m_graphics_queue_family,
+                                      VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+    if (m_submit_pool == VK_NULL_HANDLE) {
+        return Result::ERROR_GENERIC;
+    }
+
+    VkCommandBufferAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc_info.commandPool = m_submit_pool;
+    alloc_info.commandBufferCount = SUBMIT_RING_SIZE;
+
+    if (vkAllocateCommandBuffers(m_device, &alloc_info, m_submit_ring) != VK_SUCCESS) {
+        LOG_ERROR("Processing", "Failed to allocate submission ring");
+        return Result::ERROR_GENERIC;
+    }
+
+    LOG_INFO("Processing", "Submission ring ready (%u command buffers, timeline semaphore)",
+             SUBMIT_RING_SIZE);
+
+    return Result::SUCCESS;
+}
+
+void VulkanContext::destroySubmitRing() {
+    if (m_submit_pool != VK_NULL_HANDLE) {
+        vkFreeCommandBuffers(m_device, m_submit_pool, SUBMIT_RING_SIZE, m_submit_ring);
+        vkDestroyCommandPool(m_device, m_submit_pool, nullptr);
+        m_submit_pool = VK_NULL_HANDLE;
+    }
+
+    if (m_timeline_semaphore != VK_NULL_HANDLE) {
+        vkDestroySemaphore(m_device, m_timeline_semaphore, nullptr);
+        m_timeline_semaphore = VK_NULL_HANDLE;
+    }
+
+    for (uint32_t i = 0; i < SUBMIT_RING_SIZE; i++) {
+        m_submit_ring[i] = VK_NULL_HANDLE;
+        m_submit_ring_value[i] = 0;
+    }
+    m_submit_ring_index = 0;
+    m_timeline_value = 0;
+}
+
+VkCommandBuffer VulkanContext::beginCommands() {
+    if (m_submit_pool == VK_NULL_HANDLE) {
+        return VK_NULL_HANDLE;
+    }
+
+    uint32_t slot = m_submit_ring_index;
+    m_submit_ring_index = (m_submit_ring_index + 1) % SUBMIT_RING_SIZE;
+
+    // Recycle the slot: wait (usually a no-op, the ring is SUBMIT_RING_SIZE
+    // submissions deep) for its previous submission to retire
+    if (m_submit_ring_value[slot] != 0) {
+        waitSubmit(m_submit_ring_value[slot]);
+    }
+
+    VkCommandBuffer command_buffer = m_submit_ring[slot];
+    vkResetCommandBuffer(command_buffer, 0);
+
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+    vkBeginCommandBuffer(command_buffer, &begin_info);
+
+    return command_buffer;
+}
+
+uint64_t VulkanContext::submitCommands(VkCommandBuffer command_buffer, VkQueue queue) {
     vkEndCommandBuffer(command_buffer);
 
+    if (m_timeline_semaphore == VK_NULL_HANDLE) {
+        // No timeline support: plain submit, caller must drain the queue
+        VkSubmitInfo submit_info = {};
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &command_buffer;
+        vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+        return 0;
+    }
+
+    uint64_t value = m_timeline_value + 1;
+
+    VkTimelineSemaphoreSubmitInfo timeline_info = {};
+    timeline_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timeline_info.signalSemaphoreValueCount = 1;
+    timeline_info.pSignalSemaphoreValues = &value;
+
     VkSubmitInfo submit_info = {};
     submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.pNext = &timeline_info;
     submit_info.commandBufferCount = 1;
     submit_info.pCommandBuffers = &command_buffer;
+    submit_info.signalSemaphoreCount = 1;
+    submit_info.pSignalSemaphores = &m_timeline_semaphore;
+
+    if (vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE) != VK_SUCCESS) {
+        LOG_ERROR("Processing", "Queue submit failed");
+        return 0;
+    }
 
-    vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
-    vkQueueWaitIdle(queue);
+    m_timeline_value = value;
 
-    vkFreeCommandBuffers(m_device, pool, 1, &command_buffer);
+    // Record the retire value for ring-owned command buffers
+    for (uint32_t i = 0; i < SUBMIT_RING_SIZE; i++) {
+        if (m_submit_ring[i] == command_buffer) {
+            m_submit_ring_value[i] = value;
+            break;
+        }
+    }
+
+    return value;
+}
+
+Result VulkanContext::createPipelineCache() {
+    // Seed the cache with last run's data so pipeline creation skips
+    // recompilation; the first run after a driver update starts cold
+    std::vector<char> initial_data;
+    std::ifstream file(PIPELINE_CACHE_PATH, std::ios::binary | std::ios::ate);
+    if (file) {
+        std::streamsize size = file.tellg();
+        if (size > 0) {
+            initial_data.resize(static_cast<size_t>(size));
+            file.seekg(0);
+            if (!file.read(initial_data.data(), size)) {
+                initial_data.clear();
+            }
+        }
+    }
+
+    VkPipelineCacheCreateInfo cache_info = {};
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_info.initialDataSize = initial_data.size();
+    cache_info.pInitialData = initial_data.empty() ? nullptr : initial_data.data();
+
+    VkResult result = vkCreatePipelineCache(m_device, &cache_info, nullptr, &m_pipeline_cache);
+    if (result != VK_SUCCESS && !initial_data.empty()) {
+        // Stale or corrupt on-disk data: retry with an empty cache
+        LOG_WARN("Processing", "On-disk pipeline cache rejected, starting cold");
+        cache_info.initialDataSize = 0;
+        cache_info.pInitialData = nullptr;
+        result = vkCreatePipelineCache(m_device, &cache_info, nullptr, &m_pipeline_cache);
+    }
+
+    if (result != VK_SUCCESS) {
+        LOG_WARN("Processing", "Failed to create pipeline cache: %d", result);
+        m_pipeline_cache = VK_NULL_HANDLE;
+        return Result::SUCCESS;  // Non-fatal: pipelines compile uncached
+    }
+
+    if (!initial_data.empty()) {
+        LOG_INFO("Processing", "Restored pipeline cache from %s (%zu bytes)",
+                 PIPELINE_CACHE_PATH, initial_data.size());
+    }
+
+    return Result::SUCCESS;
+}
+
+void VulkanContext::savePipelineCache() {
+    if (m_pipeline_cache == VK_NULL_HANDLE) {
+        return;
+    }
+
+    size_t size = 0;
+    vkGetPipelineCacheData(m_device, m_pipeline_cache, &size, nullptr);
+    if (size > 0) {
+        std::vector<char> data(size);
+        if (vkGetPipelineCacheData(m_device, m_pipeline_cache, &size, data.data()) == VK_SUCCESS) {
+            std::ofstream file(PIPELINE_CACHE_PATH, std::ios::binary | std::ios::trunc);
+            if (file && file.write(data.data(), static_cast<std::streamsize>(size))) {
+                LOG_INFO("Processing", "Saved pipeline cache to %s (%zu bytes)",
+                         PIPELINE_CACHE_PATH, size);
+            } else {
+                LOG_WARN("Processing", "Failed to write pipeline cache to %s",
+                         PIPELINE_CACHE_PATH);
+            }
+        }
+    }
+
+    vkDestroyPipelineCache(m_device, m_pipeline_cache, nullptr);
+    m_pipeline_cache = VK_NULL_HANDLE;
+}
+
+bool VulkanContext::isSubmitComplete(uint64_t timeline_value) const {
+    if (m_timeline_semaphore == VK_NULL_HANDLE || timeline_value == 0) {
+        return true;
+    }
+
+    uint64_t counter = 0;
+    vkGetSemaphoreCounterValue(m_device, m_timeline_semaphore, &counter);
+    return counter >= timeline_value;
+}
+
+Result VulkanContext::waitSubmit(uint64_t timeline_value, uint64_t timeout_ns) const {
+    if (m_timeline_semaphore == VK_NULL_HANDLE || timeline_value == 0) {
+        return Result::SUCCESS;
+    }
+
+    VkSemaphoreWaitInfo wait_info = {};
+    wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    wait_info.semaphoreCount = 1;
+    wait_info.pSemaphores = &m_timeline_semaphore;
+    wait_info.pValues = &timeline_value;
+
+    VkResult result = vkWaitSemaphores(m_device, &wait_info, timeout_ns);
+    if (result == VK_TIMEOUT) {
+        return Result::ERROR_TIMEOUT;
+    }
+    if (result != VK_SUCCESS) {
+        LOG_ERROR("Processing", "vkWaitSemaphores failed: %d", result);
+        return Result::ERROR_GENERIC;
+    }
+
+    return Result::SUCCESS;
+}
+
+int VulkanContext::createGpuTimer(const std::string& name) {
+    if (!hasGpuTimestamps() || m_device == VK_NULL_HANDLE) {
+        return -1;
+    }
+
+    VkQueryPoolCreateInfo pool_info = {};
+    pool_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    pool_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    pool_info.queryCount = GPU_TIMER_RING * 2;
+
+    GpuTimer timer;
+    timer.name = name;
+    if (vkCreateQueryPool(m_device, &pool_info, nullptr, &timer.pool) != VK_SUCCESS) {
+        LOG_WARN("Processing", "Failed to create timestamp query pool for '%s'",
+                 name.c_str());
+        return -1;
+    }
+
+    m_gpu_timers.push_back(std::move(timer));
+    LOG_DEBUG("Processing", "GPU timer '%s' created (%u pairs)", name.c_str(),
+              GPU_TIMER_RING);
+    return static_cast<int>(m_gpu_timers.size()) - 1;
+}
+
+void VulkanContext::writeGpuTimerBegin(VkCommandBuffer command_buffer, int timer) {
+    if (timer < 0 || timer >= static_cast<int>(m_gpu_timers.size())) {
+        return;
+    }
+    GpuTimer& t = m_gpu_timers[timer];
+
+    // When the ring is full the oldest unresolved pair is sacrificed —
+    // its slot is about to be overwritten
+    if (t.in_flight >= GPU_TIMER_RING) {
+        t.read_slot = (t.read_slot + 1) % GPU_TIMER_RING;
+        t.in_flight--;
+    }
+
+    // Queries must be reset on the GPU timeline before reuse (host reset
+    // needs a feature we don't require)
+    vkCmdResetQueryPool(command_buffer, t.pool, t.write_slot * 2, 2);
+    vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                        t.pool, t.write_slot * 2);
+}
+
+void VulkanContext::writeGpuTimerEnd(VkCommandBuffer command_buffer, int timer) {
+    if (timer < 0 || timer >= static_cast<int>(m_gpu_timers.size())) {
+        return;
+    }
+    GpuTimer& t = m_gpu_timers[timer];
+
+    vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                        t.pool, t.write_slot * 2 + 1);
+    t.write_slot = (t.write_slot + 1) % GPU_TIMER_RING;
+    t.in_flight++;
+}
+
+void VulkanContext::submitGpuTimerBegin(int timer, VkQueue queue) {
+    if (timer < 0 || timer >= static_cast<int>(m_gpu_timers.size())) {
+        return;
+    }
+    VkCommandBuffer cmd = beginCommands();
+    if (cmd == VK_NULL_HANDLE) {
+        return;
+    }
+    writeGpuTimerBegin(cmd, timer);
+    submitCommands(cmd, queue);
+}
+
+void VulkanContext::submitGpuTimerEnd(int timer, VkQueue queue) {
+    if (timer < 0 || timer >= static_cast<int>(m_gpu_timers.size())) {
+        return;
+    }
+    VkCommandBuffer cmd = beginCommands();
+    if (cmd == VK_NULL_HANDLE) {
+        return;
+    }
+    writeGpuTimerEnd(cmd, timer);
+    submitCommands(cmd, queue);
+}
+
+double VulkanContext::getGpuTimerMs(int timer) {
+    if (timer < 0 || timer >= static_cast<int>(m_gpu_timers.size())) {
+        return 0.0;
+    }
+    GpuTimer& t = m_gpu_timers[timer];
+
+    // Drain every pair that has finished on the GPU; never wait. Each
+    // result slot carries {timestamp, availability}
+    while (t.in_flight > 0) {
+        uint64_t results[4] = {};
+        VkResult vr = vkGetQueryPoolResults(
+            m_device, t.pool, t.read_slot * 2, 2,
+            sizeof(results), results, 2 * sizeof(uint64_t),
+            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+        if (vr != VK_SUCCESS || results[1] == 0 || results[3] == 0) {
+            break;  // oldest pair still executing
+        }
+
+        double ms = (double)(results[2] - results[0]) *
+                    (double)m_timestamp_period / 1e6;
+        if (t.has_sample) {
+            t.smoothed_ms = t.smoothed_ms * 0.9 + ms * 0.1;
+        } else {
+            t.smoothed_ms = ms;
+            t.has_sample = true;
+        }
+
+        t.read_slot = (t.read_slot + 1) % GPU_TIMER_RING;
+        t.in_flight--;
+    }
+
+    return t.has_sample ? t.smoothed_ms : 0.0;
 }
 
 VulkanContext::Stats VulkanContext::getStats() const {
@@ -499,6 +1213,7 @@ VulkanContext::Stats VulkanContext::getStats() const {
 
     stats.has_compute_queue = (m_compute_queue_family != UINT32_MAX);
     stats.has_dedicated_transfer_queue = (m_transfer_queue_family != m_graphics_queue_family);
+    stats.has_timeline_semaphores = m_timeline_supported;
 
     return stats;
 }
@@ -14,8 +14,13 @@ public:
     VulkanContext();
     ~VulkanContext();
 
-    // Initialize Vulkan for headless rendering
-    Result initialize(bool enable_validation = false);
+    // Initialize Vulkan for headless rendering.
+    // device_index / device_name select the physical device on multi-GPU
+    // hosts: an explicit index wins, then a case-insensitive substring
+    // match on the device name, then the built-in scoring (discrete GPU
+    // preferred). Both default to "pick for me".
+    Result initialize(bool enable_validation = false, int device_index = -1,
+                      const std::string& device_name = std::string());
 
     // Cleanup resources
     void cleanup();
@@ -35,6 +40,11 @@ public:
     uint32_t getComputeQueueFamily() const { return m_compute_queue_family; }
     uint32_t getTransferQueueFamily() const { return m_transfer_queue_family; }
 
+    // True when compute dispatches run on their own queue (dedicated
+    // compute family, or a second queue of the graphics family) and can
+    // overlap render submissions instead of serializing behind them
+    bool hasAsyncComputeQueue() const { return m_compute_queue != m_graphics_queue; }
+
     // Device properties
     const VkPhysicalDeviceProperties& getDeviceProperties() const { return m_device_properties; }
     const VkPhysicalDeviceMemoryProperties& getMemoryProperties() const { return m_memory_properties; }
@@ -50,9 +60,70 @@ public:
     void destroyCommandPool(VkCommandPool pool);
 
     // Single-time command helpers
+    // endSingleTimeCommands blocks only until this submission retires
+    // (timeline semaphore wait), not until the whole queue drains
     VkCommandBuffer beginSingleTimeCommands(VkCommandPool pool);
     void endSingleTimeCommands(VkCommandBuffer command_buffer, VkCommandPool pool, VkQueue queue);
 
+    // Reusable command buffers with timeline-semaphore tracking.
+    // beginCommands() hands out a pre-recorded slot from a small ring,
+    // recycling it once its previous submission has retired;
+    // submitCommands() signals the context timeline and returns the value
+    // to wait on. Unlike the single-time helpers this never blocks on
+    // submission, so the CPU can queue several frames of work ahead.
+    VkCommandBuffer beginCommands();
+    uint64_t submitCommands(VkCommandBuffer command_buffer, VkQueue queue);
+    bool isSubmitComplete(uint64_t timeline_value) const;
+    Result waitSubmit(uint64_t timeline_value, uint64_t timeout_ns = UINT64_MAX) const;
+
+    // Persistent pipeline cache, restored from disk on init and written
+    // back on cleanup so pipeline creation skips recompilation; may be
+    // VK_NULL_HANDLE (pipelines then compile uncached)
+    VkPipelineCache getPipelineCache() const { return m_pipeline_cache; }
+
+    // Timeline semaphore shared by all submissions through this context
+    VkSemaphore getTimelineSemaphore() const { return m_timeline_semaphore; }
+    uint64_t getTimelineValue() const { return m_timeline_value; }
+    bool hasTimelineSemaphores() const { return m_timeline_supported; }
+
+    // dma-buf import (VK_EXT_external_memory_dma_buf)
+    // Wraps a capture dma-buf as a VkBuffer backed by the same pages, so
+    // the GPU reads capture frames without a CPU-side staging copy. The
+    // fd is dup'd internally; the caller keeps ownership of `fd`.
+    bool hasDmaBufImport() const { return m_dmabuf_import_supported; }
+    Result importDmaBuf(int fd, size_t size, VkBuffer& buffer, VkDeviceMemory& memory);
+
+    // Sync-file export (VK_KHR_external_semaphore_fd)
+    // Returns a sync_file fd that signals once all work submitted to the
+    // graphics queue so far has completed — the fence DRM atomic commits
+    // wait on via IN_FENCE_FD. Returns -1 when unsupported or on failure;
+    // the caller owns the fd and closes it after use.
+    bool hasSyncFdExport() const { return m_syncfd_export_supported; }
+    int exportSyncFd();
+
+    // GPU pass timing (VK_QUERY_TYPE_TIMESTAMP)
+    // createGpuTimer registers a named timer backed by a small ring of
+    // timestamp-pair queries; writeGpuTimerBegin/End bracket one GPU pass
+    // inside a command buffer. Results are resolved asynchronously:
+    // getGpuTimerMs polls finished pairs without waiting, so a reading
+    // trails the pass it measures by a few frames. Unlike the CPU-side
+    // wall clocks in the Stats structs this is actual GPU execution time,
+    // not submission time. createGpuTimer returns -1 when the device has
+    // no usable timestamp support; the write/read calls then no-op.
+    bool hasGpuTimestamps() const { return m_timestamp_period > 0.0f; }
+    int createGpuTimer(const std::string& name);
+    void writeGpuTimerBegin(VkCommandBuffer command_buffer, int timer);
+    void writeGpuTimerEnd(VkCommandBuffer command_buffer, int timer);
+    double getGpuTimerMs(int timer);
+
+    // Bracket GPU work that is recorded outside our control (libplacebo
+    // render passes): submits a single-timestamp command buffer on the
+    // queue before/after the foreign work, so the pair spans its
+    // execution. The caller must flush the foreign work to the queue
+    // between the two calls for the bracket to be honest
+    void submitGpuTimerBegin(int timer, VkQueue queue);
+    void submitGpuTimerEnd(int timer, VkQueue queue);
+
     // Statistics
     struct Stats {
         std::string device_name;
@@ -62,16 +133,28 @@ public:
         uint64_t available_memory_mb;
         bool has_compute_queue;
         bool has_dedicated_transfer_queue;
+        bool has_timeline_semaphores;
     };
 
     Stats getStats() const;
 
+    // True when this device is the one backing the given DRM card (or
+    // when that can't be determined — treat unknown as same-device so
+    // single-GPU hosts behave as before). When false, the render device
+    // and scanout device are different GPUs and processed frames cross
+    // between them as dma-bufs
+    bool drivesDisplayDevice(const std::string& card_path) const;
+
 private:
     // Initialization helpers
     Result createInstance(bool enable_validation);
     Result selectPhysicalDevice();
     Result createLogicalDevice();
     Result findQueueFamilies();
+    Result createSubmitRing();
+    void destroySubmitRing();
+    Result createPipelineCache();
+    void savePipelineCache();
 
     // Validation layers
     bool checkValidationLayerSupport();
@@ -95,14 +178,63 @@ private:
     uint32_t m_graphics_queue_family = UINT32_MAX;
     uint32_t m_compute_queue_family = UINT32_MAX;
     uint32_t m_transfer_queue_family = UINT32_MAX;
+    uint32_t m_compute_queue_index = 0;          // queue index within the compute family
+    uint32_t m_graphics_family_queue_count = 1;  // queues exposed by the graphics family
 
     // Device properties
     VkPhysicalDeviceProperties m_device_properties = {};
     VkPhysicalDeviceMemoryProperties m_memory_properties = {};
     VkPhysicalDeviceFeatures m_device_features = {};
 
+    // Requested device selection (see initialize)
+    int m_requested_device_index = -1;
+    std::string m_requested_device_name;
+
+    // DRM node of the selected device (VK_EXT_physical_device_drm),
+    // used to detect a render/scanout device split
+    bool m_drm_props_valid = false;
+    int64_t m_drm_primary_major = -1;
+    int64_t m_drm_primary_minor = -1;
+
     // Extensions
     std::vector<std::string> m_enabled_extensions;
+    bool m_dmabuf_import_supported = false;
+    bool m_syncfd_export_supported = false;
+
+    // Reusable exportable semaphore for exportSyncFd (SYNC_FD export
+    // copies the payload, so one semaphore serves every frame); each
+    // export waits out the previous signal before re-signaling
+    VkSemaphore m_export_semaphore = VK_NULL_HANDLE;
+    bool m_export_sem_pending = false;
+
+    // Submission ring (timeline-semaphore tracked command buffer reuse)
+    static constexpr uint32_t SUBMIT_RING_SIZE = 4;
+    VkSemaphore m_timeline_semaphore = VK_NULL_HANDLE;
+    uint64_t m_timeline_value = 0;   // last submitted timeline value
+    VkCommandPool m_submit_pool = VK_NULL_HANDLE;
+    VkCommandBuffer m_submit_ring[SUBMIT_RING_SIZE] = {};
+    uint64_t m_submit_ring_value[SUBMIT_RING_SIZE] = {};
+    uint32_t m_submit_ring_index = 0;
+    bool m_timeline_supported = false;
+
+    // Persistent pipeline cache (serialized under the config directory)
+    VkPipelineCache m_pipeline_cache = VK_NULL_HANDLE;
+
+    // GPU timestamp timers (see createGpuTimer). Each timer owns a query
+    // pool holding GPU_TIMER_RING begin/end pairs, written round-robin
+    // and drained lazily by getGpuTimerMs
+    static constexpr uint32_t GPU_TIMER_RING = 4;
+    struct GpuTimer {
+        std::string name;
+        VkQueryPool pool = VK_NULL_HANDLE;
+        uint32_t write_slot = 0;     // next pair to record
+        uint32_t read_slot = 0;      // oldest pair not yet resolved
+        uint32_t in_flight = 0;
+        double smoothed_ms = 0.0;    // EMA of resolved samples
+        bool has_sample = false;
+    };
+    std::vector<GpuTimer> m_gpu_timers;
+    float m_timestamp_period = 0.0f;  // ns per timestamp tick; 0 = unsupported
 
     // State
     bool m_initialized = false;
@@ -2,6 +2,10 @@
 #include "core/logger.h"
 #include <thread>
 #include <cmath>
+#include <algorithm>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include <time.h>
 
 namespace ares {
 namespace sync {
@@ -11,6 +15,10 @@ FrameScheduler::FrameScheduler() {
 }
 
 FrameScheduler::~FrameScheduler() {
+    if (m_timer_fd >= 0) {
+        close(m_timer_fd);
+        m_timer_fd = -1;
+    }
 }
 
 Result FrameScheduler::initialize(float display_refresh_rate, SchedulingAlgorithm algorithm) {
@@ -37,6 +45,16 @@ Result FrameScheduler::initialize(float display_refresh_rate, SchedulingAlgorith
     // Reset statistics
     resetStats();
 
+    planCadence();
+
+    // Absolute-deadline timer for the pacing sleep
+    if (m_timer_fd < 0) {
+        m_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+        if (m_timer_fd < 0) {
+            LOG_WARN("Sync", "timerfd unavailable, pacing falls back to sleep_for");
+        }
+    }
+
     m_initialized = true;
 
     const char* algo_name = "Unknown";
@@ -70,8 +88,23 @@ Result FrameScheduler::scheduleFrame(const VideoFrame& frame) {
         return Result::SUCCESS;
     }
 
-    // Frame rate conversion - check if we should drop this frame
-    if (m_source_frame_rate != m_display_refresh_rate) {
+    // Frame rate conversion: consult the precomputed cadence plan when
+    // one exists, falling back to the per-frame accumulator otherwise
+    int hold = 1;
+    if (m_cadence_size > 0 && !m_vrr_enabled) {
+        hold = m_cadence[m_cadence_index];
+        m_cadence_index = (m_cadence_index + 1) % m_cadence_size;
+
+        if (hold == 0) {
+            m_stats.frames_dropped++;
+            LOG_DEBUG("Sync", "Frame %lu dropped (cadence)", m_frame_number);
+            m_frame_number++;
+            return Result::SUCCESS;
+        }
+        if (hold > 1) {
+            m_stats.frames_duplicated += (uint64_t)(hold - 1);
+        }
+    } else if (m_source_frame_rate != m_display_refresh_rate) {
         if (shouldDropFrame()) {
             m_stats.frames_dropped++;
             LOG_DEBUG("Sync", "Frame %lu dropped (FPS conversion)", m_frame_number);
@@ -80,8 +113,14 @@ Result FrameScheduler::scheduleFrame(const VideoFrame& frame) {
         }
     }
 
-    // Calculate next presentation time
-    TimePoint target_time = calculateNextPresentationTime();
+    // Remember the PTS so the next flip completion can feed the drift
+    // PLL a capture-time/display-time pair
+    m_last_scheduled_pts = frame.pts;
+    m_last_scheduled_pts_valid = true;
+
+    // Calculate next presentation time (spaced by the previous frame's
+    // hold count; in VRR mode derived from the frame's PTS)
+    TimePoint target_time = calculateNextPresentationTime(frame.pts);
 
     // Different handling based on algorithm
     switch (m_algorithm) {
@@ -113,7 +152,8 @@ Result FrameScheduler::scheduleFrame(const VideoFrame& frame) {
 
     // Update state for next frame
     m_last_presentation_time = presentation_time;
-    m_next_scheduled_time = target_time + m_display_frame_duration;
+    m_next_scheduled_time = target_time + m_display_frame_duration * hold;
+    m_hold_intervals = hold;
     m_frame_number++;
     m_stats.frames_scheduled++;
 
@@ -130,6 +170,8 @@ void FrameScheduler::setSourceFrameRate(float fps) {
     m_source_frame_duration = Duration(static_cast<int64_t>(1e9 / fps));
     m_frame_accumulator = 0.0;  // Reset accumulator
 
+    planCadence();
+
     LOG_INFO("Sync", "Source frame rate set to %.3f fps", fps);
 }
 
@@ -142,6 +184,13 @@ void FrameScheduler::setDisplayRefreshRate(float hz) {
     m_display_refresh_rate = hz;
     m_display_frame_duration = Duration(static_cast<int64_t>(1e9 / hz));
 
+    // The vblank train changed; re-lock from fresh flip timestamps
+    m_vblank_locked = false;
+    m_stats.vblank_locked = false;
+    m_wakeup_bias = Duration(0);
+
+    planCadence();
+
     LOG_INFO("Sync", "Display refresh rate set to %.2f Hz", hz);
 }
 
@@ -151,28 +200,155 @@ void FrameScheduler::setAlgorithm(SchedulingAlgorithm algorithm) {
 
 void FrameScheduler::setVRREnabled(bool enabled) {
     m_vrr_enabled = enabled;
+    m_vrr_offset_valid = false;  // Re-latch the PTS mapping
+    planCadence();
     LOG_INFO("Sync", "VRR %s", enabled ? "enabled" : "disabled");
 }
 
-FrameScheduler::TimePoint FrameScheduler::calculateNextPresentationTime() {
-    // For VRR, calculate based on source frame rate
-    if (m_vrr_enabled) {
-        return m_last_presentation_time + m_source_frame_duration;
+void FrameScheduler::setVRRWindow(float min_hz, float max_hz) {
+    if (min_hz <= 0.0f || max_hz <= min_hz) {
+        LOG_WARN("Sync", "Invalid VRR window: %.1f-%.1f Hz", min_hz, max_hz);
+        return;
     }
 
-    // For fixed refresh rate, align to display vsync intervals
+    m_vrr_min_hz = min_hz;
+    m_vrr_max_hz = max_hz;
+    LOG_INFO("Sync", "VRR window set to %.1f-%.1f Hz", min_hz, max_hz);
+}
+
+void FrameScheduler::onFlipComplete(const Timestamp& flip_time, uint32_t sequence) {
+    if (!m_initialized || m_first_frame) {
+        return;
+    }
+
+    // Feed the drift PLL: the flip timestamp is the display clock's
+    // opinion of when the last scheduled capture PTS reached glass
+    if (m_master_clock && m_last_scheduled_pts_valid) {
+        m_master_clock->addDriftSample(m_last_scheduled_pts, flip_time);
+    }
+
+    // Translate the kernel timestamp (steady_clock) into the scheduler's
+    // clock domain via the current offset between the two clocks
+    auto steady_now = std::chrono::steady_clock::now();
+    TimePoint local_now = Clock::now();
+    auto age = std::chrono::duration_cast<Duration>(steady_now - flip_time);
+    TimePoint flip_local = local_now - age;
+
+    // True present latency: from when scheduleFrame released the frame
+    // to when it started scanning out. Reject stale or absurd samples
+    // (a flip can complete after we've already scheduled the next frame)
+    Duration latency = std::chrono::duration_cast<Duration>(
+        flip_local - m_last_presentation_time);
+    if (latency.count() < 0 || latency > m_display_frame_duration * 4) {
+        return;
+    }
+
+    double latency_ms = std::chrono::duration<double, std::milli>(latency).count();
+    m_flip_latency_sum_ms += latency_ms;
+    m_stats.flips_observed++;
+    m_stats.avg_flip_latency_ms = m_flip_latency_sum_ms / m_stats.flips_observed;
+
+    // Anchor the vblank train to the measured flip time
+    m_vblank_anchor = flip_local;
+    m_vblank_locked = true;
+    m_stats.vblank_locked = true;
+
+    // Systematic wakeup bias: the offset between our wakeup and the
+    // vblank the flip actually landed on, folded into one period.
+    // EWMA (1/8) smooths scheduling jitter out of the estimate
+    Duration bias = latency;
+    while (bias >= m_display_frame_duration) {
+        bias -= m_display_frame_duration;
+    }
+    m_wakeup_bias += (bias - m_wakeup_bias) / 8;
+
+    LOG_DEBUG("Sync", "Flip %u: latency %.3f ms, wakeup bias %.3f ms", sequence,
+              latency_ms, std::chrono::duration<double, std::milli>(m_wakeup_bias).count());
+}
+
+FrameScheduler::TimePoint FrameScheduler::calculateNextPresentationTime(const Timestamp& pts) {
     TimePoint now = Clock::now();
-    Duration elapsed_since_last = now - m_last_presentation_time;
 
-    // If we're late, schedule for next vsync
-    if (elapsed_since_last > m_display_frame_duration) {
-        // Calculate how many frames we're late
+    // VRR: present at the frame's exact PTS-derived deadline. The
+    // display starts scanout when the flip lands, so no vblank
+    // quantization is needed — source cadence passes through untouched
+    if (m_vrr_enabled) {
+        // Drift-corrected PTS: once the PLL has locked, the capture
+        // timestamp is rescaled into the display clock domain so the
+        // crystal offset becomes a continuous sub-ms phase slide
+        // instead of an eventual step correction
+        Timestamp effective_pts = pts;
+        if (m_master_clock && m_master_clock->isDriftLocked()) {
+            effective_pts = m_master_clock->toDisplayTime(pts);
+        }
+
+        // Translate the capture PTS (steady_clock) into our clock domain
+        auto steady_now = std::chrono::steady_clock::now();
+        Duration pts_age = std::chrono::duration_cast<Duration>(steady_now - effective_pts);
+        TimePoint pts_local = now - pts_age;
+
+        // Latch the PTS->presentation offset on the first frame: one
+        // source interval of buffering absorbs processing jitter
+        if (!m_vrr_offset_valid) {
+            m_vrr_offset = pts_age + m_source_frame_duration;
+            m_vrr_offset_valid = true;
+        }
+
+        TimePoint target = pts_local + m_vrr_offset;
+
+        // Keep consecutive intervals inside the display's VRR window
+        Duration min_interval = Duration(static_cast<int64_t>(1e9 / m_vrr_max_hz));
+        Duration max_interval = Duration(static_cast<int64_t>(1e9 / m_vrr_min_hz));
+        if (target < m_last_presentation_time + min_interval) {
+            target = m_last_presentation_time + min_interval;
+        } else if (target > m_last_presentation_time + max_interval) {
+            target = m_last_presentation_time + max_interval;
+        }
+
+        // If the source PTS train jumped (input switch, capture restart),
+        // re-latch rather than chasing an unreachable deadline
+        if (target + max_interval < now) {
+            m_vrr_offset = pts_age + m_source_frame_duration;
+            target = pts_local + m_vrr_offset;
+            LOG_DEBUG("Sync", "VRR PTS discontinuity, re-latched offset");
+        }
+
+        return target;
+    }
+
+    // Phase-locked path: snap the target to the vblank train measured
+    // from page-flip timestamps, waking ahead of each vblank by the
+    // observed wakeup bias so the flip is queued just in time
+    if (m_vblank_locked) {
+        Duration period = m_display_frame_duration;
+
+        // Nominal target: the previous frame's hold count of refreshes
+        // after its presentation, snapped onto the vblank train
+        TimePoint nominal = m_last_presentation_time + period * m_hold_intervals;
+        Duration offset = std::chrono::duration_cast<Duration>(
+            (nominal + m_wakeup_bias) - m_vblank_anchor);
+        int64_t intervals = (offset.count() + period.count() / 2) / period.count();
+        TimePoint target = m_vblank_anchor + period * intervals - m_wakeup_bias;
+
+        // If that vblank has already passed, take the next one
+        while (target <= now) {
+            target += period;
+        }
+        return target;
+    }
+
+    // Free-running path: align to display vsync intervals from our own
+    // wakeup times, spaced by the previous frame's hold count
+    TimePoint nominal = m_last_presentation_time + m_display_frame_duration * m_hold_intervals;
+
+    // If we're late, schedule for the next interval boundary
+    if (nominal <= now) {
+        Duration elapsed_since_last = now - m_last_presentation_time;
         int64_t frames_late = elapsed_since_last.count() / m_display_frame_duration.count();
         return m_last_presentation_time + (m_display_frame_duration * (frames_late + 1));
     }
 
-    // Schedule for next regular interval
-    return m_last_presentation_time + m_display_frame_duration;
+    return nominal;
 }
 
 void FrameScheduler::waitUntilPresentationTime(TimePoint target_time) {
@@ -183,24 +359,49 @@ void FrameScheduler::waitUntilPresentationTime(TimePoint target_time) {
         return;
     }
 
-    Duration sleep_duration = target_time - now;
-
-    // Sleep for most of the duration (leave 2ms for busy wait)
-    constexpr auto BUSY_WAIT_THRESHOLD = std::chrono::milliseconds(2);
-
-    if (sleep_duration > BUSY_WAIT_THRESHOLD) {
-        Duration sleep_time = sleep_duration - BUSY_WAIT_THRESHOLD;
+    // Sleep to (target - spin window), leaving the calibrated margin for
+    // the busy wait
+    TimePoint wake_target = target_time - m_spin_window;
+
+    if (wake_target > now) {
+        if (m_timer_fd >= 0) {
+            // Absolute deadline on the monotonic clock: immune to the
+            // time spent computing it, unlike a relative sleep_for
+            Duration remaining = std::chrono::duration_cast<Duration>(wake_target - now);
+            struct timespec mono;
+            clock_gettime(CLOCK_MONOTONIC, &mono);
+            int64_t deadline_ns = (int64_t)mono.tv_sec * 1000000000ll + mono.tv_nsec +
+                                  remaining.count();
+
+            struct itimerspec its = {};
+            its.it_value.tv_sec = deadline_ns / 1000000000ll;
+            its.it_value.tv_nsec = deadline_ns % 1000000000ll;
+
+            uint64_t expirations = 0;
+            if (timerfd_settime(m_timer_fd, TFD_TIMER_ABSTIME, &its, nullptr) == 0 &&
+                read(m_timer_fd, &expirations, sizeof(expirations)) == sizeof(expirations)) {
+                // Timer fired
+            } else {
+                std::this_thread::sleep_for(wake_target - Clock::now());
+            }
+        } else {
+            std::this_thread::sleep_for(wake_target - Clock::now());
+        }
 
-        TimePoint sleep_start = Clock::now();
-        std::this_thread::sleep_for(sleep_time);
-        TimePoint sleep_end = Clock::now();
+        // Measure how late the kernel woke us; this is the error the
+        // spin window exists to absorb
+        TimePoint woke = Clock::now();
+        Duration wake_error = woke > wake_target
+                                  ? std::chrono::duration_cast<Duration>(woke - wake_target)
+                                  : Duration(0);
 
-        // Track sleep error for statistics
-        Duration actual_sleep = sleep_end - sleep_start;
-        Duration sleep_error = actual_sleep > sleep_time ?
-                              (actual_sleep - sleep_time) : (sleep_time - actual_sleep);
+        m_sleep_error_sum_ms += std::chrono::duration<double, std::milli>(wake_error).count();
 
-        m_sleep_error_sum_ms += std::chrono::duration<double, std::milli>(sleep_error).count();
+        m_wake_errors[m_wake_error_count % WAKE_ERROR_SAMPLES] = wake_error.count();
+        m_wake_error_count++;
+        if (m_wake_error_count % WAKE_ERROR_SAMPLES == 0) {
+            recalibrateSpinWindow();
+        }
     }
 
     // Busy wait for remaining time (for precise timing)
@@ -210,6 +411,29 @@ void FrameScheduler::waitUntilPresentationTime(TimePoint target_time) {
     }
 }
 
+void FrameScheduler::recalibrateSpinWindow() {
+    // Size the spin window to the observed p99 wakeup error plus a small
+    // guard, clamped to sane bounds: a tuned kernel settles near its
+    // ~60 us wakeup latency while a stock kernel sits near ~400 us,
+    // without either missing deadlines or burning a core
+    std::array<int64_t, WAKE_ERROR_SAMPLES> sorted = m_wake_errors;
+    std::sort(sorted.begin(), sorted.end());
+    int64_t p99_ns = sorted[(WAKE_ERROR_SAMPLES * 99) / 100];
+
+    constexpr int64_t GUARD_NS = 20000;       // 20 us
+    constexpr int64_t MIN_NS = 50000;         // 50 us
+    constexpr int64_t MAX_NS = 2000000;       // 2 ms
+
+    int64_t window_ns = std::clamp(p99_ns + GUARD_NS, MIN_NS, MAX_NS);
+    Duration new_window = Duration(window_ns);
+
+    if (new_window != m_spin_window) {
+        LOG_DEBUG("Sync", "Spin window recalibrated: %.0f us (p99 wakeup error %.0f us)",
+                  window_ns / 1000.0, p99_ns / 1000.0);
+        m_spin_window = new_window;
+    }
+}
+
 bool FrameScheduler::shouldDropFrame() {
     // Frame rate conversion using accumulator
     // Accumulator tracks how much "time" we've accumulated relative to display
@@ -231,6 +455,55 @@ bool FrameScheduler::shouldDropFrame() {
     return false;
 }
 
+void FrameScheduler::planCadence() {
+    m_cadence_size = 0;
+    m_cadence_index = 0;
+    m_hold_intervals = 1;
+
+    double ratio = (double)m_display_refresh_rate / (double)m_source_frame_rate;
+
+    // Rates match (or VRR drives the display at the source rate): no
+    // conversion, every frame holds exactly one refresh
+    if (m_vrr_enabled || std::fabs(ratio - 1.0) < 0.002) {
+        return;
+    }
+
+    // Shortest window of source frames spanning a whole number of
+    // refreshes: 24->60 needs 2 frames (5 refreshes), 25->60 needs 5
+    // frames (12 refreshes). Irrational-ish ratios cap at MAX_CADENCE,
+    // where the residual error is a fraction of a refresh per window
+    size_t window = MAX_CADENCE;
+    for (size_t n = 1; n <= MAX_CADENCE; n++) {
+        double refreshes = n * ratio;
+        if (std::fabs(refreshes - std::round(refreshes)) < 0.001 * n) {
+            window = n;
+            break;
+        }
+    }
+
+    // Spread the refreshes evenly across the window (Bresenham): frame i
+    // holds floor((i+1)*ratio) - floor(i*ratio) refreshes. A 0 entry
+    // means the frame is dropped (source faster than display)
+    for (size_t i = 0; i < window; i++) {
+        int64_t lo = (int64_t)std::floor(i * ratio + 1e-9);
+        int64_t hi = (int64_t)std::floor((i + 1) * ratio + 1e-9);
+        int64_t hold = hi - lo;
+        m_cadence[i] = (uint8_t)std::clamp<int64_t>(hold, 0, 255);
+    }
+    m_cadence_size = window;
+
+    // Log the pattern (truncated for long windows)
+    char pattern[64];
+    size_t pos = 0;
+    for (size_t i = 0; i < window && pos + 5 < sizeof(pattern); i++) {
+        pos += snprintf(pattern + pos, sizeof(pattern) - pos, "%s%u",
+                        i ? ":" : "", m_cadence[i]);
+    }
+    LOG_INFO("Sync", "Cadence plan: %.3f fps -> %.2f Hz, window %zu (%s%s)",
+             m_source_frame_rate, m_display_refresh_rate, window, pattern,
+             pos + 5 >= sizeof(pattern) ? "..." : "");
+}
+
 bool FrameScheduler::shouldDuplicateFrame() {
     // For frame rate conversion where source < display
     // This is handled by the accumulator in shouldDropFrame()
@@ -266,14 +539,17 @@ FrameScheduler::Stats FrameScheduler::getStats() const {
     stats.display_refresh_hz = m_display_refresh_rate;
     stats.vrr_enabled = m_vrr_enabled;
     stats.algorithm = m_algorithm;
+    stats.cadence_length = (uint32_t)m_cadence_size;
     return stats;
 }
 
 void FrameScheduler::resetStats() {
     m_stats = Stats();
+    m_stats.vblank_locked = m_vblank_locked;
     m_latency_sum_ms = 0.0;
     m_interval_sum_ms = 0.0;
     m_sleep_error_sum_ms = 0.0;
+    m_flip_latency_sum_ms = 0.0;
     m_presentation_history.clear();
 
     LOG_DEBUG("Sync", "Statistics reset");
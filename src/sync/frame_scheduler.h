@@ -1,8 +1,10 @@
 #pragma once
 
 #include <ares/types.h>
+#include "master_clock.h"
 #include <chrono>
 #include <deque>
+#include <array>
 
 namespace ares {
 namespace sync {
@@ -12,7 +14,7 @@ enum class SchedulingAlgorithm {
     IMMEDIATE,      // Present immediately (lowest latency, may cause tearing)
     VSYNC,          // Wait for vsync (eliminates tearing)
     ADAPTIVE,       // Adaptive vsync (vsync when >= refresh, immediate when below)
-    FRAME_PACING    // Frame pacing with sleep + busy wait (best smoothness)
+    FRAME_PACING    // timerfd absolute deadline + calibrated spin (best smoothness)
 };
 
 // Frame scheduler for precise timing and judder-free playback
@@ -39,6 +41,24 @@ public:
     // Enable/disable VRR mode
     void setVRREnabled(bool enabled);
 
+    // Set the display's VRR refresh window (Hz). In VRR mode each frame
+    // is presented at its exact PTS-derived deadline instead of being
+    // quantized to the vblank grid; intervals are clamped so they never
+    // fall outside what the display will track
+    void setVRRWindow(float min_hz, float max_hz);
+
+    // Feed a page-flip completion back into the scheduler. flip_time is
+    // the kernel's vblank timestamp for the flip (when the frame hit
+    // glass): it measures true present latency, locks the schedule's
+    // phase to the actual vblank train, and updates the wakeup-bias
+    // estimate that scheduleFrame leads each vblank by
+    void onFlipComplete(const Timestamp& flip_time, uint32_t sequence);
+
+    // Attach the master clock's drift PLL: flip completions feed it
+    // capture-PTS/flip-time pairs, and VRR deadlines are derived from
+    // the drift-corrected time base instead of raw capture PTS
+    void setMasterClock(MasterClock* clock) { m_master_clock = clock; }
+
     // Get statistics
     struct Stats {
         uint64_t frames_scheduled = 0;
@@ -55,6 +75,14 @@ public:
 
         bool vrr_enabled = false;
         SchedulingAlgorithm algorithm = SchedulingAlgorithm::IMMEDIATE;
+
+        // Flip-feedback measurements (valid once flips_observed > 0)
+        uint64_t flips_observed = 0;
+        double avg_flip_latency_ms = 0.0;   // wakeup -> glass
+        bool vblank_locked = false;
+
+        // Cadence plan (0 = rates match or VRR, per-frame conversion off)
+        uint32_t cadence_length = 0;
     };
 
     Stats getStats() const;
@@ -67,18 +95,33 @@ private:
     using TimePoint = std::chrono::time_point<Clock>;
     using Duration = std::chrono::nanoseconds;
 
-    // Calculate next presentation time
-    TimePoint calculateNextPresentationTime();
+    // Calculate next presentation time. In VRR mode the target is
+    // derived from the frame's capture PTS; otherwise the PTS is unused
+    TimePoint calculateNextPresentationTime(const Timestamp& pts);
 
-    // Wait until presentation time (sleep + busy wait)
+    // Wait until presentation time: timerfd sleep with an absolute
+    // deadline up to (target - spin window), then busy wait. The spin
+    // window tracks the p99 of measured timerfd wakeup error, so a tuned
+    // kernel (~60 us wakeups) spins far less than a stock one (~400 us)
     void waitUntilPresentationTime(TimePoint target_time);
 
+    // Re-derive the spin window from the wakeup-error samples
+    void recalibrateSpinWindow();
+
     // Determine if frame should be dropped (for frame rate conversion)
     bool shouldDropFrame();
 
     // Determine if frame should be duplicated
     bool shouldDuplicateFrame();
 
+    // Rebuild the cadence table from the current source/display rates.
+    // Each entry is how many display refreshes one source frame holds
+    // (24->60 gives 3:2, 25->60 gives 3:2:2:3:2, 0 entries drop the
+    // frame when source runs faster than the display). Per-frame
+    // scheduling then becomes a table lookup instead of a fresh
+    // repeat/drop decision every frame
+    void planCadence();
+
     // Update running statistics
     void updateStats(Duration presentation_latency, Duration frame_interval);
 
@@ -91,6 +134,15 @@ private:
     SchedulingAlgorithm m_algorithm = SchedulingAlgorithm::FRAME_PACING;
     bool m_vrr_enabled = false;
 
+    // VRR window and PTS->presentation mapping. The offset is latched on
+    // the first VRR frame (one source interval of buffering) and maps
+    // each capture PTS to its presentation deadline, so cadence follows
+    // the source exactly instead of a repeat pattern
+    float m_vrr_min_hz = 40.0f;
+    float m_vrr_max_hz = 120.0f;
+    Duration m_vrr_offset = Duration(0);
+    bool m_vrr_offset_valid = false;
+
     // Timing state
     TimePoint m_last_presentation_time;
     TimePoint m_next_scheduled_time;
@@ -100,10 +152,43 @@ private:
     // Frame rate conversion state
     double m_frame_accumulator = 0.0;  // For fractional frame rate conversion
 
+    // Cadence plan: shortest window of source frames covering a whole
+    // number of refreshes, refreshes spread evenly across it (Bresenham)
+    static constexpr size_t MAX_CADENCE = 120;
+    std::array<uint8_t, MAX_CADENCE> m_cadence = {};
+    size_t m_cadence_size = 0;      // 0 = no conversion needed
+    size_t m_cadence_index = 0;
+    int m_hold_intervals = 1;       // refreshes the last presented frame holds
+
+    // Drift PLL hookup (optional). The last scheduled frame's PTS is
+    // paired with the next flip timestamp — the constant one-frame
+    // skew lands in the PLL's phase term, not its frequency estimate
+    MasterClock* m_master_clock = nullptr;
+    Timestamp m_last_scheduled_pts = {};
+    bool m_last_scheduled_pts_valid = false;
+
+    // Flip feedback state: a recent vblank time (in scheduler clock
+    // domain) anchoring the vblank train, and the EWMA of the offset
+    // between our wakeup and the vblank the flip landed on
+    TimePoint m_vblank_anchor;
+    bool m_vblank_locked = false;
+    Duration m_wakeup_bias = Duration(0);
+    double m_flip_latency_sum_ms = 0.0;
+
     // Frame history (for adaptive algorithms)
     std::deque<TimePoint> m_presentation_history;
     static constexpr size_t MAX_HISTORY_SIZE = 60;
 
+    // Absolute-deadline timer (CLOCK_MONOTONIC timerfd); -1 when
+    // unavailable, falling back to sleep_for with the same spin window
+    int m_timer_fd = -1;
+
+    // Wakeup-error samples (ns) feeding the spin window calibration
+    static constexpr size_t WAKE_ERROR_SAMPLES = 128;
+    std::array<int64_t, WAKE_ERROR_SAMPLES> m_wake_errors = {};
+    size_t m_wake_error_count = 0;
+    Duration m_spin_window = std::chrono::microseconds(500);
+
     // Statistics
     Stats m_stats;
     double m_latency_sum_ms = 0.0;
@@ -0,0 +1,148 @@
+#include "latency_tracer.h"
+#include "core/logger.h"
+
+namespace ares {
+namespace sync {
+
+namespace {
+
+double toMs(Duration d) {
+    return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(d).count();
+}
+
+} // namespace
+
+void LatencyTracer::Histogram::add(double ms) {
+    if (ms < 0.0) {
+        ms = 0.0;
+    }
+
+    size_t bucket = static_cast<size_t>(ms / BUCKET_MS);
+    if (bucket >= BUCKET_COUNT) {
+        bucket = BUCKET_COUNT - 1;
+    }
+    buckets[bucket]++;
+
+    if (samples == 0 || ms < min_ms) {
+        min_ms = ms;
+    }
+    if (ms > max_ms) {
+        max_ms = ms;
+    }
+    sum_ms += ms;
+    samples++;
+}
+
+LatencyTracer::StageStats LatencyTracer::Histogram::toStats() const {
+    StageStats stats;
+    stats.samples = samples;
+    if (samples == 0) {
+        return stats;
+    }
+
+    stats.avg_ms = sum_ms / static_cast<double>(samples);
+    stats.min_ms = min_ms;
+    stats.max_ms = max_ms;
+
+    // p99 from bucket counts (upper edge of the bucket the rank falls in)
+    uint64_t rank = (samples * 99 + 99) / 100;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += buckets[i];
+        if (seen >= rank) {
+            stats.p99_ms = static_cast<double>(i + 1) * BUCKET_MS;
+            break;
+        }
+    }
+    return stats;
+}
+
+void LatencyTracer::onFramePopped(Timestamp capture_pts) {
+    if (!m_enabled) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending_pts = capture_pts;
+    m_pending_pop = std::chrono::steady_clock::now();
+    m_pending_processed = {};
+    m_pending_valid = false;
+
+    m_queue.add(toMs(m_pending_pop - capture_pts));
+}
+
+void LatencyTracer::onFrameProcessed() {
+    if (!m_enabled) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pending_processed = std::chrono::steady_clock::now();
+    m_pending_valid = true;
+    m_marker = !m_marker;
+
+    m_pipeline.add(toMs(m_pending_processed - m_pending_pop));
+}
+
+void LatencyTracer::onFlip(Timestamp flip_time) {
+    if (!m_enabled) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_pending_valid) {
+        // Flip for a repeated frame: nothing new reached the screen
+        m_flips_unmatched++;
+        return;
+    }
+    m_pending_valid = false;
+    m_flips_matched++;
+
+    double present_ms = toMs(flip_time - m_pending_processed);
+    double total_ms = toMs(flip_time - m_pending_pts);
+    m_present.add(present_ms);
+    m_total.add(total_ms);
+
+    // One line per measured flip at DEBUG: field recordings of the marker
+    // square are aligned against these
+    LOG_DEBUG("Latency", "flip marker=%s total=%.2fms (queue+pipe+present)",
+              m_marker ? "white" : "black", total_ms);
+}
+
+LatencyTracer::Stats LatencyTracer::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Stats stats;
+    stats.queue = m_queue.toStats();
+    stats.pipeline = m_pipeline.toStats();
+    stats.present = m_present.toStats();
+    stats.total = m_total.toStats();
+    stats.flips_matched = m_flips_matched;
+    stats.flips_unmatched = m_flips_unmatched;
+    return stats;
+}
+
+void LatencyTracer::logReport() const {
+    Stats stats = getStats();
+    if (stats.total.samples == 0) {
+        LOG_INFO("Latency", "No flips measured yet (%lu frames in flight)",
+                 (unsigned long)stats.queue.samples);
+        return;
+    }
+
+    LOG_INFO("Latency", "capture->flip over %lu frames (%lu repeat flips):",
+             (unsigned long)stats.flips_matched, (unsigned long)stats.flips_unmatched);
+    LOG_INFO("Latency", "  queue:    avg %.2f min %.2f max %.2f p99 %.2f ms",
+             stats.queue.avg_ms, stats.queue.min_ms, stats.queue.max_ms, stats.queue.p99_ms);
+    LOG_INFO("Latency", "  pipeline: avg %.2f min %.2f max %.2f p99 %.2f ms",
+             stats.pipeline.avg_ms, stats.pipeline.min_ms, stats.pipeline.max_ms,
+             stats.pipeline.p99_ms);
+    LOG_INFO("Latency", "  present:  avg %.2f min %.2f max %.2f p99 %.2f ms",
+             stats.present.avg_ms, stats.present.min_ms, stats.present.max_ms,
+             stats.present.p99_ms);
+    LOG_INFO("Latency", "  total:    avg %.2f min %.2f max %.2f p99 %.2f ms",
+             stats.total.avg_ms, stats.total.min_ms, stats.total.max_ms, stats.total.p99_ms);
+}
+
+} // namespace sync
+} // namespace ares
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <ares/types.h>
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+namespace ares {
+namespace sync {
+
+// Glass-to-glass latency measurement
+// Correlates the timestamps a frame already carries (capture PTS, buffer
+// pop, pipeline completion) with the page-flip timestamp DRM reports for
+// the scanout it ends up on, and keeps a per-stage latency distribution:
+//
+//   queue:    capture PTS -> pop from the capture buffer
+//   pipeline: pop -> processFrame() returns
+//   present:  processFrame() -> page flip completes
+//   total:    capture PTS -> page flip (glass-to-glass minus panel lag)
+//
+// The main loop drives onFramePopped()/onFrameProcessed(); the DRM flip
+// callback drives onFlip() (possibly from the event loop thread), so all
+// state is mutex-guarded. Only one frame is in flight between pop and
+// flip in this loop, so correlation is a single pending record.
+//
+// markerState() alternates every processed frame. The OSD draws it as a
+// corner square and the flip log line carries its state, so a photodiode
+// or high-speed camera pointed at the panel can be lined up against the
+// flip timestamps to measure true glass-to-glass including panel lag.
+class LatencyTracer {
+public:
+    void setEnabled(bool enabled) { m_enabled = enabled; }
+    bool isEnabled() const { return m_enabled; }
+
+    // Stage hooks
+    void onFramePopped(Timestamp capture_pts);
+    void onFrameProcessed();
+    void onFlip(Timestamp flip_time);
+
+    // Marker pattern state for the current frame (flips in onFrameProcessed)
+    bool markerState() const { return m_marker; }
+
+    // Per-stage distribution over all samples since start
+    struct StageStats {
+        uint64_t samples = 0;
+        double avg_ms = 0.0;
+        double min_ms = 0.0;
+        double max_ms = 0.0;
+        double p99_ms = 0.0;
+    };
+
+    struct Stats {
+        StageStats queue;
+        StageStats pipeline;
+        StageStats present;
+        StageStats total;
+        uint64_t flips_matched = 0;
+        uint64_t flips_unmatched = 0;  // repeat flips with no new frame
+    };
+
+    Stats getStats() const;
+
+    // Log the current distribution (called from the periodic stats block)
+    void logReport() const;
+
+private:
+    // Fixed-bucket histogram: 0.25 ms buckets up to 64 ms, overflow in
+    // the last bucket. Enough resolution for p99 on a sub-frame budget
+    struct Histogram {
+        static constexpr double BUCKET_MS = 0.25;
+        static constexpr size_t BUCKET_COUNT = 256;
+
+        std::array<uint64_t, BUCKET_COUNT> buckets{};
+        uint64_t samples = 0;
+        double sum_ms = 0.0;
+        double min_ms = 0.0;
+        double max_ms = 0.0;
+
+        void add(double ms);
+        StageStats toStats() const;
+    };
+
+    bool m_enabled = false;
+    bool m_marker = false;
+
+    // Frame currently between pop and flip
+    Timestamp m_pending_pts{};
+    Timestamp m_pending_pop{};
+    Timestamp m_pending_processed{};
+    bool m_pending_valid = false;
+
+    Histogram m_queue;
+    Histogram m_pipeline;
+    Histogram m_present;
+    Histogram m_total;
+    uint64_t m_flips_matched = 0;
+    uint64_t m_flips_unmatched = 0;
+
+    mutable std::mutex m_mutex;
+};
+
+} // namespace sync
+} // namespace ares
@@ -104,6 +104,83 @@ int64_t MasterClock::getResolution() const {
     return m_resolution_ns;
 }
 
+void MasterClock::addDriftSample(Timestamp capture_pts, Timestamp flip_time) {
+    // Loop gains: phase corrects quickly, frequency integrates slowly
+    // so scheduling jitter can't masquerade as crystal drift
+    constexpr double KP = 0.05;
+    constexpr double KI = 0.02;
+    constexpr double MAX_RATIO_PPM = 500.0;      // sane crystal tolerance
+    constexpr double MAX_ERROR_NS = 50e6;        // 50 ms: discontinuity
+    constexpr double MIN_BASELINE_NS = 1e9;      // frequency needs a baseline
+    constexpr double LOCK_ERROR_NS = 5e5;        // locked below 0.5 ms
+    constexpr uint64_t LOCK_SAMPLES = 120;       // ~2 s of flips at 60 Hz
+
+    int64_t pts_ns = toNanoseconds(capture_pts);
+    int64_t flip_ns = toNanoseconds(flip_time);
+
+    std::lock_guard<std::mutex> lock(m_pll_mutex);
+
+    if (m_pll_samples == 0) {
+        m_pll_base_pts_ns = pts_ns;
+        m_pll_base_flip_ns = flip_ns;
+        m_pll_samples = 1;
+        return;
+    }
+
+    double elapsed_pts = (double)(pts_ns - m_pll_base_pts_ns);
+    double predicted = (double)m_pll_base_flip_ns + m_pll_offset_ns +
+                       m_pll_ratio * elapsed_pts;
+    double error = (double)flip_ns - predicted;
+
+    // PTS discontinuity (input switch, capture restart): restart the
+    // loop from this sample rather than chasing a huge error
+    if (error > MAX_ERROR_NS || error < -MAX_ERROR_NS) {
+        LOG_INFO("Sync", "Drift PLL discontinuity (%.1f ms), re-basing",
+                 error / 1e6);
+        m_pll_base_pts_ns = pts_ns;
+        m_pll_base_flip_ns = flip_ns;
+        m_pll_offset_ns = 0.0;
+        m_pll_samples = 1;
+        m_pll_locked = false;
+        return;
+    }
+
+    m_pll_offset_ns += KP * error;
+    if (elapsed_pts > MIN_BASELINE_NS) {
+        m_pll_ratio += KI * (error / elapsed_pts);
+        double max_dev = MAX_RATIO_PPM * 1e-6;
+        if (m_pll_ratio > 1.0 + max_dev) m_pll_ratio = 1.0 + max_dev;
+        if (m_pll_ratio < 1.0 - max_dev) m_pll_ratio = 1.0 - max_dev;
+    }
+
+    m_pll_last_error_ns = error;
+    m_pll_samples++;
+    m_pll_locked = m_pll_samples >= LOCK_SAMPLES &&
+                   error < LOCK_ERROR_NS && error > -LOCK_ERROR_NS;
+}
+
+Timestamp MasterClock::toDisplayTime(Timestamp capture_pts) const {
+    std::lock_guard<std::mutex> lock(m_pll_mutex);
+    if (m_pll_samples < 2) {
+        return capture_pts;  // no model yet, identity mapping
+    }
+
+    double elapsed = (double)(toNanoseconds(capture_pts) - m_pll_base_pts_ns);
+    int64_t display_ns = m_pll_base_flip_ns +
+                         (int64_t)(m_pll_offset_ns + m_pll_ratio * elapsed);
+    return fromNanoseconds(display_ns);
+}
+
+double MasterClock::getDriftPPM() const {
+    std::lock_guard<std::mutex> lock(m_pll_mutex);
+    return (m_pll_ratio - 1.0) * 1e6;
+}
+
+bool MasterClock::isDriftLocked() const {
+    std::lock_guard<std::mutex> lock(m_pll_mutex);
+    return m_pll_locked;
+}
+
 MasterClock::Stats MasterClock::getStats() const {
     Stats stats;
 
@@ -116,6 +193,14 @@ MasterClock::Stats MasterClock::getStats() const {
     stats.now_calls = calls;
     stats.avg_call_time_ns = calls > 0 ? (double)total_time / calls : 0.0;
 
+    {
+        std::lock_guard<std::mutex> lock(m_pll_mutex);
+        stats.pll_drift_ppm = (m_pll_ratio - 1.0) * 1e6;
+        stats.pll_last_error_ms = m_pll_last_error_ns / 1e6;
+        stats.pll_samples = m_pll_samples;
+        stats.pll_locked = m_pll_locked;
+    }
+
     return stats;
 }
 
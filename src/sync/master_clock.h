@@ -2,6 +2,7 @@
 
 #include <ares/types.h>
 #include <atomic>
+#include <mutex>
 #include <cstdint>
 
 namespace ares {
@@ -41,12 +42,36 @@ public:
     // Get clock resolution in nanoseconds
     int64_t getResolution() const;
 
+    // Software PLL locking the capture clock to the display clock.
+    // The DeckLink's 59.94 Hz and the display's 59.94 Hz come from
+    // different crystals; the residual ppm error accumulates over a
+    // film until a frame must be dropped or repeated. addDriftSample()
+    // feeds pairs of capture PTS and kernel page-flip timestamps; a PI
+    // loop estimates the frequency ratio between the two domains, and
+    // toDisplayTime() maps capture timestamps onto the corrected time
+    // base so schedulers absorb the drift as continuous sub-millisecond
+    // phase adjustments instead of step corrections.
+    void addDriftSample(Timestamp capture_pts, Timestamp flip_time);
+    Timestamp toDisplayTime(Timestamp capture_pts) const;
+
+    // Estimated capture-vs-display drift in parts per million
+    double getDriftPPM() const;
+
+    // True once the frequency estimate has settled
+    bool isDriftLocked() const;
+
     // Statistics
     struct Stats {
         int64_t resolution_ns;      // Clock resolution
         int64_t uptime_ns;          // Time since clock creation
         uint64_t now_calls;         // Number of now() calls
         double avg_call_time_ns;   // Average time for now() call
+
+        // Drift PLL state
+        double pll_drift_ppm = 0.0;
+        double pll_last_error_ms = 0.0;
+        uint64_t pll_samples = 0;
+        bool pll_locked = false;
     };
 
     Stats getStats() const;
@@ -64,6 +89,17 @@ private:
 
     // Get raw clock value in nanoseconds
     int64_t getRawTime() const;
+
+    // Drift PLL state, guarded by m_pll_mutex (samples arrive from the
+    // flip reap, lookups from the scheduling thread)
+    mutable std::mutex m_pll_mutex;
+    int64_t m_pll_base_pts_ns = 0;    // first sample's capture PTS
+    int64_t m_pll_base_flip_ns = 0;   // first sample's flip timestamp
+    double m_pll_ratio = 1.0;         // display ns per capture ns
+    double m_pll_offset_ns = 0.0;     // residual phase correction
+    double m_pll_last_error_ns = 0.0;
+    uint64_t m_pll_samples = 0;
+    bool m_pll_locked = false;
 };
 
 } // namespace sync
@@ -218,8 +218,10 @@ int main(int argc, char* argv[]) {
             last_stats_time = now;
         }
 
-        // Clean up frame data
-        if (frame.data) {
+        // Clean up frame data (zero-copy frames release their driver buffer)
+        if (frame.isDriverOwned()) {
+            frame.release();
+        } else if (frame.data) {
             delete[] frame.data;
         }
     }